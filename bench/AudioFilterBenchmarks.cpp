@@ -0,0 +1,75 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/AudioFilter.hpp"
+#include "bench/SyntheticSignals.hpp"
+
+namespace tms_express {
+
+/// @brief Number of samples filtered per iteration (10 s at 8 kHz)
+static constexpr int kNFilterSamples = 80000;
+
+/// @brief Benchmarks a filter applied to ten seconds of synthetic speech
+/// @param state Benchmark state
+/// @param apply Function which filters an Audio Buffer in place
+template <typename Filter>
+void benchmarkFilter(benchmark::State &state, Filter apply) {
+    auto samples = bench::syntheticSpeech(kNFilterSamples);
+    auto buffer = AudioBuffer(samples, 8000, 25.0f);
+
+    // Each iteration filters a fresh copy of the input, lest repeated
+    // filtering decay the signal into denormal territory
+    for (auto _ : state) {
+        state.PauseTiming();
+        buffer.setSamples(samples);
+        state.ResumeTiming();
+
+        apply(buffer);
+        benchmark::DoNotOptimize(buffer.getData());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kNFilterSamples);
+}
+
+static void BM_HighpassFilter(benchmark::State &state) {
+    auto filter = AudioFilter();
+
+    benchmarkFilter(state, [&filter](AudioBuffer &buffer) {
+        filter.applyHighpass(buffer, 1000);
+    });
+}
+
+static void BM_LowpassFilter(benchmark::State &state) {
+    auto filter = AudioFilter();
+
+    benchmarkFilter(state, [&filter](AudioBuffer &buffer) {
+        filter.applyLowpass(buffer, 800);
+    });
+}
+
+static void BM_PreEmphasisFilter(benchmark::State &state) {
+    auto filter = AudioFilter();
+
+    benchmarkFilter(state, [&filter](AudioBuffer &buffer) {
+        filter.applyPreEmphasis(buffer, -0.9375f);
+    });
+}
+
+static void BM_HammingWindow(benchmark::State &state) {
+    auto filter = AudioFilter();
+
+    benchmarkFilter(state, [&filter](AudioBuffer &buffer) {
+        filter.applyHammingWindow(buffer);
+    });
+}
+
+BENCHMARK(BM_HighpassFilter);
+BENCHMARK(BM_LowpassFilter);
+BENCHMARK(BM_PreEmphasisFilter);
+BENCHMARK(BM_HammingWindow);
+
+};  // namespace tms_express
@@ -0,0 +1,66 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+#include "audio/AudioBuffer.hpp"
+#include "bench/SyntheticSignals.hpp"
+#include "bitstream/BitstreamGenerator.hpp"
+#include "bitstream/FrameAnalyzer.hpp"
+
+namespace tms_express {
+
+/// @brief Writes synthetic speech to a temporary WAV file
+/// @param n_seconds Duration of speech, in seconds
+/// @return Path to WAV file
+std::string syntheticSpeechFile(int n_seconds) {
+    auto path = (std::filesystem::temp_directory_path() /
+        ("tmsexpress-bench-" + std::to_string(n_seconds) + "s.wav")).string();
+
+    auto buffer = AudioBuffer(bench::syntheticSpeech(n_seconds * 8000), 8000,
+        25.0f);
+
+    buffer.render(path);
+    return path;
+}
+
+/// @brief Benchmarks a complete encode, from WAV file to ASCII bitstream, with
+///         the default settings of the command-line interface
+/// @param state Benchmark state, whose first argument is the duration of the
+///                 input in seconds and whose second argument is the pitch
+///                 algorithm
+static void BM_BitstreamGenerator(benchmark::State &state) {
+    auto n_seconds = static_cast<int>(state.range(0));
+    auto input_path = syntheticSpeechFile(n_seconds);
+    auto output_path = (std::filesystem::temp_directory_path() /
+        "tmsexpress-bench.lpc").string();
+
+    auto generator = BitstreamGenerator(25.0f, 1000, 800, -0.9375f,
+        BitstreamGenerator::ENCODERSTYLE_ASCII, true, 2, 37.5f, 30.0f, false,
+        500, 50);
+
+    generator.setPitchAlgorithm(
+        static_cast<BitstreamGenerator::PitchAlgorithm>(state.range(1)));
+
+    for (auto _ : state) {
+        generator.encode(input_path, "bench", output_path);
+    }
+
+    // Throughput is reported in seconds of audio encoded per second, such
+    // that a value above one is faster than real time
+    state.counters["realtime_factor"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * n_seconds),
+        benchmark::Counter::kIsRate);
+
+    std::filesystem::remove(input_path);
+    std::filesystem::remove(output_path);
+}
+
+BENCHMARK(BM_BitstreamGenerator)
+    ->ArgsProduct({{1, 10}, {FrameAnalyzer::PITCHALGORITHM_ACF,
+        FrameAnalyzer::PITCHALGORITHM_YIN}})
+    ->Unit(benchmark::kMillisecond);
+
+};  // namespace tms_express
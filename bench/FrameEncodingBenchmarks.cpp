@@ -0,0 +1,90 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "bench/SyntheticSignals.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/FrameEncoder.hpp"
+#include "encoding/Synthesizer.hpp"
+
+namespace tms_express {
+
+/// @brief Number of Frames encoded per iteration (10 s at 25 ms per Frame)
+static constexpr int kNFrames = 400;
+
+static void BM_FrameQuantization(benchmark::State &state) {
+    auto frames = bench::syntheticFrames(kNFrames);
+
+    for (auto _ : state) {
+        for (const auto &frame : frames) {
+            auto coeffs = frame.quantizedCoeffs();
+            benchmark::DoNotOptimize(coeffs.data());
+            benchmark::DoNotOptimize(frame.quantizedGain());
+            benchmark::DoNotOptimize(frame.quantizedPitch());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kNFrames);
+}
+
+static void BM_FrameToBinary(benchmark::State &state) {
+    auto frames = bench::syntheticFrames(kNFrames);
+
+    for (auto _ : state) {
+        for (auto &frame : frames) {
+            auto bits = frame.toBinary();
+            benchmark::DoNotOptimize(bits.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kNFrames);
+}
+
+static void BM_FrameEncoderToHex(benchmark::State &state) {
+    auto frames = bench::syntheticFrames(kNFrames);
+
+    for (auto _ : state) {
+        auto encoder = FrameEncoder(frames, true);
+        auto hex = encoder.toHex();
+        benchmark::DoNotOptimize(hex.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kNFrames);
+}
+
+static void BM_FrameEncoderImportASCII(benchmark::State &state) {
+    auto hex = FrameEncoder(bench::syntheticFrames(kNFrames), true).toHex();
+
+    for (auto _ : state) {
+        auto encoder = FrameEncoder();
+        benchmark::DoNotOptimize(encoder.importASCIIFromString(hex));
+    }
+
+    state.SetItemsProcessed(state.iterations() * kNFrames);
+    state.SetBytesProcessed(state.iterations() *
+        static_cast<int64_t>(hex.size()));
+}
+
+static void BM_Synthesizer(benchmark::State &state) {
+    auto frames = bench::syntheticFrames(kNFrames);
+    auto synthesizer = Synthesizer();
+
+    for (auto _ : state) {
+        auto samples = synthesizer.synthesize(frames);
+        benchmark::DoNotOptimize(samples.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kNFrames *
+        synthesizer.getNSamplesPerFrame());
+}
+
+BENCHMARK(BM_FrameQuantization);
+BENCHMARK(BM_FrameToBinary);
+BENCHMARK(BM_FrameEncoderToHex);
+BENCHMARK(BM_FrameEncoderImportASCII);
+BENCHMARK(BM_Synthesizer);
+
+};  // namespace tms_express
@@ -0,0 +1,82 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/LinearPredictor.hpp"
+#include "bench/SyntheticSignals.hpp"
+
+namespace tms_express {
+
+/// @brief Splits one second of synthetic speech into segments
+/// @param segment_size Number of samples in each segment
+/// @return Segments
+std::vector<std::vector<float>> speechSegments(int segment_size) {
+    auto samples = bench::syntheticSpeech(8000);
+    auto segments = std::vector<std::vector<float>>();
+
+    for (int i = 0; i + segment_size <= 8000; i += segment_size) {
+        segments.emplace_back(samples.begin() + i,
+            samples.begin() + i + segment_size);
+    }
+
+    return segments;
+}
+
+static void BM_Autocorrelation(benchmark::State &state) {
+    auto segments = speechSegments(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        for (const auto &segment : segments) {
+            auto acf = Autocorrelation(segment);
+            benchmark::DoNotOptimize(acf.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+        static_cast<int64_t>(segments.size()));
+}
+
+static void BM_TruncatedAutocorrelation(benchmark::State &state) {
+    auto segments = speechSegments(static_cast<int>(state.range(0)));
+
+    // The Linear Predictor consumes only as many lags as its order, plus one
+    for (auto _ : state) {
+        for (const auto &segment : segments) {
+            auto acf = Autocorrelation(segment, 11);
+            benchmark::DoNotOptimize(acf.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+        static_cast<int64_t>(segments.size()));
+}
+
+static void BM_LinearPredictor(benchmark::State &state) {
+    auto order = static_cast<int>(state.range(0));
+    auto acfs = std::vector<std::vector<float>>();
+
+    for (const auto &segment : speechSegments(200)) {
+        acfs.push_back(Autocorrelation(segment, order + 1));
+    }
+
+    auto predictor = LinearPredictor(order);
+
+    for (auto _ : state) {
+        for (const auto &acf : acfs) {
+            auto coeffs = predictor.computeCoeffs(acf);
+            benchmark::DoNotOptimize(coeffs.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+        static_cast<int64_t>(acfs.size()));
+}
+
+BENCHMARK(BM_Autocorrelation)->Arg(200)->Arg(400);
+BENCHMARK(BM_TruncatedAutocorrelation)->Arg(200)->Arg(400);
+BENCHMARK(BM_LinearPredictor)->Arg(10)->Arg(16);
+
+};  // namespace tms_express
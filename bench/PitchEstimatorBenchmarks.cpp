@@ -0,0 +1,147 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/PitchEstimator.hpp"
+#include "analysis/YinPitchEstimator.hpp"
+#include "encoding/CodingTable.hpp"
+
+namespace tms_express {
+
+/// @brief Synthetic voiced segment with known fundamental period
+struct SyntheticTone {
+    float period;
+    std::vector<float> samples;
+};
+
+/// @brief Produces a set of 25 ms harmonic tones sampled at 8 kHz, whose
+///         fractional periods sweep the span of the TMS5220 pitch table
+/// @return Synthetic tones
+std::vector<SyntheticTone> syntheticTones() {
+    auto tones = std::vector<SyntheticTone>();
+    uint32_t noise_state = 1;
+
+    for (float period = 20.25f; period < 150.0f; period *= 1.07f) {
+        auto samples = std::vector<float>(200);
+
+        for (int i = 0; i < static_cast<int>(samples.size()); i++) {
+            float phase = 2.0f * static_cast<float>(M_PI) *
+                static_cast<float>(i) / period;
+
+            // Low-level deterministic noise keeps the estimators honest
+            noise_state = noise_state * 1664525u + 1013904223u;
+            float noise = static_cast<float>(noise_state >> 8) /
+                static_cast<float>(1 << 24) - 0.5f;
+
+            samples[i] = 0.5f * sinf(phase) + 0.3f * sinf(2.0f * phase) +
+                0.15f * sinf(3.0f * phase) + 0.02f * noise;
+        }
+
+        tones.push_back({period, samples});
+    }
+
+    return tones;
+}
+
+/// @brief Finds the TMS5220 pitch table index closest to a period
+/// @param period Pitch period, in samples
+/// @return Index into TMS5220 pitch table
+int pitchTableIndex(float period) {
+    const auto &table = coding_table::tms5220::pitch;
+    int best = 0;
+
+    for (int i = 1; i < static_cast<int>(table.size()); i++) {
+        if (std::fabs(table[i] - period) < std::fabs(table[best] - period)) {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/// @brief Reports estimator accuracy as benchmark counters
+/// @param state Benchmark state
+/// @param tones Synthetic tones
+/// @param periods Estimated period of each tone
+void reportAccuracy(benchmark::State &state,
+    const std::vector<SyntheticTone> &tones,
+    const std::vector<float> &periods) {
+    //
+    float total_error = 0.0f;
+    int index_errors = 0;
+
+    for (int i = 0; i < static_cast<int>(tones.size()); i++) {
+        total_error += std::fabs(periods[i] - tones[i].period);
+        index_errors += (pitchTableIndex(periods[i]) !=
+            pitchTableIndex(tones[i].period));
+    }
+
+    auto n_tones = static_cast<float>(tones.size());
+    state.counters["mean_abs_error"] = total_error / n_tones;
+    state.counters["table_index_errors"] = index_errors;
+    state.counters["tones"] = n_tones;
+}
+
+static void BM_AutocorrelationPitchEstimator(benchmark::State &state) {
+    auto tones = syntheticTones();
+    auto estimator = PitchEstimator(8000);
+    auto periods = std::vector<float>(tones.size());
+
+    for (auto _ : state) {
+        for (int i = 0; i < static_cast<int>(tones.size()); i++) {
+            auto acf = Autocorrelation(tones[i].samples);
+            periods[i] = static_cast<float>(estimator.estimatePeriod(acf));
+        }
+
+        benchmark::DoNotOptimize(periods.data());
+    }
+
+    reportAccuracy(state, tones, periods);
+}
+
+static void BM_DecimatedPitchEstimator(benchmark::State &state) {
+    auto tones = syntheticTones();
+    auto estimator = PitchEstimator(8000);
+    auto periods = std::vector<float>(tones.size());
+    auto factor = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < static_cast<int>(tones.size()); i++) {
+            periods[i] = static_cast<float>(
+                estimator.estimatePeriodDecimated(tones[i].samples, factor));
+        }
+
+        benchmark::DoNotOptimize(periods.data());
+    }
+
+    reportAccuracy(state, tones, periods);
+}
+
+static void BM_YinPitchEstimator(benchmark::State &state) {
+    auto tones = syntheticTones();
+    auto estimator = YinPitchEstimator(8000);
+    auto periods = std::vector<float>(tones.size());
+
+    for (auto _ : state) {
+        for (int i = 0; i < static_cast<int>(tones.size()); i++) {
+            auto acf = Autocorrelation(tones[i].samples);
+            periods[i] = estimator.estimatePeriod(tones[i].samples, acf);
+        }
+
+        benchmark::DoNotOptimize(periods.data());
+    }
+
+    reportAccuracy(state, tones, periods);
+}
+
+BENCHMARK(BM_AutocorrelationPitchEstimator);
+BENCHMARK(BM_DecimatedPitchEstimator)->DenseRange(1, 4);
+BENCHMARK(BM_YinPitchEstimator);
+
+};  // namespace tms_express
@@ -0,0 +1,102 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_BENCH_SYNTHETICSIGNALS_HPP_
+#define TMS_EXPRESS_BENCH_SYNTHETICSIGNALS_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "encoding/Frame.hpp"
+
+namespace tms_express::bench {
+
+/// @brief Produces speech-like audio sampled at 8 kHz, such that benchmarks
+///         require no audio assets
+/// @param n_samples Number of samples
+/// @return Samples which cycle through a voiced vowel with a gliding pitch,
+///         an unvoiced fricative, and silence
+/// @note The signal is deterministic, such that runs are comparable
+inline std::vector<float> syntheticSpeech(int n_samples) {
+    auto samples = std::vector<float>(n_samples);
+    uint32_t noise_state = 1;
+
+    // Two-pole resonators at 700 Hz and 1200 Hz approximate the first two
+    // formants of an open vowel
+    constexpr float kRadius = 0.97f;
+    const float coeff_1 = 2.0f * kRadius * cosf(
+        2.0f * static_cast<float>(M_PI) * 700.0f / 8000.0f);
+    const float coeff_2 = 2.0f * kRadius * cosf(
+        2.0f * static_cast<float>(M_PI) * 1200.0f / 8000.0f);
+
+    float y_1[2] = {0.0f, 0.0f};
+    float y_2[2] = {0.0f, 0.0f};
+    float phase = 0.0f;
+
+    // Each 450 ms cycle holds 300 ms voiced, 100 ms unvoiced, 50 ms silent
+    for (int i = 0; i < n_samples; i++) {
+        auto position = i % 3600;
+
+        noise_state = noise_state * 1664525u + 1013904223u;
+        auto noise = static_cast<float>(noise_state >> 8) /
+            static_cast<float>(1 << 24) - 0.5f;
+
+        auto excitation = 0.0f;
+
+        if (position < 2400) {
+            auto pitch_hz = 100.0f + 80.0f * static_cast<float>(position) /
+                2400.0f;
+
+            phase += pitch_hz / 8000.0f;
+            if (phase >= 1.0f) {
+                phase -= 1.0f;
+                excitation = 1.0f;
+            }
+
+            excitation += 0.01f * noise;
+
+        } else if (position < 3200) {
+            excitation = 0.3f * noise;
+        }
+
+        auto formant_1 = excitation + coeff_1 * y_1[0] -
+            kRadius * kRadius * y_1[1];
+        auto formant_2 = formant_1 + coeff_2 * y_2[0] -
+            kRadius * kRadius * y_2[1];
+
+        y_1[1] = y_1[0];
+        y_1[0] = formant_1;
+        y_2[1] = y_2[0];
+        y_2[0] = formant_2;
+
+        samples[i] = 0.02f * formant_2;
+    }
+
+    return samples;
+}
+
+/// @brief Produces a Frame table which alternates between voiced and
+///         unvoiced runs of Frames with drifting coefficients
+/// @param n_frames Number of Frames
+/// @return Frame table
+inline std::vector<Frame> syntheticFrames(int n_frames) {
+    auto frames = std::vector<Frame>();
+
+    for (int i = 0; i < n_frames; i++) {
+        auto is_voiced = (i / 8) % 3 != 2;
+        auto coeffs = std::vector<float>();
+
+        for (int j = 0; j < 10; j++) {
+            coeffs.push_back(0.4f * sinf(0.3f * static_cast<float>(i + j)));
+        }
+
+        auto pitch = is_voiced ? 40.0f + static_cast<float>(i % 40) : 0.0f;
+        frames.emplace_back(pitch, is_voiced, 56.85f, coeffs);
+    }
+
+    return frames;
+}
+
+};  // namespace tms_express::bench
+
+#endif  // TMS_EXPRESS_BENCH_SYNTHETICSIGNALS_HPP_
@@ -2,25 +2,42 @@
 
 #include "analysis/Autocorrelation.hpp"
 
+#include <algorithm>
 #include <vector>
 
 namespace tms_express {
 
 std::vector<float> Autocorrelation(const std::vector<float> &segment) {
-    auto size = segment.size();
-    auto acf = std::vector<float>(size);
-
-    for (int i = 0; i < static_cast<int>(size); i++) {
-        float sum = 0.0f;
+    return Autocorrelation(segment, static_cast<int>(segment.size()));
+}
 
-        for (int j = 0; j < static_cast<int>(size) - i; j++) {
-            sum += segment[j] * segment[j + i];
-        }
+std::vector<float> Autocorrelation(const std::vector<float> &segment,
+    int n_lags) {
+    //
+    auto size = static_cast<int>(segment.size());
+    auto acf = std::vector<float>(std::max(std::min(n_lags, size), 0));
 
-        acf[i] = (sum / static_cast<float>(size));
+    for (int i = 0; i < static_cast<int>(acf.size()); i++) {
+        acf[i] = AutocorrelationAtLag(segment, i);
     }
 
     return acf;
 }
 
+float AutocorrelationAtLag(const std::vector<float> &segment, int lag) {
+    auto size = static_cast<int>(segment.size());
+
+    if (lag < 0 || lag >= size) {
+        return 0.0f;
+    }
+
+    float sum = 0.0f;
+
+    for (int j = 0; j < size - lag; j++) {
+        sum += segment[j] * segment[j + lag];
+    }
+
+    return (sum / static_cast<float>(size));
+}
+
 };  // namespace tms_express
@@ -13,6 +13,22 @@ namespace tms_express {
 /// @return Biased autocorrelation of segment
 std::vector<float> Autocorrelation(const std::vector<float> &segment);
 
+/// @brief Computes the leading lags of the biased autocorrelation of segment
+///
+/// @param segment Segment from which to compute autocorrelation
+/// @param n_lags Number of lags to compute, starting from lag zero
+/// @return First n_lags elements of the biased autocorrelation of segment
+std::vector<float> Autocorrelation(const std::vector<float> &segment,
+    int n_lags);
+
+/// @brief Computes the biased autocorrelation of segment at a single lag
+///
+/// @param segment Segment from which to compute autocorrelation
+/// @param lag Lag at which to evaluate autocorrelation
+/// @return Biased autocorrelation of segment at lag, or zero if lag is out of
+///         range
+float AutocorrelationAtLag(const std::vector<float> &segment, int lag);
+
 };  // namespace tms_express
 
 #endif  // TMS_EXPRESS_LPC_ANALYSIS_AUTOCORRELATION_HPP_
@@ -0,0 +1,62 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "analysis/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tms_express {
+
+void ParallelFor(int n_tasks, int n_threads,
+    const std::function<void(int)> &task) {
+    //
+    if (n_threads <= 0) {
+        n_threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    n_threads = std::max(1, std::min(n_threads, n_tasks));
+
+    auto next_task = std::atomic<int>(0);
+    auto exception = std::exception_ptr();
+    auto exception_mutex = std::mutex();
+
+    auto worker = [&]() {
+        for (int i = next_task++; i < n_tasks; i = next_task++) {
+            try {
+                task(i);
+
+            } catch (...) {
+                auto lock = std::lock_guard<std::mutex>(exception_mutex);
+
+                if (exception == nullptr) {
+                    exception = std::current_exception();
+                }
+
+                // Abandon the remaining tasks
+                next_task = n_tasks;
+            }
+        }
+    };
+
+    auto threads = std::vector<std::thread>();
+    for (int i = 1; i < n_threads; i++) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    if (exception != nullptr) {
+        std::rethrow_exception(exception);
+    }
+}
+
+};  // namespace tms_express
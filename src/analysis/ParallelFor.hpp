@@ -0,0 +1,25 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_LPC_ANALYSIS_PARALLELFOR_HPP_
+#define TMS_EXPRESS_LPC_ANALYSIS_PARALLELFOR_HPP_
+
+#include <functional>
+
+namespace tms_express {
+
+/// @brief Runs independent tasks on a set of worker threads
+///
+/// @param n_tasks Number of tasks
+/// @param n_threads Number of threads, including the calling thread, or zero
+///                     to use every hardware thread
+/// @param task Function which performs the task at the given index
+/// @throws The first exception thrown by a task, after every worker exits
+/// @note Tasks are claimed dynamically, so tasks of uneven duration balance
+///         across threads. A single thread runs every task in order, without
+///         spawning workers
+void ParallelFor(int n_tasks, int n_threads,
+    const std::function<void(int)> &task);
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_LPC_ANALYSIS_PARALLELFOR_HPP_
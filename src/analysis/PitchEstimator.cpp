@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <vector>
 
+#include "analysis/Autocorrelation.hpp"
+
 namespace tms_express {
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -57,9 +59,15 @@ float PitchEstimator::estimateFrequency(const std::vector<float> &acf) const {
 }
 
 int PitchEstimator::estimatePeriod(const std::vector<float> &acf) const {
-    // Restrict the search window to the min and max pitch periods
-    auto start = acf.begin() + min_period_;
-    auto end = acf.begin()  + max_period_;
+    // Restrict the search window to the min and max pitch periods, and to
+    // the lags of the autocorrelation, such that an inverted or oversized
+    // pitch range cannot search past its end
+    auto n_lags = static_cast<int>(acf.size());
+    auto last = std::max(0, std::min(max_period_, n_lags));
+    auto first = std::max(0, std::min(min_period_, last));
+
+    auto start = acf.begin() + first;
+    auto end = acf.begin() + last;
 
     // Identify the first local minimum and subsequent local maximum.
     // The distance between these values likely corresponds to the pitch period
@@ -76,4 +84,63 @@ int PitchEstimator::estimatePeriod(const std::vector<float> &acf) const {
     }
 }
 
+int PitchEstimator::estimatePeriodDecimated(const std::vector<float> &segment,
+    int decimation_factor) const {
+    //
+    auto factor = std::max(1, std::min(decimation_factor, 4));
+
+    if (factor == 1) {
+        return estimatePeriod(Autocorrelation(segment, max_period_ + 1));
+    }
+
+    // Decimate with a boxcar average, which doubles as a cheap anti-aliasing
+    // filter for the already lowpassed segment
+    auto n_coarse = static_cast<int>(segment.size()) / factor;
+    auto coarse = std::vector<float>(n_coarse);
+
+    for (int i = 0; i < n_coarse; i++) {
+        float sum = 0.0f;
+
+        for (int j = 0; j < factor; j++) {
+            sum += segment[i * factor + j];
+        }
+
+        coarse[i] = sum / static_cast<float>(factor);
+    }
+
+    // Coarse search, with the same semantics as estimatePeriod(), over only
+    // the lags which may contain the pitch period
+    auto coarse_min = min_period_ / factor;
+    auto coarse_max = (max_period_ + factor - 1) / factor;
+    auto coarse_acf = Autocorrelation(coarse, coarse_max + 1);
+
+    if (static_cast<int>(coarse_acf.size()) <= coarse_max ||
+        coarse_min >= coarse_max) {
+        return estimatePeriod(Autocorrelation(segment, max_period_ + 1));
+    }
+
+    auto start = coarse_acf.begin() + coarse_min;
+    auto end = coarse_acf.begin() + coarse_max;
+    auto local_min = std::min_element(start, end);
+    auto coarse_period = static_cast<int>(std::distance(coarse_acf.begin(),
+        std::max_element(local_min, end)));
+
+    // Full-rate refinement within one coarse lag of the winner
+    auto first = std::max(min_period_, (coarse_period - 1) * factor);
+    auto last = std::min(max_period_, (coarse_period + 1) * factor);
+    auto period = first;
+    auto best = AutocorrelationAtLag(segment, first);
+
+    for (int lag = first + 1; lag <= last; lag++) {
+        auto value = AutocorrelationAtLag(segment, lag);
+
+        if (value > best) {
+            best = value;
+            period = lag;
+        }
+    }
+
+    return std::max(min_period_, std::min(period, max_period_));
+}
+
 };  // namespace tms_express
@@ -65,6 +65,18 @@ class PitchEstimator {
     /// @return Estimated pitch period, in samples
     int estimatePeriod(const std::vector<float> &acf) const;
 
+    /// @brief Estimate the period of sample by searching a decimated copy of
+    ///         the segment, then refining at full rate around the winner
+    /// @param segment Lowpass-filtered segment of samples
+    /// @param decimation_factor Decimation factor of the coarse search, from
+    ///                             1 (no decimation) to 4
+    /// @return Estimated pitch period, in samples
+    /// @note Because the search window tops out at 500 Hz, the lowpassed pitch
+    ///         buffer carries little energy above 1 kHz and tolerates
+    ///         decimation of up to 4x at 8 kHz
+    int estimatePeriodDecimated(const std::vector<float> &segment,
+        int decimation_factor) const;
+
  private:
     ///////////////////////////////////////////////////////////////////////////
     // Members ////////////////////////////////////////////////////////////////
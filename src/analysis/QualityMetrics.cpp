@@ -0,0 +1,375 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "analysis/QualityMetrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/ParallelFor.hpp"
+#include "analysis/PitchEstimator.hpp"
+#include "analysis/Spectrum.hpp"
+#include "analysis/VoicingClassifier.hpp"
+
+namespace tms_express {
+
+/// @brief Energy, relative to the loudest frame, below which a frame is
+///         considered silent (-50 dB)
+static constexpr float kActiveEnergyRatio = 1.0e-5f;
+
+/// @brief Bounds of per-frame signal-to-noise ratio, in decibels, which keep
+///         silent or perfectly-matched frames from dominating the mean
+static constexpr float kMinSnrDb = -10.0f;
+static constexpr float kMaxSnrDb = 35.0f;
+
+/// @brief Normalized autocorrelation at the pitch period above which a frame
+///         is considered voiced
+static constexpr float kVoicingPeriodicity = 0.5f;
+
+/// @brief Number of frames scored by each parallel task
+static constexpr int kFramesPerTask = 32;
+
+///////////////////////////////////////////////////////////////////////////////
+// Report /////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::string QualityMetrics::Report::toString() const {
+    char summary[512];
+    snprintf(summary, sizeof(summary),
+        "Alignment lag:          %d samples\n"
+        "Log-spectral distance:  %.2f dB\n"
+        "Segmental SNR:          %.2f dB\n"
+        "Pitch error:            %.1f cents\n"
+        "Voicing error:          %.1f%%\n"
+        "Active frames:          %d of %d\n",
+        lag_samples, log_spectral_distance_db, segmental_snr_db,
+        pitch_error_cents, 100.0f * voicing_error_rate, n_active_frames,
+        static_cast<int>(frames.size()));
+
+    return summary;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+QualityMetrics::QualityMetrics(int sample_rate_hz, float window_width_ms,
+    float max_lag_ms) {
+    //
+    sample_rate_hz_ = sample_rate_hz;
+    n_samples_per_frame_ = std::max(1, static_cast<int>(
+        static_cast<float>(sample_rate_hz) * window_width_ms * 1e-3f));
+    max_lag_ = static_cast<int>(
+        static_cast<float>(sample_rate_hz) * max_lag_ms * 1e-3f);
+    n_threads_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Configuration //////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void QualityMetrics::setThreads(int n_threads) {
+    n_threads_ = n_threads;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Evaluation /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+QualityMetrics::Report QualityMetrics::evaluate(
+    const std::vector<float> &source,
+    const std::vector<float> &synthesized) const {
+    //
+    auto n_samples = static_cast<int>(source.size());
+    auto n_frames = n_samples / n_samples_per_frame_;
+
+    auto report = Report();
+    report.lag_samples = alignmentLag(source, synthesized, max_lag_);
+    report.frames.resize(n_frames);
+
+    auto aligned = align(synthesized, report.lag_samples, n_samples);
+    auto is_active = findActiveFrames(source, n_frames);
+
+    // Scale the resynthesis to the level of the source, as post-processing
+    // normalizes gain independently of the source
+    double cross_energy = 0.0;
+    double aligned_energy = 0.0;
+
+    for (int i = 0; i < n_samples; i++) {
+        cross_energy += source[i] * aligned[i];
+        aligned_energy += aligned[i] * aligned[i];
+    }
+
+    auto scale = (aligned_energy > 0.0) ?
+        static_cast<float>(cross_energy / aligned_energy) : 0.0f;
+
+    // Score each frame independently. Spectra are retained so that the mean
+    // level difference may be removed before computing spectral distances
+    auto spectrum = Spectrum(n_samples_per_frame_);
+    auto n_bins = spectrum.getNBins();
+    auto source_db = std::vector<float>(n_frames * n_bins);
+    auto aligned_db = std::vector<float>(n_frames * n_bins);
+
+    auto n_tasks = (n_frames + kFramesPerTask - 1) / kFramesPerTask;
+
+    ParallelFor(n_tasks, n_threads_, [&](int task) {
+        auto pitch_estimator = PitchEstimator(sample_rate_hz_);
+        auto first = task * kFramesPerTask;
+        auto last = std::min(first + kFramesPerTask, n_frames);
+
+        for (int i = first; i < last; i++) {
+            auto &frame = report.frames[i];
+            frame = FrameReport();
+            frame.is_active = is_active[i];
+
+            if (!frame.is_active) {
+                continue;
+            }
+
+            auto offset = i * n_samples_per_frame_;
+            auto source_segment = std::vector<float>(source.begin() + offset,
+                source.begin() + offset + n_samples_per_frame_);
+            auto aligned_segment = std::vector<float>(aligned.begin() +
+                offset, aligned.begin() + offset + n_samples_per_frame_);
+
+            spectrum.logPowerSpectrum(source_segment.data(),
+                n_samples_per_frame_, &source_db[i * n_bins]);
+            spectrum.logPowerSpectrum(aligned_segment.data(),
+                n_samples_per_frame_, &aligned_db[i * n_bins]);
+
+            float signal_energy = 0.0f;
+            float noise_energy = 0.0f;
+
+            for (int j = 0; j < n_samples_per_frame_; j++) {
+                auto noise = source_segment[j] - scale * aligned_segment[j];
+                signal_energy += source_segment[j] * source_segment[j];
+                noise_energy += noise * noise;
+            }
+
+            auto snr_db = 10.0f * log10f(signal_energy /
+                std::max(noise_energy, 1.0e-12f));
+            frame.snr_db = std::clamp(snr_db, kMinSnrDb, kMaxSnrDb);
+
+            // Pitch and voicing are estimated identically for both signals,
+            // from a single autocorrelation of each
+            auto source_acf = tms_express::Autocorrelation(source_segment);
+            auto aligned_acf = tms_express::Autocorrelation(aligned_segment);
+
+            auto source_lag = pitch_estimator.estimatePeriod(source_acf);
+            auto aligned_lag = pitch_estimator.estimatePeriod(aligned_acf);
+
+            frame.source_pitch_period = static_cast<float>(source_lag);
+            frame.synthesized_pitch_period = static_cast<float>(aligned_lag);
+
+            frame.source_is_voiced = VoicingClassifier::periodicity(
+                source_acf[0], source_acf[source_lag], source_lag,
+                n_samples_per_frame_) >= kVoicingPeriodicity;
+            frame.synthesized_is_voiced = VoicingClassifier::periodicity(
+                aligned_acf[0], aligned_acf[aligned_lag], aligned_lag,
+                n_samples_per_frame_) >= kVoicingPeriodicity;
+        }
+    });
+
+    // Summarize active frames
+    double level_difference = 0.0;
+    int n_active = 0;
+
+    for (int i = 0; i < n_frames; i++) {
+        if (!is_active[i]) {
+            continue;
+        }
+
+        n_active++;
+        for (int k = 0; k < n_bins; k++) {
+            level_difference += aligned_db[i * n_bins + k] -
+                source_db[i * n_bins + k];
+        }
+    }
+
+    report.n_active_frames = n_active;
+
+    if (n_active == 0) {
+        return report;
+    }
+
+    auto offset_db = static_cast<float>(level_difference /
+        static_cast<double>(n_active * n_bins));
+
+    double total_distance = 0.0;
+    double total_snr = 0.0;
+    double total_pitch_error = 0.0;
+    int n_voiced = 0;
+    int n_voicing_errors = 0;
+
+    for (int i = 0; i < n_frames; i++) {
+        auto &frame = report.frames[i];
+
+        if (!frame.is_active) {
+            continue;
+        }
+
+        frame.log_spectral_distance_db = Spectrum::logSpectralDistance(
+            &aligned_db[i * n_bins], &source_db[i * n_bins], n_bins,
+            offset_db);
+
+        total_distance += frame.log_spectral_distance_db;
+        total_snr += frame.snr_db;
+
+        if (frame.source_is_voiced != frame.synthesized_is_voiced) {
+            n_voicing_errors++;
+
+        } else if (frame.source_is_voiced &&
+            frame.source_pitch_period > 0.0f &&
+            frame.synthesized_pitch_period > 0.0f) {
+            //
+            total_pitch_error += std::fabs(1200.0f * log2f(
+                frame.synthesized_pitch_period / frame.source_pitch_period));
+            n_voiced++;
+        }
+    }
+
+    report.log_spectral_distance_db = static_cast<float>(total_distance /
+        n_active);
+    report.segmental_snr_db = static_cast<float>(total_snr / n_active);
+    report.pitch_error_cents = (n_voiced > 0) ?
+        static_cast<float>(total_pitch_error / n_voiced) : 0.0f;
+    report.voicing_error_rate = static_cast<float>(n_voicing_errors) /
+        static_cast<float>(n_active);
+
+    return report;
+}
+
+float QualityMetrics::logSpectralDistance(const std::vector<float> &source,
+    const std::vector<float> &synthesized) const {
+    //
+    auto n_samples = static_cast<int>(source.size());
+    auto n_frames = n_samples / n_samples_per_frame_;
+
+    auto lag = alignmentLag(source, synthesized, max_lag_);
+    auto aligned = align(synthesized, lag, n_samples);
+    auto is_active = findActiveFrames(source, n_frames);
+
+    auto spectrum = Spectrum(n_samples_per_frame_);
+    auto n_bins = spectrum.getNBins();
+    auto source_db = std::vector<float>(n_frames * n_bins);
+    auto aligned_db = std::vector<float>(n_frames * n_bins);
+
+    double level_difference = 0.0;
+    int n_active = 0;
+
+    for (int i = 0; i < n_frames; i++) {
+        if (!is_active[i]) {
+            continue;
+        }
+
+        auto offset = i * n_samples_per_frame_;
+        spectrum.logPowerSpectrum(source.data() + offset,
+            n_samples_per_frame_, &source_db[i * n_bins]);
+        spectrum.logPowerSpectrum(aligned.data() + offset,
+            n_samples_per_frame_, &aligned_db[i * n_bins]);
+
+        for (int k = 0; k < n_bins; k++) {
+            level_difference += aligned_db[i * n_bins + k] -
+                source_db[i * n_bins + k];
+        }
+
+        n_active++;
+    }
+
+    if (n_active == 0) {
+        return 0.0f;
+    }
+
+    auto offset_db = static_cast<float>(level_difference /
+        static_cast<double>(n_active * n_bins));
+
+    double total_distance = 0.0;
+    for (int i = 0; i < n_frames; i++) {
+        if (is_active[i]) {
+            total_distance += Spectrum::logSpectralDistance(
+                &aligned_db[i * n_bins], &source_db[i * n_bins], n_bins,
+                offset_db);
+        }
+    }
+
+    return static_cast<float>(total_distance / n_active);
+}
+
+int QualityMetrics::alignmentLag(const std::vector<float> &source,
+    const std::vector<float> &synthesized, int max_lag) {
+    //
+    auto n_source = static_cast<int>(source.size());
+    auto n_synthesized = static_cast<int>(synthesized.size());
+
+    int best_lag = 0;
+    double best_correlation = 0.0;
+
+    for (int lag = -max_lag; lag <= max_lag; lag++) {
+        // Overlap of source[i] and synthesized[i + lag]
+        auto first = std::max(0, -lag);
+        auto last = std::min(n_source, n_synthesized - lag);
+
+        double correlation = 0.0;
+        for (int i = first; i < last; i++) {
+            correlation += source[i] * synthesized[i + lag];
+        }
+
+        if (correlation > best_correlation) {
+            best_correlation = correlation;
+            best_lag = lag;
+        }
+    }
+
+    return best_lag;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::vector<float> QualityMetrics::align(
+    const std::vector<float> &synthesized, int lag, int n_samples) {
+    //
+    auto aligned = std::vector<float>(n_samples, 0.0f);
+    auto n_synthesized = static_cast<int>(synthesized.size());
+
+    for (int i = std::max(0, -lag); i < n_samples && i + lag < n_synthesized;
+        i++) {
+        //
+        aligned[i] = synthesized[i + lag];
+    }
+
+    return aligned;
+}
+
+std::vector<bool> QualityMetrics::findActiveFrames(
+    const std::vector<float> &source, int n_frames) const {
+    //
+    auto energies = std::vector<float>(n_frames);
+    float peak_energy = 0.0f;
+
+    for (int i = 0; i < n_frames; i++) {
+        auto segment = source.data() + i * n_samples_per_frame_;
+        float energy = 0.0f;
+
+        for (int j = 0; j < n_samples_per_frame_; j++) {
+            energy += segment[j] * segment[j];
+        }
+
+        energies[i] = energy;
+        peak_energy = std::max(peak_energy, energy);
+    }
+
+    auto is_active = std::vector<bool>(n_frames);
+    for (int i = 0; i < n_frames; i++) {
+        is_active[i] = energies[i] > 0.0f &&
+            energies[i] >= peak_energy * kActiveEnergyRatio;
+    }
+
+    return is_active;
+}
+
+};  // namespace tms_express
@@ -0,0 +1,168 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_LPC_ANALYSIS_QUALITYMETRICS_HPP_
+#define TMS_EXPRESS_LPC_ANALYSIS_QUALITYMETRICS_HPP_
+
+#include <string>
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Objectively compares source audio to its resynthesis
+/// @details The resynthesis is first time-aligned to the source by
+///             cross-correlation. Both signals are then segmented into frames
+///             of the analysis window width, and each frame is scored by its
+///             log-spectral distance, signal-to-noise ratio, and pitch and
+///             voicing agreement. Silent source frames are excluded from all
+///             summary statistics
+class QualityMetrics {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Types //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Metrics of a single frame
+    struct FrameReport {
+        /// @brief true if the source frame is not silent, false otherwise
+        bool is_active;
+
+        /// @brief Log-spectral distance, after removing the mean level
+        ///         difference of the signals, in decibels
+        float log_spectral_distance_db;
+
+        /// @brief Signal-to-noise ratio, after scaling the resynthesis to the
+        ///         level of the source, in decibels
+        float snr_db;
+
+        /// @brief Pitch period of the source frame, in samples
+        float source_pitch_period;
+
+        /// @brief Pitch period of the resynthesized frame, in samples
+        float synthesized_pitch_period;
+
+        /// @brief true if the source frame is voiced, false otherwise
+        bool source_is_voiced;
+
+        /// @brief true if the resynthesized frame is voiced, false otherwise
+        bool synthesized_is_voiced;
+    };
+
+    /// @brief Metrics of an entire signal
+    struct Report {
+        /// @brief Delay of the resynthesis relative to the source, in samples
+        int lag_samples;
+
+        /// @brief Mean log-spectral distance of active frames, in decibels
+        float log_spectral_distance_db;
+
+        /// @brief Mean signal-to-noise ratio of active frames, in decibels
+        float segmental_snr_db;
+
+        /// @brief Mean absolute pitch error of frames which are voiced in both
+        ///         signals, in cents
+        float pitch_error_cents;
+
+        /// @brief Fraction of active frames whose voicing differs
+        float voicing_error_rate;
+
+        /// @brief Number of active frames
+        int n_active_frames;
+
+        /// @brief Metrics of each frame
+        std::vector<FrameReport> frames;
+
+        /// @brief Summarizes report as human-readable text
+        /// @return Summary, with one metric per line
+        std::string toString() const;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Quality Metrics engine
+    /// @param sample_rate_hz Sample rate of both signals, in Hertz
+    /// @param window_width_ms Frame width, in milliseconds
+    /// @param max_lag_ms Max delay of the resynthesis relative to the source,
+    ///                     in milliseconds
+    explicit QualityMetrics(int sample_rate_hz = 8000,
+        float window_width_ms = 25.0f, float max_lag_ms = 10.0f);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration //////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sets the number of threads across which frames are scored
+    /// @param n_threads Number of threads, or zero to use every hardware
+    ///                     thread
+    void setThreads(int n_threads);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Evaluation /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes every metric
+    /// @param source Source samples
+    /// @param synthesized Resynthesized samples
+    /// @return Quality report
+    Report evaluate(const std::vector<float> &source,
+        const std::vector<float> &synthesized) const;
+
+    /// @brief Computes only the mean log-spectral distance of active frames,
+    ///         which is considerably cheaper than a full evaluation
+    /// @param source Source samples
+    /// @param synthesized Resynthesized samples
+    /// @return Mean log-spectral distance, in decibels
+    float logSpectralDistance(const std::vector<float> &source,
+        const std::vector<float> &synthesized) const;
+
+    /// @brief Finds the delay which best aligns the resynthesis to the source
+    /// @param source Source samples
+    /// @param synthesized Resynthesized samples
+    /// @param max_lag Max delay, in samples, in either direction
+    /// @return Delay of resynthesis, in samples, which maximizes the
+    ///         cross-correlation of the signals
+    static int alignmentLag(const std::vector<float> &source,
+        const std::vector<float> &synthesized, int max_lag);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Delays resynthesis to align with source, truncating or
+    ///         zero-padding it to the length of the source
+    /// @param synthesized Resynthesized samples
+    /// @param lag Delay of resynthesis, in samples
+    /// @param n_samples Length of source
+    /// @return Aligned resynthesis
+    static std::vector<float> align(const std::vector<float> &synthesized,
+        int lag, int n_samples);
+
+    /// @brief Determines which source frames are not silent
+    /// @param source Source samples
+    /// @param n_frames Number of frames
+    /// @return true for each active frame, false for each silent frame
+    std::vector<bool> findActiveFrames(const std::vector<float> &source,
+        int n_frames) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sample rate of both signals, in Hertz
+    int sample_rate_hz_;
+
+    /// @brief Number of samples in each frame
+    int n_samples_per_frame_;
+
+    /// @brief Max delay of the resynthesis relative to the source, in samples
+    int max_lag_;
+
+    /// @brief Number of threads across which frames are scored
+    int n_threads_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_LPC_ANALYSIS_QUALITYMETRICS_HPP_
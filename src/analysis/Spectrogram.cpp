@@ -0,0 +1,187 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "analysis/Spectrogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "analysis/Spectrum.hpp"
+
+namespace tms_express {
+
+/// @brief Floor applied to normalized power before conversion to decibels
+///         (-100 dB)
+static constexpr float kPowerFloor = 1.0e-10f;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+Spectrogram::Spectrogram(int segment_size, int hop_size, int tile_width):
+    spectrum_(segment_size) {
+    //
+    segment_size_ = segment_size;
+    hop_size_ = std::max(hop_size, 1);
+    tile_width_ = std::max(tile_width, 1);
+    samples_ = {};
+    tiles_ = {};
+    n_tile_computations_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Spectrogram::setSamples(std::vector<float> samples) {
+    auto n_old_samples = static_cast<int>(samples_.size());
+    auto n_old_columns = getNColumns();
+
+    auto n_new_samples = static_cast<int>(samples.size());
+    auto n_new_columns = (n_new_samples + hop_size_ - 1) / hop_size_;
+    auto n_new_tiles = (n_new_columns + tile_width_ - 1) / tile_width_;
+
+    auto tiles = std::vector<std::vector<float>>(n_new_tiles);
+
+    // A tile survives if it spans the same columns of the same samples, which
+    // costs one comparison per sample rather than one transform per column
+    for (int t = 0; t < std::min(n_new_tiles, getNTiles()); t++) {
+        if (tiles_[t].empty()) {
+            continue;
+        }
+
+        int old_begin, old_end, new_begin, new_end;
+        tileSpan(t, n_old_samples, n_old_columns, &old_begin, &old_end);
+        tileSpan(t, n_new_samples, n_new_columns, &new_begin, &new_end);
+
+        auto n_old_tile_columns = std::min(tile_width_,
+            n_old_columns - t * tile_width_);
+
+        auto n_new_tile_columns = std::min(tile_width_,
+            n_new_columns - t * tile_width_);
+
+        if (n_old_tile_columns != n_new_tile_columns || old_end != new_end ||
+            !std::equal(samples.begin() + new_begin,
+                samples.begin() + new_end, samples_.begin() + old_begin)) {
+            //
+            continue;
+        }
+
+        tiles[t] = std::move(tiles_[t]);
+    }
+
+    samples_ = std::move(samples);
+    tiles_ = std::move(tiles);
+}
+
+int Spectrogram::getNColumns() const {
+    return (static_cast<int>(samples_.size()) + hop_size_ - 1) / hop_size_;
+}
+
+int Spectrogram::getNBins() const {
+    return spectrum_.getNBins();
+}
+
+int Spectrogram::getNTiles() const {
+    return static_cast<int>(tiles_.size());
+}
+
+int Spectrogram::getTileWidth() const {
+    return tile_width_;
+}
+
+int Spectrogram::getHopSize() const {
+    return hop_size_;
+}
+
+int Spectrogram::getNTileComputations() const {
+    return n_tile_computations_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Tiles //////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool Spectrogram::isTileCached(int tile) const {
+    return !tiles_.at(tile).empty();
+}
+
+const std::vector<float> &Spectrogram::getTile(int tile) {
+    if (!isTileCached(tile)) {
+        computeTile(tile);
+    }
+
+    return tiles_[tile];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Static Utilities ///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::vector<int> Spectrogram::findPeaks(const float *power_db, int n_bins) {
+    auto peaks = std::vector<int>();
+
+    for (int k = 1; k < n_bins - 1; k++) {
+        if (power_db[k] > power_db[k - 1] && power_db[k] >= power_db[k + 1]) {
+            peaks.push_back(k);
+        }
+    }
+
+    return peaks;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Spectrogram::tileSpan(int tile, int n_samples, int n_columns, int *begin,
+    int *end) const {
+    //
+    auto first_column = tile * tile_width_;
+    auto last_column = std::min(first_column + tile_width_, n_columns) - 1;
+
+    *begin = first_column * hop_size_;
+    *end = std::min(last_column * hop_size_ + segment_size_, n_samples);
+}
+
+void Spectrogram::computeTile(int tile) {
+    auto n_bins = getNBins();
+    auto n_columns = getNColumns();
+    auto n_samples = static_cast<int>(samples_.size());
+
+    auto first_column = tile * tile_width_;
+    auto n_tile_columns = std::min(tile_width_, n_columns - first_column);
+
+    // A full-scale sinusoid centered on a bin has a Hann-windowed power of
+    // (N / 4)^2, which is taken as 0 dB
+    auto reference = static_cast<float>(segment_size_) *
+        static_cast<float>(segment_size_) / 16.0f;
+
+    // Segments which overrun the signal are zero-padded, rather than
+    // shortened, such that every column shares the same window and scale
+    auto segment = std::vector<float>(segment_size_);
+    auto values = std::vector<float>(n_tile_columns * n_bins);
+
+    for (int c = 0; c < n_tile_columns; c++) {
+        auto start = (first_column + c) * hop_size_;
+        auto n_valid = std::min(segment_size_, n_samples - start);
+
+        std::fill(segment.begin(), segment.end(), 0.0f);
+        std::copy(samples_.begin() + start,
+            samples_.begin() + start + n_valid, segment.begin());
+
+        auto column = values.data() + c * n_bins;
+        spectrum_.powerSpectrum(segment.data(), segment_size_, column);
+
+        for (int k = 0; k < n_bins; k++) {
+            column[k] = 10.0f * log10f(std::max(column[k] / reference,
+                kPowerFloor));
+        }
+    }
+
+    tiles_[tile] = std::move(values);
+    n_tile_computations_++;
+}
+
+};  // namespace tms_express
@@ -0,0 +1,141 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_LPC_ANALYSIS_SPECTROGRAM_HPP_
+#define TMS_EXPRESS_LPC_ANALYSIS_SPECTROGRAM_HPP_
+
+#include <vector>
+
+#include "analysis/Spectrum.hpp"
+
+namespace tms_express {
+
+/// @brief Computes a short-time Fourier transform in tiles, each of which is
+///         cached until the samples it spans are changed
+/// @details Column c of the spectrogram is the power spectrum of the segment
+///             starting at sample c * hop_size, and tile t holds columns
+///             [t * tile_width, (t + 1) * tile_width). Tiles are computed on
+///             demand, such that a caller may display the first tiles of a
+///             long signal before the last are ready, and replacing the
+///             samples discards only those tiles whose samples differ
+class Spectrogram {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new, empty Spectrogram
+    /// @param segment_size Number of samples in each analyzed segment, which
+    ///                     should be a power of two
+    /// @param hop_size Number of samples between consecutive segments
+    /// @param tile_width Number of columns in each tile
+    explicit Spectrogram(int segment_size = 256, int hop_size = 64,
+        int tile_width = 256);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Replaces the analyzed samples
+    /// @param samples New samples, which are moved into the Spectrogram
+    /// @note Cached tiles remain valid if the samples they span, and their
+    ///         number of columns, are unchanged
+    void setSamples(std::vector<float> samples);
+
+    /// @brief Accesses the number of columns (segments)
+    /// @return Number of columns, one per hop
+    int getNColumns() const;
+
+    /// @brief Accesses the number of frequency bins in each column
+    /// @return Bins from DC to Nyquist, inclusive
+    int getNBins() const;
+
+    /// @brief Accesses the number of tiles
+    /// @return Number of tiles, the last of which may be narrower than the
+    ///         rest
+    int getNTiles() const;
+
+    /// @brief Accesses the number of columns in each full tile
+    /// @return Tile width, in columns
+    int getTileWidth() const;
+
+    /// @brief Accesses the number of samples between consecutive columns
+    /// @return Hop size, in samples
+    int getHopSize() const;
+
+    /// @brief Accesses the number of tiles computed since initialization
+    /// @return Number of tile computations, which does not count cache hits
+    int getNTileComputations() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Tiles //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Checks whether a tile is cached
+    /// @param tile Tile index
+    /// @return true if the tile may be accessed without computation
+    bool isTileCached(int tile) const;
+
+    /// @brief Accesses a tile, computing it if it is not cached
+    /// @param tile Tile index
+    /// @return Column-major power values, getNBins() per column, in decibels
+    ///         relative to a full-scale sinusoid
+    const std::vector<float> &getTile(int tile);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Static Utilities ///////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Finds the local maxima of a spectrum, such as the formants of
+    ///         an LPC envelope
+    /// @param power_db Power spectrum, in decibels
+    /// @param n_bins Number of bins in spectrum
+    /// @return Indices of bins which exceed both of their neighbors
+    static std::vector<int> findPeaks(const float *power_db, int n_bins);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes the range of samples spanned by a tile
+    /// @param tile Tile index
+    /// @param n_samples Number of samples in the analyzed signal
+    /// @param n_columns Number of columns in the analyzed signal
+    /// @param begin Destination of the index of the first sample
+    /// @param end Destination of the index past the last sample
+    void tileSpan(int tile, int n_samples, int n_columns, int *begin,
+        int *end) const;
+
+    /// @brief Computes a tile
+    /// @param tile Tile index
+    void computeTile(int tile);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Transform of each segment
+    Spectrum spectrum_;
+
+    /// @brief Number of samples in each segment
+    int segment_size_;
+
+    /// @brief Number of samples between consecutive segments
+    int hop_size_;
+
+    /// @brief Number of columns in each full tile
+    int tile_width_;
+
+    /// @brief Analyzed samples
+    std::vector<float> samples_;
+
+    /// @brief Cached tiles, each of which is empty until computed
+    std::vector<std::vector<float>> tiles_;
+
+    /// @brief Number of tiles computed since initialization
+    int n_tile_computations_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_LPC_ANALYSIS_SPECTROGRAM_HPP_
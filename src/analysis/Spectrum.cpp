@@ -0,0 +1,203 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "analysis/Spectrum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Floor applied to power before conversion to decibels (-100 dB)
+static constexpr float kPowerFloor = 1.0e-10f;
+
+/// @brief Dynamic range of log power spectra, relative to their peak (80 dB),
+///         such that scaling a signal offsets every bin of its spectrum
+///         equally
+static constexpr float kDynamicRange = 1.0e-8f;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+Spectrum::Spectrum(int segment_size) {
+    size_ = 2;
+    while (size_ < segment_size) {
+        size_ *= 2;
+    }
+
+    int n_bits = 0;
+    while ((1 << n_bits) < size_) {
+        n_bits++;
+    }
+
+    bit_reversal_.resize(size_);
+    for (int i = 0; i < size_; i++) {
+        int reversed = 0;
+
+        for (int bit = 0; bit < n_bits; bit++) {
+            reversed |= ((i >> bit) & 1) << (n_bits - 1 - bit);
+        }
+
+        bit_reversal_[i] = reversed;
+    }
+
+    twiddles_.resize(size_ / 2);
+    for (int k = 0; k < size_ / 2; k++) {
+        auto theta = -2.0 * M_PI * static_cast<double>(k) /
+            static_cast<double>(size_);
+
+        twiddles_[k] = {static_cast<float>(cos(theta)),
+            static_cast<float>(sin(theta))};
+    }
+
+    window_ = hannWindow(std::max(segment_size, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int Spectrum::getSize() const {
+    return size_;
+}
+
+int Spectrum::getNBins() const {
+    return size_ / 2 + 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Transforms /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Spectrum::transform(std::complex<float> *data) const {
+    for (int i = 0; i < size_; i++) {
+        if (i < bit_reversal_[i]) {
+            std::swap(data[i], data[bit_reversal_[i]]);
+        }
+    }
+
+    // Iterative Cooley-Tukey butterflies, where the twiddle stride halves as
+    // the span of each butterfly doubles
+    for (int span = 2; span <= size_; span *= 2) {
+        int half = span / 2;
+        int stride = size_ / span;
+
+        for (int start = 0; start < size_; start += span) {
+            for (int k = 0; k < half; k++) {
+                auto odd = twiddles_[k * stride] * data[start + k + half];
+                data[start + k + half] = data[start + k] - odd;
+                data[start + k] += odd;
+            }
+        }
+    }
+}
+
+void Spectrum::powerSpectrum(const float *samples, int n_samples,
+    float *power) const {
+    //
+    auto data = std::vector<std::complex<float>>(size_);
+    auto n_windowed = std::min(n_samples, size_);
+
+    // The window spans the segment, rather than the transform, such that
+    // zero-padded segments are tapered at both ends. Segments of unexpected
+    // size require a window of their own
+    auto custom_window = std::vector<float>();
+    auto window = window_.data();
+
+    if (n_windowed != static_cast<int>(window_.size())) {
+        custom_window = hannWindow(n_windowed);
+        window = custom_window.data();
+    }
+
+    for (int i = 0; i < n_windowed; i++) {
+        data[i] = {samples[i] * window[i], 0.0f};
+    }
+
+    transform(data.data());
+
+    for (int k = 0; k < getNBins(); k++) {
+        power[k] = std::norm(data[k]);
+    }
+}
+
+void Spectrum::logPowerSpectrum(const float *samples, int n_samples,
+    float *power_db) const {
+    //
+    powerSpectrum(samples, n_samples, power_db);
+
+    auto n_bins = getNBins();
+    auto peak = *std::max_element(power_db, power_db + n_bins);
+    auto floor = std::max(peak * kDynamicRange, kPowerFloor);
+
+    for (int k = 0; k < n_bins; k++) {
+        power_db[k] = 10.0f * log10f(std::max(power_db[k], floor));
+    }
+}
+
+void Spectrum::lpcEnvelope(const std::vector<float> &reflectors,
+    float *envelope_db) const {
+    //
+    // Step-up recursion from reflectors to the predictor polynomial
+    // A(z) = 1 + a1 z^-1 + ... + ap z^-p, mirroring the Levinson-Durbin
+    // recursion of the Linear Predictor
+    auto order = std::min(static_cast<int>(reflectors.size()), size_ - 1);
+    auto predictor = std::vector<float>(order + 1, 0.0f);
+    auto previous = std::vector<float>(order + 1, 0.0f);
+    predictor[0] = 1.0f;
+
+    for (int m = 1; m <= order; m++) {
+        previous = predictor;
+
+        for (int i = 1; i < m; i++) {
+            predictor[i] = previous[i] + reflectors[m - 1] * previous[m - i];
+        }
+
+        predictor[m] = reflectors[m - 1];
+    }
+
+    auto data = std::vector<std::complex<float>>(size_);
+    for (int i = 0; i <= order; i++) {
+        data[i] = {predictor[i], 0.0f};
+    }
+
+    transform(data.data());
+
+    // The model's response is the reciprocal of the polynomial's
+    for (int k = 0; k < getNBins(); k++) {
+        envelope_db[k] = -10.0f * log10f(std::max(std::norm(data[k]),
+            kPowerFloor));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Static Utilities ///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::vector<float> Spectrum::hannWindow(int n_samples) {
+    auto window = std::vector<float>(n_samples);
+
+    for (int i = 0; i < n_samples; i++) {
+        window[i] = 0.5f - 0.5f * cosf(2.0f * static_cast<float>(M_PI) *
+            static_cast<float>(i) / static_cast<float>(n_samples));
+    }
+
+    return window;
+}
+
+float Spectrum::logSpectralDistance(const float *a_db, const float *b_db,
+    int n_bins, float offset_db) {
+    //
+    float sum = 0.0f;
+
+    for (int k = 0; k < n_bins; k++) {
+        auto difference = a_db[k] - offset_db - b_db[k];
+        sum += difference * difference;
+    }
+
+    return sqrtf(sum / static_cast<float>(n_bins));
+}
+
+};  // namespace tms_express
@@ -0,0 +1,119 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_LPC_ANALYSIS_SPECTRUM_HPP_
+#define TMS_EXPRESS_LPC_ANALYSIS_SPECTRUM_HPP_
+
+#include <complex>
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Computes power spectra via an iterative radix-2 FFT
+/// @details Twiddle factors, the bit-reversal permutation, and the analysis
+///             window are computed once at initialization, such that a single
+///             instance may be shared by any number of threads
+class Spectrum {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Spectrum analyzer
+    /// @param segment_size Number of samples in each analyzed segment, which
+    ///                     is rounded up to a power of two to determine the
+    ///                     transform size
+    explicit Spectrum(int segment_size = 200);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the transform size
+    /// @return Transform size, in samples
+    int getSize() const;
+
+    /// @brief Accesses the number of frequency bins in a power spectrum
+    /// @return Bins from DC to Nyquist, inclusive
+    int getNBins() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Transforms /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes the forward FFT in place
+    /// @param data getSize() complex values
+    void transform(std::complex<float> *data) const;
+
+    /// @brief Computes the Hann-windowed power spectrum of a segment
+    /// @param samples Segment of samples, which is truncated or zero-padded to
+    ///                 the transform size after windowing
+    /// @param n_samples Number of samples in segment
+    /// @param power Destination of getNBins() power values
+    void powerSpectrum(const float *samples, int n_samples, float *power)
+        const;
+
+    /// @brief Computes the Hann-windowed power spectrum of a segment, in
+    ///         decibels
+    /// @param samples Segment of samples, which is truncated or zero-padded to
+    ///                 the transform size after windowing
+    /// @param n_samples Number of samples in segment
+    /// @param power_db Destination of getNBins() power values, in decibels
+    /// @note Power is floored at 80 dB below the peak of the spectrum, and at
+    ///         -100 dB, such that silence is finite
+    void logPowerSpectrum(const float *samples, int n_samples,
+        float *power_db) const;
+
+    /// @brief Computes the spectral envelope of an all-pole (LPC) model
+    /// @param reflectors Reflector coefficients of the model, as produced by
+    ///                     the Linear Predictor
+    /// @param envelope_db Destination of getNBins() values of the model's
+    ///                     power response, in decibels
+    /// @note The envelope excludes the model's gain, such that a flat model
+    ///         has a response of 0 dB
+    void lpcEnvelope(const std::vector<float> &reflectors,
+        float *envelope_db) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Static Utilities ///////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes the log-spectral distance between two spectra
+    /// @param a_db First power spectrum, in decibels
+    /// @param b_db Second power spectrum, in decibels
+    /// @param n_bins Number of bins in each spectrum
+    /// @param offset_db Level difference to remove from the first spectrum
+    ///                     before comparison, in decibels
+    /// @return Root-mean-square difference of spectra, in decibels
+    static float logSpectralDistance(const float *a_db, const float *b_db,
+        int n_bins, float offset_db = 0.0f);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Static Helpers /////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes a periodic Hann window
+    /// @param n_samples Window length
+    /// @return Window coefficients
+    static std::vector<float> hannWindow(int n_samples);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Transform size, in samples
+    int size_;
+
+    /// @brief Index of each element after bit-reversal permutation
+    std::vector<int> bit_reversal_;
+
+    /// @brief First half of the roots of unity, exp(-2 pi i k / size)
+    std::vector<std::complex<float>> twiddles_;
+
+    /// @brief Hann window, spanning the segment size
+    std::vector<float> window_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_LPC_ANALYSIS_SPECTRUM_HPP_
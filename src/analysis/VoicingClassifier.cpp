@@ -0,0 +1,179 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "analysis/VoicingClassifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+
+namespace tms_express {
+
+/// @brief Voicing score above which a segment is considered voiced, absent
+///         hysteresis
+static constexpr float kVoicingThreshold = 0.5f;
+
+/// @brief Energy, in decibels below the peak, at which the energy feature
+///         bottoms out
+static constexpr float kEnergyFloorDb = 40.0f;
+
+/// @brief Weights of the periodicity, energy, zero-crossing, and reflector
+///         coefficient features, which sum to one
+static constexpr float kPeriodicityWeight = 0.4f;
+static constexpr float kEnergyWeight = 0.2f;
+static constexpr float kZeroCrossingWeight = 0.2f;
+static constexpr float kReflectorWeight = 0.2f;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+VoicingClassifier::VoicingClassifier(float hysteresis) {
+    hysteresis_ = hysteresis;
+    reset();
+}
+
+void VoicingClassifier::reset(float peak_energy) {
+    peak_energy_ = peak_energy;
+    was_voiced_ = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+float VoicingClassifier::getHysteresis() const {
+    return hysteresis_;
+}
+
+void VoicingClassifier::setHysteresis(float hysteresis) {
+    hysteresis_ = hysteresis;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Classification /////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool VoicingClassifier::classify(const std::vector<float> &pitch_segment,
+    const std::vector<float> &pitch_acf, float pitch_period,
+    const std::vector<float> &lpc_segment, float k1) {
+    //
+    auto lag = static_cast<int>(std::lround(pitch_period));
+    auto n_acf = static_cast<int>(pitch_acf.size());
+
+    // Voiced speech is concentrated in the band retained by the pitch
+    // filter, whereas pre-emphasis in the LPC path would inflate the energy
+    // of fricatives. The biased autocorrelation at lag zero is the
+    // mean-square energy
+    auto segment_energy = (n_acf > 0) ? pitch_acf[0] :
+        AutocorrelationAtLag(pitch_segment, 0);
+    auto correlation = (lag >= 0 && lag < n_acf) ? pitch_acf[lag] :
+        AutocorrelationAtLag(pitch_segment, lag);
+
+    return classify(segment_energy, zeroCrossingRate(lpc_segment),
+        periodicity(segment_energy, correlation, lag,
+            static_cast<int>(pitch_segment.size())), k1);
+}
+
+bool VoicingClassifier::classify(float energy, float zero_crossing_rate,
+    float periodicity, float k1) {
+    //
+    peak_energy_ = std::max(peak_energy_, energy);
+    return classify(score(energy, zero_crossing_rate, periodicity, k1));
+}
+
+bool VoicingClassifier::classify(float score) {
+    // Favor the previous decision by moving the threshold away from it
+    auto threshold = was_voiced_ ?
+        kVoicingThreshold - hysteresis_ : kVoicingThreshold + hysteresis_;
+
+    was_voiced_ = score > threshold;
+    return was_voiced_;
+}
+
+float VoicingClassifier::score(float energy, float zero_crossing_rate,
+    float periodicity, float k1) const {
+    //
+    if (energy <= 0.0f) {
+        return 0.0f;
+    }
+
+    // Quiet segments are unlikely to be voiced
+    auto peak = std::max(peak_energy_, energy);
+    auto energy_db = 10.0f * std::log10(energy / peak);
+    auto energy_score = 1.0f + energy_db / kEnergyFloorDb;
+
+    // Noise-like segments cross zero on roughly half of all samples
+    auto zero_crossing_score = 1.0f - 2.0f * zero_crossing_rate;
+
+    // A negative first reflector coefficient indicates a spectral tilt toward
+    // low frequencies, which is characteristic of voiced speech
+    auto reflector_score = 0.5f - 0.5f * k1;
+
+    auto clamp = [](float x) { return std::max(0.0f, std::min(x, 1.0f)); };
+
+    return kPeriodicityWeight * clamp(periodicity) +
+        kEnergyWeight * clamp(energy_score) +
+        kZeroCrossingWeight * clamp(zero_crossing_score) +
+        kReflectorWeight * clamp(reflector_score);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Features ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+float VoicingClassifier::peakEnergy(const float *samples, int n_samples,
+    int segment_size) {
+    //
+    float peak = 0.0f;
+
+    if (segment_size <= 0) {
+        return peak;
+    }
+
+    for (int start = 0; start < n_samples; start += segment_size) {
+        auto end = std::min(start + segment_size, n_samples);
+        float sum = 0.0f;
+
+        for (int i = start; i < end; i++) {
+            sum += samples[i] * samples[i];
+        }
+
+        peak = std::max(peak, sum / static_cast<float>(segment_size));
+    }
+
+    return peak;
+}
+
+float VoicingClassifier::zeroCrossingRate(
+    const std::vector<float> &segment) {
+    //
+    auto n_pairs = static_cast<int>(segment.size()) - 1;
+
+    if (n_pairs < 1) {
+        return 0.0f;
+    }
+
+    int n_crossings = 0;
+
+    for (int i = 0; i < n_pairs; i++) {
+        n_crossings += (segment[i] < 0.0f) != (segment[i + 1] < 0.0f);
+    }
+
+    return static_cast<float>(n_crossings) / static_cast<float>(n_pairs);
+}
+
+float VoicingClassifier::periodicity(float energy, float correlation,
+    int lag, int n_samples) {
+    //
+    if (lag <= 0 || lag >= n_samples || energy <= 0.0f) {
+        return 0.0f;
+    }
+
+    auto n_products = static_cast<float>(n_samples - lag);
+    return correlation * static_cast<float>(n_samples) /
+        (n_products * energy);
+}
+
+};  // namespace tms_express
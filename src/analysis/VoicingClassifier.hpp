@@ -0,0 +1,148 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_LPC_ANALYSIS_VOICINGCLASSIFIER_HPP_
+#define TMS_EXPRESS_LPC_ANALYSIS_VOICINGCLASSIFIER_HPP_
+
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Decides whether segments of speech are voiced or unvoiced
+/// @details Each segment is scored on a weighted combination of features:
+///             periodicity at the estimated pitch period, energy relative to
+///             the loudest segment of the utterance, zero-crossing rate, and
+///             the first reflector coefficient. Every feature is read from the
+///             autocorrelations already computed by pitch and LPC analysis,
+///             such that classification makes no further pass over the
+///             samples. The score is compared against a threshold, optionally
+///             with hysteresis, such that a decision persists across segments
+///             which lie near the boundary
+class VoicingClassifier {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Voicing Classifier
+    /// @param hysteresis Distance of the voicing score from the decision
+    ///                     threshold required to change the decision, or zero
+    ///                     to decide each segment independently
+    explicit VoicingClassifier(float hysteresis = 0.0f);
+
+    /// @brief Forgets the previous decision, in preparation for classifying a
+    ///         new utterance
+    /// @param peak_energy Mean-square energy of the loudest segment of the
+    ///                     utterance, as found by peakEnergy(), against which
+    ///                     the energy of each segment is judged
+    /// @note If the peak energy is unknown, the loudest segment classified so
+    ///         far is used instead, which favors voicing the first segments
+    void reset(float peak_energy = 0.0f);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the hysteresis
+    /// @return Hysteresis, in voicing score units
+    float getHysteresis() const;
+
+    /// @brief Sets the hysteresis
+    /// @param hysteresis Hysteresis, in voicing score units
+    void setHysteresis(float hysteresis);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Classification /////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Classifies the next segment of an utterance
+    /// @param pitch_segment Lowpass-filtered segment used for pitch analysis
+    /// @param pitch_acf Biased autocorrelation of the pitch segment, or an
+    ///                     empty vector if pitch analysis did not compute it,
+    ///                     in which case only the two required lags are
+    ///                     evaluated
+    /// @param pitch_period Estimated pitch period of segment, in samples
+    /// @param lpc_segment Samples of the segment used for LPC analysis, prior
+    ///                     to windowing
+    /// @param k1 First reflector coefficient of segment
+    /// @return true if segment is voiced, false otherwise
+    bool classify(const std::vector<float> &pitch_segment,
+        const std::vector<float> &pitch_acf, float pitch_period,
+        const std::vector<float> &lpc_segment, float k1);
+
+    /// @brief Classifies the next segment of an utterance from its features
+    /// @param energy Mean-square energy of the pitch segment
+    /// @param zero_crossing_rate Zero-crossing rate of segment
+    /// @param periodicity Normalized autocorrelation of the pitch segment at
+    ///                     its pitch period
+    /// @param k1 First reflector coefficient of segment
+    /// @return true if segment is voiced, false otherwise
+    bool classify(float energy, float zero_crossing_rate, float periodicity,
+        float k1);
+
+    /// @brief Classifies the next segment of an utterance given its score
+    /// @param score Voicing score, from 0 (unvoiced) to 1 (voiced)
+    /// @return true if segment is voiced, false otherwise
+    bool classify(float score);
+
+    /// @brief Computes the voicing score of a segment
+    /// @param energy Mean-square energy of segment
+    /// @param zero_crossing_rate Zero-crossing rate of segment
+    /// @param periodicity Normalized autocorrelation of segment at its pitch
+    ///                     period
+    /// @param k1 First reflector coefficient of segment
+    /// @return Voicing score, from 0 (unvoiced) to 1 (voiced)
+    float score(float energy, float zero_crossing_rate, float periodicity,
+        float k1) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Features ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Finds the mean-square energy of the loudest segment of an
+    ///         utterance
+    /// @param samples Samples of utterance
+    /// @param n_samples Number of samples
+    /// @param segment_size Samples per segment
+    /// @return Peak mean-square energy
+    static float peakEnergy(const float *samples, int n_samples,
+        int segment_size);
+
+    /// @brief Counts the zero crossings of a segment
+    /// @param segment Samples of segment, prior to windowing
+    /// @return Fraction of adjacent sample pairs which differ in sign
+    /// @note The rate is counted from the samples, rather than estimated from
+    ///         the autocorrelation, as the estimate would be a function of
+    ///         the first reflector coefficient alone
+    static float zeroCrossingRate(const std::vector<float> &segment);
+
+    /// @brief Computes the normalized autocorrelation of a segment at a lag,
+    ///         from its biased autocorrelation
+    /// @param energy Biased autocorrelation at lag zero
+    /// @param correlation Biased autocorrelation at lag
+    /// @param lag Lag, in samples
+    /// @param n_samples Samples in segment
+    /// @return Correlation coefficient between the segment and itself shifted
+    ///         by lag, nominally from -1 to 1
+    /// @note The biased autocorrelation is rescaled by the number of products
+    ///         at each lag, such that long pitch periods are not penalized
+    static float periodicity(float energy, float correlation, int lag,
+        int n_samples);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Hysteresis, in voicing score units
+    float hysteresis_;
+
+    /// @brief Energy of the loudest segment classified so far
+    float peak_energy_;
+
+    /// @brief Decision made for the previous segment
+    bool was_voiced_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_LPC_ANALYSIS_VOICINGCLASSIFIER_HPP_
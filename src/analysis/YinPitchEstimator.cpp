@@ -0,0 +1,174 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "analysis/YinPitchEstimator.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+
+namespace tms_express {
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+YinPitchEstimator::YinPitchEstimator(int sample_rate_hz, int min_frq_hz,
+    int max_frq_hz, float threshold) {
+    //
+    max_period_ = sample_rate_hz / min_frq_hz;
+    min_period_ = sample_rate_hz / max_frq_hz;
+    sample_rate_hz_ = sample_rate_hz;
+    threshold_ = threshold;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int YinPitchEstimator::getMaxPeriod() const {
+    return max_period_;
+}
+
+void YinPitchEstimator::setMaxPeriod(int min_frq_hz) {
+    max_period_ = sample_rate_hz_ / min_frq_hz;
+}
+
+int YinPitchEstimator::getMaxFrq() const {
+    return sample_rate_hz_ / min_period_;
+}
+
+int YinPitchEstimator::getMinPeriod() const {
+    return min_period_;
+}
+
+void YinPitchEstimator::setMinPeriod(int max_frq_hz) {
+    min_period_ = sample_rate_hz_ / max_frq_hz;
+}
+
+int YinPitchEstimator::getMinFrq() const {
+    return sample_rate_hz_ / max_period_;
+}
+
+float YinPitchEstimator::getThreshold() const {
+    return threshold_;
+}
+
+void YinPitchEstimator::setThreshold(float threshold) {
+    threshold_ = threshold;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pitch Estimation ///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+float YinPitchEstimator::estimateFrequency(const std::vector<float> &segment,
+    const std::vector<float> &acf) const {
+    //
+    auto period = estimatePeriod(segment, acf);
+    return static_cast<float>(sample_rate_hz_) / period;
+}
+
+float YinPitchEstimator::estimatePeriod(
+    const std::vector<float> &segment) const {
+    //
+    return estimatePeriod(segment, Autocorrelation(segment));
+}
+
+float YinPitchEstimator::estimatePeriod(const std::vector<float> &segment,
+    const std::vector<float> &acf) const {
+    //
+    auto cmndf = normalizedDifference(segment, acf);
+
+    // Parabolic interpolation requires a neighbor on either side of the dip
+    auto last = std::min(max_period_, static_cast<int>(cmndf.size()) - 2);
+    auto first = std::max(min_period_, 1);
+
+    if (last <= first) {
+        return static_cast<float>(std::max(min_period_, 1));
+    }
+
+    // Absolute threshold: accept the first dip below the threshold, then
+    // descend to the bottom of that dip. Choosing the first (rather than the
+    // deepest) dip is what protects YIN from octave errors
+    auto tau = -1;
+
+    for (int i = first; i <= last; i++) {
+        if (cmndf[i] < threshold_) {
+            tau = i;
+
+            while (tau + 1 <= last && cmndf[tau + 1] < cmndf[tau]) {
+                tau++;
+            }
+
+            break;
+        }
+    }
+
+    // If no dip crosses the threshold, fall back to the global minimum
+    if (tau < 0) {
+        auto min_element = std::min_element(cmndf.begin() + first,
+            cmndf.begin() + last + 1);
+        tau = static_cast<int>(std::distance(cmndf.begin(), min_element));
+    }
+
+    // Parabolic interpolation around the dip yields a fractional period
+    float period = static_cast<float>(tau);
+    float left = cmndf[tau - 1];
+    float center = cmndf[tau];
+    float right = cmndf[tau + 1];
+    float curvature = left - 2.0f * center + right;
+
+    if (curvature > 0.0f) {
+        float offset = 0.5f * (left - right) / curvature;
+        period += std::max(-0.5f, std::min(offset, 0.5f));
+    }
+
+    return std::max(static_cast<float>(min_period_),
+        std::min(period, static_cast<float>(max_period_)));
+}
+
+std::vector<float> YinPitchEstimator::normalizedDifference(
+    const std::vector<float> &segment, const std::vector<float> &acf) {
+    //
+    auto size = static_cast<int>(segment.size());
+    auto cmndf = std::vector<float>(size, 1.0f);
+
+    if (size < 2 || static_cast<int>(acf.size()) < size) {
+        return cmndf;
+    }
+
+    // Prefix sums of the signal energy allow the difference function
+    //
+    //      d(t) = sum_j (x[j] - x[j + t])^2
+    //           = sum_j x[j]^2 + sum_j x[j + t]^2 - 2 * sum_j x[j] * x[j + t]
+    //
+    // to be computed from the autocorrelation in linear time
+    auto energy = std::vector<double>(size + 1, 0.0);
+    for (int i = 0; i < size; i++) {
+        energy[i + 1] = energy[i] + segment[i] * segment[i];
+    }
+
+    // The biased autocorrelation is scaled by the segment size
+    const double scale = static_cast<double>(size);
+    double running_sum = 0.0;
+
+    for (int tau = 1; tau < size; tau++) {
+        auto n_terms = size - tau;
+        double head = energy[n_terms];
+        double tail = energy[size] - energy[tau];
+        double difference = head + tail - 2.0 * scale * acf[tau];
+
+        // Normalizing by the number of terms prevents the shrinking
+        // integration window from biasing the search toward long lags
+        difference = std::max(difference, 0.0) / n_terms;
+
+        running_sum += difference;
+        cmndf[tau] = (running_sum > 0.0) ?
+            static_cast<float>(difference * tau / running_sum) : 1.0f;
+    }
+
+    return cmndf;
+}
+
+};  // namespace tms_express
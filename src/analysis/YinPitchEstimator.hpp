@@ -0,0 +1,117 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+// Reference: "YIN, a fundamental frequency estimator for speech and music"
+//              (de Cheveigné & Kawahara, 2002)
+
+#ifndef TMS_EXPRESS_LPC_ANALYSIS_YINPITCHESTIMATOR_HPP_
+#define TMS_EXPRESS_LPC_ANALYSIS_YINPITCHESTIMATOR_HPP_
+
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Estimates pitch of sample using the YIN cumulative mean normalized
+///         difference function, with sub-sample (fractional) period resolution
+/// @details The difference function is derived from the biased
+///             autocorrelation of the segment, so the expensive part of the
+///             computation is shared with the autocorrelation-based Pitch
+///             Estimator and LPC analysis
+class YinPitchEstimator {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new YIN-based Pitch Estimator
+    /// @param sample_rate_hz Sample rate of data to analyze
+    /// @param min_frq_hz Minimum frequency to detect, in Hertz
+    /// @param max_frq_hz Maximum frequency to detect, in Hertz
+    /// @param threshold Absolute threshold of the normalized difference
+    ///                     function below which a dip is accepted as the
+    ///                     pitch period (usually 0.1-0.15)
+    explicit YinPitchEstimator(int sample_rate_hz, int min_frq_hz = 50,
+        int max_frq_hz = 500, float threshold = 0.1f);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the max pitch period, in samples
+    /// @return Max pitch period, in samples
+    int getMaxPeriod() const;
+
+    /// @brief Sets the max pitch period
+    /// @param min_frq_hz Min pitch frequency, in Hertz
+    void setMaxPeriod(int min_frq_hz);
+
+    /// @brief Accesses the max pitch frequency, in Hertz
+    /// @return Max pitch frequency, in Hertz
+    int getMaxFrq() const;
+
+    /// @brief Accesses the min pitch period, in samples
+    /// @return Min pitch period, in samples
+    int getMinPeriod() const;
+
+    /// @brief Sets the min pitch period
+    /// @param max_frq_hz Max pitch frequency, in Hertz
+    void setMinPeriod(int max_frq_hz);
+
+    /// @brief Accesses the min pitch frequency, in Hertz
+    /// @return Min pitch frequency, in Hertz
+    int getMinFrq() const;
+
+    /// @brief Accesses the absolute threshold
+    /// @return Normalized difference threshold
+    float getThreshold() const;
+
+    /// @brief Sets the absolute threshold
+    /// @param threshold Normalized difference threshold
+    void setThreshold(float threshold);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Pitch Estimation ///////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Estimate the frequency of sample
+    /// @param segment Segment of samples
+    /// @param acf Autocorrelation of segment
+    /// @return Estimated pitch frequency, in Hertz
+    float estimateFrequency(const std::vector<float> &segment,
+        const std::vector<float> &acf) const;
+
+    /// @brief Estimate the period of sample
+    /// @param segment Segment of samples
+    /// @param acf Autocorrelation of segment, as computed by Autocorrelation()
+    /// @return Estimated pitch period, in (fractional) samples
+    float estimatePeriod(const std::vector<float> &segment,
+        const std::vector<float> &acf) const;
+
+    /// @brief Estimate the period of sample, computing its autocorrelation
+    /// @param segment Segment of samples
+    /// @return Estimated pitch period, in (fractional) samples
+    float estimatePeriod(const std::vector<float> &segment) const;
+
+    /// @brief Computes the cumulative mean normalized difference function
+    /// @param segment Segment of samples
+    /// @param acf Autocorrelation of segment
+    /// @return Normalized difference for each lag, where values near zero
+    ///         indicate strong periodicity at that lag
+    static std::vector<float> normalizedDifference(
+        const std::vector<float> &segment, const std::vector<float> &acf);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    int max_period_;
+
+    int min_period_;
+
+    int sample_rate_hz_;
+
+    float threshold_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_LPC_ANALYSIS_YINPITCHESTIMATOR_HPP_
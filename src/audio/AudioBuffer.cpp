@@ -3,51 +3,110 @@
 #include "audio/AudioBuffer.hpp"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <sndfile.hh>
-#include <samplerate.h>
+
+#include "audio/Resampler.hpp"
+#include "stats/EncoderStats.hpp"
 
 namespace tms_express {
 
+/// @brief Number of frames decoded at a time
+static constexpr sf_count_t kBlockFrames = 4096;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Factory Functions //////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 std::shared_ptr<AudioBuffer> AudioBuffer::Create(const std::string &path,
-    int sample_rate_hz, float window_width_ms) {
+    int sample_rate_hz, float window_width_ms, ResampleQuality quality) {
+    //
+    auto samples = std::vector<float>();
+
+    if (!Decode(path, sample_rate_hz, quality, samples)) {
+        return nullptr;
+    }
+
+    auto ptr = std::make_shared<AudioBuffer>(std::move(samples),
+        sample_rate_hz, window_width_ms);
+
+    return ptr;
+}
+
+bool AudioBuffer::Decode(const std::string &path, int sample_rate_hz,
+    ResampleQuality quality, std::vector<float> &samples) {
     //
-    // Attempt to open an audio file via libsndfile, aborting initialization if
-    // the given path does not exist, is invalid, or is not a suported format
+    // Attempt to open an audio file via libsndfile, aborting if the given path
+    // does not exist, is invalid, or is not a suported format
     auto audio_file = SndfileHandle(path);
 
     if (audio_file.error()) {
-        return nullptr;
+        return false;
     }
 
-    // Import samples from the audio file, then resample and mix
     auto src_sample_rate_hz = audio_file.samplerate();
     auto n_frames = audio_file.frames();
     auto n_channels = audio_file.channels();
-    auto buffer_size = n_frames * n_channels;
 
-    std::vector<float> samples(buffer_size);
-    audio_file.read(samples.data(), buffer_size);
+    // Decode, mix to mono, and resample block by block, such that only the
+    // final buffer is ever held in memory in its entirety
+    auto resampler = std::unique_ptr<Resampler>();
+    auto n_samples = n_frames;
 
-    // Resample if needed, and mix to mono
-    if (n_channels != 1) {
-        samples = mixToMono(samples, n_channels);
+    if (src_sample_rate_hz != sample_rate_hz) {
+        resampler = std::make_unique<Resampler>(src_sample_rate_hz,
+            sample_rate_hz, quality);
+
+        n_samples = static_cast<sf_count_t>(static_cast<double>(n_frames) *
+            sample_rate_hz / src_sample_rate_hz);
     }
 
-    if (src_sample_rate_hz != sample_rate_hz) {
-        samples = resample(samples, src_sample_rate_hz, sample_rate_hz);
+    samples.clear();
+    samples.reserve(n_samples + 1);
+
+    auto block = std::vector<float>(kBlockFrames * n_channels);
+
+    while (true) {
+        sf_count_t n_read;
+
+        {
+            auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_DECODE);
+            n_read = audio_file.readf(block.data(), kBlockFrames);
+
+            if (n_read > 0 && n_channels != 1) {
+                mixToMono(block.data(), static_cast<int>(n_read), n_channels,
+                    block.data());
+            }
+        }
+
+        if (n_read <= 0) {
+            break;
+        }
+
+        if (resampler != nullptr) {
+            auto timer = EncoderStats::ScopedTimer(
+                EncoderStats::STAGE_RESAMPLE);
+
+            resampler->process(block.data(), static_cast<int>(n_read),
+                samples);
+
+        } else {
+            samples.insert(samples.end(), block.begin(),
+                block.begin() + n_read);
+        }
     }
 
-    auto ptr = std::make_shared<AudioBuffer>(
-                AudioBuffer(samples, sample_rate_hz, window_width_ms));
+    if (resampler != nullptr) {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_RESAMPLE);
+        resampler->flush(samples);
+    }
 
-    return ptr;
+    // Resamplers may produce a few samples more or less than the ideal length
+    samples.resize(n_samples, 0.0f);
+    return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -61,8 +120,7 @@ AudioBuffer::AudioBuffer(std::vector<float> samples, int sample_rate_hz,
     n_samples_per_segment_ = 0;
     sample_rate_hz_ = sample_rate_hz;
 
-    samples_ = samples;
-    original_samples_ = samples_;
+    samples_ = std::move(samples);
 
     setWindowWidthMs(window_width_ms);
 }
@@ -72,7 +130,7 @@ AudioBuffer::AudioBuffer(int sample_rate_hz, float window_width_ms) {
     n_samples_per_segment_ = 0;
     sample_rate_hz_ = sample_rate_hz;
 
-    samples_ = original_samples_ = {};
+    samples_ = {};
 
     setWindowWidthMs(window_width_ms);
 }
@@ -99,6 +157,31 @@ void AudioBuffer::setSamples(const std::vector<float> &samples) {
     setWindowWidthMs(getWindowWidthMs());
 }
 
+void AudioBuffer::setSamples(std::vector<float> &&samples) {
+    if (samples.empty()) {
+        n_segments_ = 0;
+        n_samples_per_segment_ = 0;
+        samples_.clear();
+
+        return;
+    }
+
+    samples_ = std::move(samples);
+    setWindowWidthMs(getWindowWidthMs());
+}
+
+float *AudioBuffer::getData() {
+    return samples_.data();
+}
+
+const float *AudioBuffer::getData() const {
+    return samples_.data();
+}
+
+int AudioBuffer::getNSamples() const {
+    return static_cast<int>(samples_.size());
+}
+
 float AudioBuffer::getWindowWidthMs() const {
     float numerator = static_cast<float>(n_samples_per_segment_);
     float denominator = static_cast<float>(sample_rate_hz_) * 1.0e-3;
@@ -206,60 +289,24 @@ bool AudioBuffer::render(const std::string &path) const {
     return true;
 }
 
-void AudioBuffer::reset() {
-    samples_ = original_samples_;
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 // Static Initialization Utilities ////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-std::vector<float> AudioBuffer::mixToMono(std::vector<float> samples,
-    int n_channels) {
+void AudioBuffer::mixToMono(const float *samples, int n_frames,
+    int n_channels, float *mono_samples) {
     //
-    int mono_size = samples.size() / n_channels;
-    auto mono_samples = std::vector<float>(mono_size, 0);
+    // Each mono sample is written no later than the first interleaved sample
+    // of its frame is read, so the mix may be performed in place
+    for (int frame = 0; frame < n_frames; frame++) {
+        float sum = 0.0f;
 
-    for (int frame = 0; frame < mono_size; frame++) {
         for (int channel = 0; channel < n_channels; channel++) {
-            mono_samples[frame] += samples[frame * n_channels + channel];
+            sum += samples[frame * n_channels + channel];
         }
 
-        mono_samples[frame] /= static_cast<float>(n_channels);
+        mono_samples[frame] = sum / static_cast<float>(n_channels);
     }
-
-    return mono_samples;
-}
-
-// Resample the audio buffer to the target sample rate
-std::vector<float> AudioBuffer::resample(std::vector<float> samples,
-    int src_sample_rate_hz, int target_sample_rate_hz) {
-    //
-    // Resampler parameters
-    // NOTE:    If a future version of this codebase requires
-    //          compatibility with stereo audio, compute the
-    //          number of frames as: size / (channels * ratio)
-    //          and the number of samples as: (frames * channels)
-    double ratio = static_cast<double>(target_sample_rate_hz) /
-        static_cast<double>(src_sample_rate_hz);
-
-    auto n_frames = static_cast<int>(
-        static_cast<double>(samples.size()) * ratio);
-
-    auto resampled_buffer = std::vector<float>(n_frames);
-
-    // Initialize resampler
-    auto resampler = SRC_DATA();
-    resampler.data_in = samples.data();
-    resampler.input_frames = samples.size();
-    resampler.data_out = resampled_buffer.data();
-    resampler.output_frames = n_frames;
-    resampler.src_ratio = ratio;
-
-    // Store resampled audio
-    // TODO(Joseph Bellahcen): Check for errors and return empty vector if occur
-    src_simple(&resampler, SRC_SINC_BEST_QUALITY, 1);
-    return resampled_buffer;
 }
 
 };  // namespace tms_express
@@ -13,6 +13,22 @@ namespace tms_express {
 ///         segment-based analysis
 class AudioBuffer {
  public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Enums //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Resampling algorithms, in order of decreasing quality
+    /// @note The polyphase decimator applies only when the original sample
+    ///         rate is an integer multiple of the target (such as 48 kHz to
+    ///         8 kHz). Other conversions fall back to the fastest sinc
+    ///         resampler
+    enum ResampleQuality {
+        RESAMPLEQUALITY_SINC_BEST,
+        RESAMPLEQUALITY_SINC_MEDIUM,
+        RESAMPLEQUALITY_SINC_FASTEST,
+        RESAMPLEQUALITY_POLYPHASE
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // Factory Functions //////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -21,10 +37,26 @@ class AudioBuffer {
     /// @param path Path to audio file
     /// @param sample_rate_hz Rate at which to sample/resample audio, in Hertz
     /// @param window_width_ms Segmentation window with, in milliseconds
+    /// @param quality Resampling algorithm, if resampling is required
     /// @return Pointer to a valid Audio Buffer if path points to valid file,
     ///         nullptr otherwise
+    /// @throws std::runtime_error if audio cannot be resampled
+    /// @note The file is decoded, mixed, and resampled in blocks, such that
+    ///         peak memory usage is close to the size of the resulting buffer
     static std::shared_ptr<AudioBuffer> Create(const std::string &path,
-        int sample_rate_hz = 8000, float window_width_ms = 25.0f);
+        int sample_rate_hz = 8000, float window_width_ms = 25.0f,
+        ResampleQuality quality = RESAMPLEQUALITY_SINC_BEST);
+
+    /// @brief Decodes audio file to mono samples at the given sample rate,
+    ///         without segmenting them
+    /// @param path Path to audio file
+    /// @param sample_rate_hz Rate at which to sample/resample audio, in Hertz
+    /// @param quality Resampling algorithm, if resampling is required
+    /// @param samples Destination of decoded samples
+    /// @return true if path points to valid file, false otherwise
+    /// @throws std::runtime_error if audio cannot be resampled
+    static bool Decode(const std::string &path, int sample_rate_hz,
+        ResampleQuality quality, std::vector<float> &samples);
 
     ///////////////////////////////////////////////////////////////////////////
     // Initializers ///////////////////////////////////////////////////////////
@@ -56,6 +88,25 @@ class AudioBuffer {
     /// @param samples New samples vector
     void setSamples(const std::vector<float> &samples);
 
+    /// @brief Replaces Audio Buffer samples with given vector, without copying
+    /// @param samples New samples vector, which is moved into the Audio Buffer
+    void setSamples(std::vector<float> &&samples);
+
+    /// @brief Accesses unsegmented array of samples in place, without copying
+    /// @return Pointer to first of getNSamples() samples
+    /// @note Samples may be modified through the pointer, but the size of the
+    ///         Audio Buffer may only be changed via setSamples()
+    float *getData();
+
+    /// @brief Accesses unsegmented array of samples in place, without copying
+    /// @return Pointer to first of getNSamples() samples
+    const float *getData() const;
+
+    /// @brief Accesses number of samples, including zero-padding of the final
+    ///         segment
+    /// @return Samples in Audio Buffer
+    int getNSamples() const;
+
     /// @brief Accesses segmentation window width
     /// @return Segmentation widnow width, in milliseconds
     float getWindowWidthMs() const;
@@ -108,28 +159,19 @@ class AudioBuffer {
     /// @return true if render successful, false otherwise
     bool render(const std::string &path) const;
 
-    /// @brief Restore Audio Buffer samples to initialization state
-    [[deprecated]] void reset();
-
  private:
     ///////////////////////////////////////////////////////////////////////////
     // Static Initialization Utilities ////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
 
-    /// @brief Mixes multi-channel audio to 1D mono samples
-    /// @param samples Original multi-channel samples
-    /// @param n_channels Original number of channels
-    /// @return Mono samples, as a 1D vector
-    static std::vector<float> mixToMono(std::vector<float> samples,
-        int n_channels);
-
-    /// @brief Resamples samples to the target sample rate
-    /// @param samples Original samples
-    /// @param src_sample_rate_hz Original sample rate, in Hertz
-    /// @param target_sample_rate_hz Target sample rate, in Hertz
-    /// @return Resampled vectors at the target sample rate
-    static std::vector<float> resample(std::vector<float> samples,
-        int src_sample_rate_hz, int target_sample_rate_hz);
+    /// @brief Mixes a block of multi-channel audio to 1D mono samples
+    /// @param samples Interleaved multi-channel samples
+    /// @param n_frames Number of frames (samples per channel) in block
+    /// @param n_channels Number of channels
+    /// @param mono_samples Destination of n_frames mono samples, which may
+    ///                     alias samples
+    static void mixToMono(const float *samples, int n_frames, int n_channels,
+        float *mono_samples);
 
     ///////////////////////////////////////////////////////////////////////////
     // Members ////////////////////////////////////////////////////////////////
@@ -148,10 +190,6 @@ class AudioBuffer {
 
     /// @brief Flat (unsegmented) buffer of samples
     std::vector<float> samples_;
-
-    /// @brief Original samples set during initialization
-    // TODO(Joseph Bellahcen): Remove
-    std::vector<float> original_samples_;
 };
 
 };  //  namespace tms_express
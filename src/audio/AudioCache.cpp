@@ -0,0 +1,231 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "audio/AudioCache.hpp"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "lib/CRC.h"
+
+#include "audio/AudioBuffer.hpp"
+
+namespace tms_express {
+
+/// @brief Layout of the header which precedes the float32 samples of a cache
+///         entry
+struct AudioCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t sample_rate_hz;
+    uint32_t reserved;
+    uint64_t n_samples;
+};
+
+static_assert(sizeof(AudioCacheHeader) == 24, "Unexpected header padding");
+
+/// @brief Identifies a cache entry file
+static constexpr char kMagic[4] = {'T', 'M', 'S', 'A'};
+
+/// @brief Version of the cache entry format, which must be incremented if the
+///         format or the decoding pipeline changes
+static constexpr uint32_t kVersion = 1;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+AudioCache::AudioCache(const std::string &directory) {
+    directory_ = directory;
+    n_hits_ = 0;
+    n_misses_ = 0;
+
+    auto error = std::error_code();
+    std::filesystem::create_directories(directory_, error);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::string AudioCache::getDirectory() const {
+    return directory_;
+}
+
+int AudioCache::getHits() const {
+    return n_hits_;
+}
+
+int AudioCache::getMisses() const {
+    return n_misses_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Loading ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<AudioBuffer> AudioCache::load(const std::string &path,
+    int sample_rate_hz, float window_width_ms,
+    AudioBuffer::ResampleQuality quality) {
+    //
+    uint32_t checksum;
+    uint64_t size;
+
+    if (!checksumFile(path, checksum, size)) {
+        return nullptr;
+    }
+
+    return load(path, checksum, size, sample_rate_hz, window_width_ms,
+        quality);
+}
+
+std::shared_ptr<AudioBuffer> AudioCache::load(const std::string &path,
+    uint32_t checksum, uint64_t size, int sample_rate_hz,
+    float window_width_ms, AudioBuffer::ResampleQuality quality) {
+    //
+    char filename[96];
+    snprintf(filename, sizeof(filename), "%08x-%llx-%d-%d.f32", checksum,
+        static_cast<unsigned long long>(size), sample_rate_hz,
+        static_cast<int>(quality));
+
+    auto entry_path = (std::filesystem::path(directory_) / filename).string();
+    auto samples = std::vector<float>();
+
+    if (readEntry(entry_path, sample_rate_hz, samples)) {
+        n_hits_++;
+
+    } else {
+        if (!AudioBuffer::Decode(path, sample_rate_hz, quality, samples)) {
+            return nullptr;
+        }
+
+        n_misses_++;
+        writeEntry(entry_path, sample_rate_hz, samples);
+    }
+
+    return std::make_shared<AudioBuffer>(std::move(samples), sample_rate_hz,
+        window_width_ms);
+}
+
+bool AudioCache::checksumFile(const std::string &path, uint32_t &checksum,
+    uint64_t &size) {
+    //
+    static const auto table = CRC::CRC_32().MakeTable();
+
+    auto file = std::ifstream(path, std::ios::binary);
+
+    if (!file) {
+        return false;
+    }
+
+    auto chunk = std::vector<char>(1 << 16);
+    checksum = CRC::Calculate(nullptr, 0, table);
+    size = 0;
+
+    while (file) {
+        file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        auto n_read = file.gcount();
+
+        checksum = CRC::Calculate(chunk.data(), n_read, table, checksum);
+        size += n_read;
+    }
+
+    return true;
+}
+
+std::string AudioCache::makeTempPath(const std::string &entry_path) {
+    // The process ID distinguishes concurrent encodes, and the counter
+    // distinguishes the threads of a batch encode
+    static std::atomic<uint64_t> n_temp_files(0);
+
+    return entry_path + ".tmp" + std::to_string(getpid()) + "-" +
+        std::to_string(n_temp_files.fetch_add(1, std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool AudioCache::readEntry(const std::string &entry_path, int sample_rate_hz,
+    std::vector<float> &samples) {
+    //
+    auto error = std::error_code();
+    auto file_size = std::filesystem::file_size(entry_path, error);
+
+    if (error || file_size < sizeof(AudioCacheHeader)) {
+        return false;
+    }
+
+    auto file = std::ifstream(entry_path, std::ios::binary);
+    auto header = AudioCacheHeader();
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+    // Validate the header before trusting the size of the payload
+    auto payload_size = file_size - sizeof(header);
+    auto is_valid = file &&
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+        header.version == kVersion &&
+        header.sample_rate_hz == static_cast<uint32_t>(sample_rate_hz) &&
+        header.n_samples * sizeof(float) == payload_size;
+
+    if (!is_valid) {
+        return false;
+    }
+
+    // The payload is read straight into the samples, which the Audio Buffer
+    // then adopts without copying
+    samples.resize(header.n_samples);
+    file.read(reinterpret_cast<char *>(samples.data()),
+        static_cast<std::streamsize>(payload_size));
+
+    return static_cast<bool>(file);
+}
+
+bool AudioCache::writeEntry(const std::string &entry_path, int sample_rate_hz,
+    const std::vector<float> &samples) {
+    //
+    auto header = AudioCacheHeader();
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.sample_rate_hz = static_cast<uint32_t>(sample_rate_hz);
+    header.reserved = 0;
+    header.n_samples = samples.size();
+
+    // Write to a uniquely-named temporary file, then rename it into place, so
+    // that concurrent encodes never observe a partially-written entry
+    auto temp_path = makeTempPath(entry_path);
+
+    {
+        auto file = std::ofstream(temp_path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(samples.data()),
+            static_cast<std::streamsize>(samples.size() * sizeof(float)));
+
+        if (!file) {
+            file.close();
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+
+    auto error = std::error_code();
+    std::filesystem::rename(temp_path, entry_path, error);
+
+    if (error) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+};  // namespace tms_express
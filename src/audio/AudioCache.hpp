@@ -0,0 +1,136 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_AUDIO_AUDIOCACHE_HPP_
+#define TMS_EXPRESS_AUDIO_AUDIOCACHE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+
+namespace tms_express {
+
+/// @brief Stores decoded and resampled audio on disk, such that repeated
+///         encodes of the same file skip decoding and resampling entirely
+/// @details Entries are keyed by a CRC32 of the file contents, the file size,
+///             the target sample rate, and the resampling algorithm. A cached
+///             entry is therefore never stale, even if the source file is
+///             modified in place. Entries are read directly into the
+///             samples of the resulting Audio Buffer, without an intermediate
+///             copy
+class AudioCache {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Audio Cache backed by the given directory
+    /// @param directory Directory in which to store cache entries, which will
+    ///                     be created if it does not exist
+    explicit AudioCache(const std::string &directory);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the cache directory
+    /// @return Path to cache directory
+    std::string getDirectory() const;
+
+    /// @brief Accesses the number of loads served from the cache
+    /// @return Cache hits
+    int getHits() const;
+
+    /// @brief Accesses the number of loads which required decoding
+    /// @return Cache misses
+    int getMisses() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Loading ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates new Audio Buffer from audio file, via the cache
+    /// @param path Path to audio file
+    /// @param sample_rate_hz Rate at which to sample/resample audio, in Hertz
+    /// @param window_width_ms Segmentation window with, in milliseconds
+    /// @param quality Resampling algorithm, if resampling is required
+    /// @return Pointer to a valid Audio Buffer if path points to valid file,
+    ///         nullptr otherwise
+    /// @throws std::runtime_error if audio cannot be resampled
+    /// @note Failure to write a cache entry is not an error, as the cache is
+    ///         merely an optimization
+    std::shared_ptr<AudioBuffer> load(const std::string &path,
+        int sample_rate_hz = 8000, float window_width_ms = 25.0f,
+        AudioBuffer::ResampleQuality quality =
+            AudioBuffer::RESAMPLEQUALITY_SINC_BEST);
+
+    /// @brief Creates new Audio Buffer from audio file, via the cache, given
+    ///         its previously computed checksum
+    /// @param path Path to audio file
+    /// @param checksum CRC32 of audio file, as computed by checksumFile()
+    /// @param size Size of audio file, in bytes
+    /// @param sample_rate_hz Rate at which to sample/resample audio, in Hertz
+    /// @param window_width_ms Segmentation window with, in milliseconds
+    /// @param quality Resampling algorithm, if resampling is required
+    /// @return Pointer to a valid Audio Buffer if path points to valid file,
+    ///         nullptr otherwise
+    /// @throws std::runtime_error if audio cannot be resampled
+    std::shared_ptr<AudioBuffer> load(const std::string &path,
+        uint32_t checksum, uint64_t size, int sample_rate_hz,
+        float window_width_ms, AudioBuffer::ResampleQuality quality);
+
+    /// @brief Computes the CRC32 of a file's contents
+    /// @param path Path to file
+    /// @param checksum Destination of CRC32
+    /// @param size Destination of file size, in bytes
+    /// @return true if file could be read, false otherwise
+    static bool checksumFile(const std::string &path, uint32_t &checksum,
+        uint64_t &size);
+
+    /// @brief Names a temporary file in which to write a cache entry before
+    ///         renaming it into place
+    /// @param entry_path Path to cache entry
+    /// @return Path to temporary file, which is unique across processes and
+    ///         the threads of each process
+    static std::string makeTempPath(const std::string &entry_path);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Reads a cache entry
+    /// @param entry_path Path to cache entry
+    /// @param sample_rate_hz Expected sample rate, in Hertz
+    /// @param samples Destination of cached samples
+    /// @return true if entry exists and is valid, false otherwise
+    static bool readEntry(const std::string &entry_path, int sample_rate_hz,
+        std::vector<float> &samples);
+
+    /// @brief Writes a cache entry, atomically replacing any existing entry
+    /// @param entry_path Path to cache entry
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    /// @param samples Samples to cache
+    /// @return true if entry was written, false otherwise
+    static bool writeEntry(const std::string &entry_path, int sample_rate_hz,
+        const std::vector<float> &samples);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Cache directory
+    std::string directory_;
+
+    /// @brief Number of loads served from the cache
+    int n_hits_;
+
+    /// @brief Number of loads which required decoding
+    int n_misses_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_AUDIO_AUDIOCACHE_HPP_
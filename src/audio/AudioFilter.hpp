@@ -3,7 +3,6 @@
 #ifndef TMS_EXPRESS_AUDIO_AUDIOFILTER_HPP_
 #define TMS_EXPRESS_AUDIO_AUDIOFILTER_HPP_
 
-#include <array>
 #include <string>
 #include <vector>
 
@@ -33,12 +32,14 @@ class AudioFilter {
     /// @brief Applies highpass filter to entire buffer
     /// @param buffer Audio Buffer to apply filter to
     /// @param cutoffHz Highpass cutoff frequency, in Hertz
-    void applyHighpass(AudioBuffer &buffer, int cutoff_hz);
+    /// @note To apply several filters in a single pass, use a Filter Bank
+    void applyHighpass(AudioBuffer &buffer, int cutoff_hz) const;
 
     /// @brief Applies lowpass filter to entire buffer
     /// @param buffer Audio Buffer to apply filter to
     /// @param cutoffHz Lowpass cutoff frequency, in Hertz
-    void applyLowpass(AudioBuffer &buffer, int cutoff_hz);
+    /// @note To apply several filters in a single pass, use a Filter Bank
+    void applyLowpass(AudioBuffer &buffer, int cutoff_hz) const;
 
     ///////////////////////////////////////////////////////////////////////////
     // Simple Filters /////////////////////////////////////////////////////////
@@ -48,35 +49,6 @@ class AudioFilter {
     /// @param buffer Audio Buffer to apply filter to
     /// @param alpha Pre-emphasis coefficient (usually 0.9375)
     void applyPreEmphasis(AudioBuffer &buffer, float alpha = 0.9375) const;
-
- private:
-    ///////////////////////////////////////////////////////////////////////////
-    // Enums //////////////////////////////////////////////////////////////////
-    ///////////////////////////////////////////////////////////////////////////
-
-    /// @brief Last-used filter mode
-    /// @note The Filter Mode is stored to prevent unnecessary re-calculation
-    ///         of filter coefficients
-    enum FilterMode {HPF, LPF};
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Helpers ////////////////////////////////////////////////////////////////
-    ///////////////////////////////////////////////////////////////////////////
-
-    /// @brief Applies bi-quadratic filter coefficients to entire Buffer
-    /// @param buffer Audio Buffer to apply filter to
-    void applyBiquad(AudioBuffer &buffer);
-
-    /// @brief Computes bi-quadratic filter coefficients for a highpass or
-    ///         lowpass filter
-    void computeCoeffs(FilterMode mode, int cutoff_hz);
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Members ////////////////////////////////////////////////////////////////
-    ///////////////////////////////////////////////////////////////////////////
-
-    /// @brief Bi-quadratic filter coefficients
-    std::array<float, 6> coeffs_{0, 0, 0, 0, 0, 0};
 };
 
 };  // namespace tms_express
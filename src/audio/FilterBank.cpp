@@ -0,0 +1,211 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "audio/FilterBank.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+
+namespace tms_express {
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FilterBank::FilterBank() {
+    design_sample_rate_hz_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Configuration //////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FilterBank::addHighpass(int cutoff_hz, int order) {
+    specs_.push_back({HPF, static_cast<float>(cutoff_hz), order});
+    design_sample_rate_hz_ = 0;
+}
+
+void FilterBank::addLowpass(int cutoff_hz, int order) {
+    specs_.push_back({LPF, static_cast<float>(cutoff_hz), order});
+    design_sample_rate_hz_ = 0;
+}
+
+void FilterBank::addPreEmphasis(float alpha) {
+    specs_.push_back({PRE_EMPHASIS, alpha, 1});
+    design_sample_rate_hz_ = 0;
+}
+
+void FilterBank::clear() {
+    specs_.clear();
+    sections_.clear();
+    design_sample_rate_hz_ = 0;
+}
+
+bool FilterBank::empty() const {
+    return specs_.empty();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Filtering //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FilterBank::apply(AudioBuffer &buffer) {
+    apply(buffer.getData(), buffer.getData(), buffer.getNSamples(),
+        buffer.getSampleRateHz());
+}
+
+void FilterBank::apply(std::vector<float> &samples, int sample_rate_hz) {
+    apply(samples.data(), samples.data(), static_cast<int>(samples.size()),
+        sample_rate_hz);
+}
+
+void FilterBank::apply(const float *input, float *output, int n_samples,
+    int sample_rate_hz) {
+    //
+    design(sample_rate_hz);
+
+    if (sections_.empty()) {
+        if (input != output) {
+            std::copy(input, input + n_samples, output);
+        }
+
+        return;
+    }
+
+    // Each section is realized in transposed direct form II, which requires
+    // two state variables per section
+    auto state = std::vector<float>(2 * sections_.size(), 0.0f);
+
+    for (int i = 0; i < n_samples; i++) {
+        output[i] = processSample(input[i], state.data());
+    }
+}
+
+void FilterBank::applySplit(const float *input, int n_samples,
+    int sample_rate_hz, FilterBank &first_bank, float *first_output,
+    FilterBank &second_bank, float *second_output) {
+    //
+    first_bank.design(sample_rate_hz);
+    second_bank.design(sample_rate_hz);
+
+    auto first_state = std::vector<float>(2 * first_bank.sections_.size(),
+        0.0f);
+    auto second_state = std::vector<float>(2 * second_bank.sections_.size(),
+        0.0f);
+
+    // The second branch must be computed first, as the first branch may
+    // overwrite the input in place
+    for (int i = 0; i < n_samples; i++) {
+        float sample = input[i];
+        second_output[i] = second_bank.processSample(sample,
+            second_state.data());
+        first_output[i] = first_bank.processSample(sample, first_state.data());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FilterBank::design(int sample_rate_hz) {
+    if (design_sample_rate_hz_ == sample_rate_hz) {
+        return;
+    }
+
+    sections_.clear();
+
+    for (const auto &spec : specs_) {
+        if (spec.type == PRE_EMPHASIS) {
+            sections_.push_back({1.0f, -spec.parameter, 0.0f, 0.0f, 0.0f});
+
+        } else {
+            designButterworth(spec, sample_rate_hz);
+        }
+    }
+
+    design_sample_rate_hz_ = sample_rate_hz;
+}
+
+void FilterBank::designButterworth(const FilterSpec &spec,
+    int sample_rate_hz) {
+    // Acknowledgement: The bi-quadratic filter algorithms come from
+    //  Robert Bristow-Johnson <robert@audioheads.com>.
+    //  Additional information about digital biquad filters may be found at
+    //  https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
+    //
+    // Because every section is pre-warped to the same cutoff, cascading
+    // sections with the Q factors of the analog Butterworth prototype yields
+    // a true digital Butterworth response
+    auto nyquist_hz = 0.5 * static_cast<double>(sample_rate_hz);
+    auto cutoff_hz = static_cast<double>(spec.parameter);
+
+    // A lowpass at or above Nyquist, or a highpass at or below DC, passes the
+    // signal unmodified
+    if ((spec.type == LPF && cutoff_hz >= nyquist_hz) ||
+        (spec.type == HPF && cutoff_hz <= 0.0)) {
+        return;
+    }
+
+    cutoff_hz = std::max(1.0, std::min(cutoff_hz, nyquist_hz - 1.0));
+
+    auto order = std::max(1, spec.order);
+    double omega = 2.0 * M_PI * cutoff_hz / static_cast<double>(sample_rate_hz);
+    double cs = std::cos(omega);
+    double sn = std::sin(omega);
+
+    for (int k = 0; k < order / 2; k++) {
+        double q = 1.0 / (2.0 * std::sin(M_PI * (2 * k + 1) / (2.0 * order)));
+        double alpha = sn / (2.0 * q);
+        double a0 = 1.0 + alpha;
+
+        double b0, b1;
+
+        if (spec.type == HPF) {
+            b0 = (1.0 + cs) / 2.0;
+            b1 = -(1.0 + cs);
+
+        } else {
+            b0 = (1.0 - cs) / 2.0;
+            b1 = 1.0 - cs;
+        }
+
+        sections_.push_back({
+            static_cast<float>(b0 / a0),
+            static_cast<float>(b1 / a0),
+            static_cast<float>(b0 / a0),
+            static_cast<float>(-2.0 * cs / a0),
+            static_cast<float>((1.0 - alpha) / a0)});
+    }
+
+    // Odd orders require an additional first-order section
+    if (order % 2) {
+        double k = std::tan(omega / 2.0);
+        double a1 = (k - 1.0) / (k + 1.0);
+        double b0 = (spec.type == HPF) ? 1.0 / (1.0 + k) : k / (1.0 + k);
+        double b1 = (spec.type == HPF) ? -b0 : b0;
+
+        sections_.push_back({
+            static_cast<float>(b0),
+            static_cast<float>(b1),
+            0.0f,
+            static_cast<float>(a1),
+            0.0f});
+    }
+}
+
+float FilterBank::processSample(float sample, float *state) const {
+    for (const auto &section : sections_) {
+        float result = section.b0 * sample + state[0];
+        state[0] = section.b1 * sample - section.a1 * result + state[1];
+        state[1] = section.b2 * sample - section.a2 * result;
+
+        sample = result;
+        state += 2;
+    }
+
+    return sample;
+}
+
+};  // namespace tms_express
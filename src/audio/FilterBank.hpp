@@ -0,0 +1,154 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_AUDIO_FILTERBANK_HPP_
+#define TMS_EXPRESS_AUDIO_FILTERBANK_HPP_
+
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+
+namespace tms_express {
+
+/// @brief Applies a chain of filters to audio in a single pass
+/// @details Filters are specified independently of sample rate, and are
+///             realized as a cascade of pre-normalized second-order sections
+///             the first time they are applied at a given sample rate. Each
+///             sample then passes through every section before the next sample
+///             is read, such that the buffer is traversed exactly once
+///             regardless of the number of filters
+class FilterBank {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new, empty Filter Bank which passes audio unmodified
+    FilterBank();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration //////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Appends a Butterworth highpass filter to the chain
+    /// @param cutoff_hz Highpass cutoff (-3 dB) frequency, in Hertz
+    /// @param order Filter order, where order 2 is a single biquad
+    void addHighpass(int cutoff_hz, int order = 2);
+
+    /// @brief Appends a Butterworth lowpass filter to the chain
+    /// @param cutoff_hz Lowpass cutoff (-3 dB) frequency, in Hertz
+    /// @param order Filter order, where order 2 is a single biquad
+    void addLowpass(int cutoff_hz, int order = 2);
+
+    /// @brief Appends a pre-emphasis filter, y(t) = x(t) - a * x(t-1), to the
+    ///         chain
+    /// @param alpha Pre-emphasis coefficient (usually 0.9375)
+    void addPreEmphasis(float alpha = 0.9375f);
+
+    /// @brief Removes all filters from the chain
+    void clear();
+
+    /// @brief Reports whether the chain contains any filters
+    /// @return true if the chain is empty, false otherwise
+    bool empty() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Filtering //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Applies filter chain to entire buffer, in place
+    /// @param buffer Audio Buffer to filter, whose sample rate determines the
+    ///                 filter coefficients
+    void apply(AudioBuffer &buffer);
+
+    /// @brief Applies filter chain to samples, in place
+    /// @param samples Samples to filter
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    void apply(std::vector<float> &samples, int sample_rate_hz);
+
+    /// @brief Applies filter chain to an array of samples
+    /// @param input Samples to filter
+    /// @param output Destination of filtered samples, which may alias input
+    /// @param n_samples Number of samples in input and output
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    void apply(const float *input, float *output, int n_samples,
+        int sample_rate_hz);
+
+    /// @brief Applies two filter chains to the same input in a single pass,
+    ///         such that each input sample is read exactly once
+    /// @param input Samples to filter
+    /// @param n_samples Number of samples in input and both outputs
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    /// @param first_bank Filter chain of the first branch
+    /// @param first_output Destination of the first branch, which may alias
+    ///                     input
+    /// @param second_bank Filter chain of the second branch
+    /// @param second_output Destination of the second branch, which must not
+    ///                         alias input
+    static void applySplit(const float *input, int n_samples,
+        int sample_rate_hz, FilterBank &first_bank, float *first_output,
+        FilterBank &second_bank, float *second_output);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Enums //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Filter types which may be placed in the chain
+    enum FilterType {HPF, LPF, PRE_EMPHASIS};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Structs ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sample-rate-independent description of a filter
+    struct FilterSpec {
+        FilterType type;
+        float parameter;
+        int order;
+    };
+
+    /// @brief Second-order section, normalized such that a0 = 1. First-order
+    ///         sections have b2 = a2 = 0
+    struct Biquad {
+        float b0, b1, b2;
+        float a1, a2;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Realizes filter specifications as second-order sections for the
+    ///         given sample rate, if not already done
+    /// @param sample_rate_hz Sample rate, in Hertz
+    void design(int sample_rate_hz);
+
+    /// @brief Appends the sections of a Butterworth highpass or lowpass filter
+    /// @param spec Filter specification
+    /// @param sample_rate_hz Sample rate, in Hertz
+    void designButterworth(const FilterSpec &spec, int sample_rate_hz);
+
+    /// @brief Passes a single sample through every section of the chain
+    /// @param sample Input sample
+    /// @param state Two state variables per section, updated in place
+    /// @return Filtered sample
+    float processSample(float sample, float *state) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Filter specifications, in order of application
+    std::vector<FilterSpec> specs_;
+
+    /// @brief Second-order sections realizing the filter specifications
+    std::vector<Biquad> sections_;
+
+    /// @brief Sample rate for which sections were designed, or zero if the
+    ///         sections are out of date
+    int design_sample_rate_hz_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_AUDIO_FILTERBANK_HPP_
@@ -0,0 +1,151 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "audio/PeakPyramid.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Number of entries of each level summarized by one entry of the next
+static constexpr int kBranching = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+PeakPyramid::PeakPyramid(std::vector<float> samples) {
+    setSamples(std::move(samples));
+}
+
+void PeakPyramid::setSamples(std::vector<float> samples) {
+    samples_ = std::move(samples);
+    levels_.clear();
+
+    // The first level summarizes the samples, and each subsequent level its
+    // predecessor, until a single Peak spans the entire signal
+    auto n_entries = static_cast<int>(samples_.size());
+
+    while (n_entries > 1) {
+        auto n_peaks = (n_entries + kBranching - 1) / kBranching;
+        auto level = std::vector<Peak>(n_peaks);
+
+        for (int i = 0; i < n_peaks; i++) {
+            auto first = i * kBranching;
+            auto last = std::min(first + kBranching, n_entries);
+
+            if (levels_.empty()) {
+                auto [min, max] = std::minmax_element(samples_.begin() + first,
+                    samples_.begin() + last);
+                level[i] = {*min, *max};
+
+            } else {
+                const auto &finer = levels_.back();
+                level[i] = finer[first];
+
+                for (int j = first + 1; j < last; j++) {
+                    level[i].min = std::min(level[i].min, finer[j].min);
+                    level[i].max = std::max(level[i].max, finer[j].max);
+                }
+            }
+        }
+
+        levels_.push_back(std::move(level));
+        n_entries = n_peaks;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+const std::vector<float> &PeakPyramid::getSamples() const {
+    return samples_;
+}
+
+int PeakPyramid::getNSamples() const {
+    return static_cast<int>(samples_.size());
+}
+
+int PeakPyramid::getNLevels() const {
+    return static_cast<int>(levels_.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Queries ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+PeakPyramid::Peak PeakPyramid::query(int start, int end) const {
+    return queryLevel(selectLevel(end - start), start, end);
+}
+
+std::vector<PeakPyramid::Peak> PeakPyramid::query(int n_spans) const {
+    auto n_samples = static_cast<long>(samples_.size());
+    auto level = selectLevel(static_cast<int>(n_samples / n_spans));
+    auto peaks = std::vector<Peak>(n_spans);
+
+    for (int i = 0; i < n_spans; i++) {
+        auto start = static_cast<int>(i * n_samples / n_spans);
+        auto end = static_cast<int>((i + 1) * n_samples / n_spans);
+        peaks[i] = queryLevel(level, start, end);
+    }
+
+    return peaks;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int PeakPyramid::selectLevel(int span) const {
+    int level = -1;
+    int block_size = kBranching;
+
+    while (level + 1 < getNLevels() && 2 * block_size <= span) {
+        level++;
+        block_size *= kBranching;
+    }
+
+    return level;
+}
+
+PeakPyramid::Peak PeakPyramid::queryLevel(int level, int start, int end)
+    const {
+    //
+    if (level < 0) {
+        auto [min, max] = std::minmax_element(samples_.begin() + start,
+            samples_.begin() + end);
+        return {*min, *max};
+    }
+
+    const auto &peaks = levels_[level];
+    auto n_peaks = static_cast<int>(peaks.size());
+
+    // Snap both ends of the span to the nearest block boundary. The final
+    // block may be partial, so a span which ends with the signal takes it
+    // whole
+    auto block_size = kBranching;
+
+    for (int l = 0; l < level; l++) {
+        block_size *= kBranching;
+    }
+
+    auto first = (start + block_size / 2) / block_size;
+    auto last = (end == getNSamples()) ?
+        n_peaks : (end + block_size / 2) / block_size;
+
+    first = std::min(first, n_peaks - 1);
+    last = std::clamp(last, first + 1, n_peaks);
+
+    auto peak = peaks[first];
+
+    for (int i = first + 1; i < last; i++) {
+        peak.min = std::min(peak.min, peaks[i].min);
+        peak.max = std::max(peak.max, peaks[i].max);
+    }
+
+    return peak;
+}
+
+};  // namespace tms_express
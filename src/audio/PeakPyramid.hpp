@@ -0,0 +1,114 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_AUDIO_PEAKPYRAMID_HPP_
+#define TMS_EXPRESS_AUDIO_PEAKPYRAMID_HPP_
+
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Multi-resolution cache of the minimum and maximum of audio samples,
+///         for plotting waveforms at any width in time proportional to the
+///         width rather than to the number of samples
+/// @details Each level summarizes the previous one in blocks of four, such
+///             that the pyramid occupies two-thirds as many floats as the
+///             samples themselves, and is built in a single linear pass
+class PeakPyramid {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Structures /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Extent of a span of samples
+    struct Peak {
+        /// @brief Least sample in span
+        float min;
+
+        /// @brief Greatest sample in span
+        float max;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Peak Pyramid
+    /// @param samples Samples to summarize, which are moved into the pyramid
+    explicit PeakPyramid(std::vector<float> samples = {});
+
+    /// @brief Replaces the summarized samples and rebuilds the pyramid
+    /// @param samples New samples, which are moved into the pyramid
+    void setSamples(std::vector<float> samples);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the summarized samples
+    /// @return Samples, at full resolution
+    const std::vector<float> &getSamples() const;
+
+    /// @brief Accesses the number of summarized samples
+    /// @return Number of samples
+    int getNSamples() const;
+
+    /// @brief Accesses the number of summary levels, excluding the samples
+    /// @return Number of levels
+    int getNLevels() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Queries ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Finds the extent of a span of samples
+    /// @param start Index of first sample in span
+    /// @param end Index one past the last sample in span, which must exceed
+    ///             start
+    /// @return Peak of span
+    /// @note The span is snapped to the boundaries of the coarsest blocks
+    ///         which fit within it at least twice, such that the query visits
+    ///         a bounded number of blocks
+    Peak query(int start, int end) const;
+
+    /// @brief Divides the samples into equal spans, and finds the extent of
+    ///         each
+    /// @param n_spans Number of spans, such as the width of a plot in pixels,
+    ///                 which must not exceed the number of samples
+    /// @return Peak of each span
+    /// @note All spans are snapped to blocks of the same level, such that
+    ///         adjacent spans neither overlap nor skip samples
+    std::vector<Peak> query(int n_spans) const;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Selects the coarsest level whose blocks fit within a span at
+    ///         least twice
+    /// @param span Number of samples in span
+    /// @return Level, or -1 if the span must be read from the samples
+    int selectLevel(int span) const;
+
+    /// @brief Finds the extent of a span of samples from a given level
+    /// @param level Level, or -1 to read the samples
+    /// @param start Index of first sample in span
+    /// @param end Index one past the last sample in span
+    /// @return Peak of span
+    Peak queryLevel(int level, int start, int end) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Samples, at full resolution
+    std::vector<float> samples_;
+
+    /// @brief Peaks of each level, where level l summarizes blocks of
+    ///         4^(l + 1) samples
+    std::vector<std::vector<Peak>> levels_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_AUDIO_PEAKPYRAMID_HPP_
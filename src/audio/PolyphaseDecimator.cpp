@@ -0,0 +1,167 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "audio/PolyphaseDecimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Kaiser window shape parameter, which yields roughly 90 dB of
+///         stopband attenuation
+static constexpr double kKaiserBeta = 8.6;
+
+/// @brief Cutoff (half-amplitude) frequency of the anti-aliasing filter, as a
+///         fraction of the output Nyquist frequency
+static constexpr double kCutoff = 0.925;
+
+/// @brief Computes the zeroth-order modified Bessel function of the first kind
+/// @param x Argument
+/// @return I0(x)
+static double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+
+    return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+PolyphaseDecimator::PolyphaseDecimator(int factor, int taps_per_phase) {
+    factor_ = std::max(1, factor);
+    half_length_ = (factor_ == 1) ? 0 : (std::max(2, taps_per_phase) *
+        factor_) / 2;
+
+    // Design a Kaiser-windowed sinc lowpass filter, with unity DC gain
+    auto length = 2 * half_length_ + 1;
+    auto cutoff = kCutoff * 0.5 / factor_;
+    taps_ = std::vector<float>(length);
+
+    double sum = 0.0;
+    auto window_norm = besselI0(kKaiserBeta);
+    auto taps = std::vector<double>(length);
+
+    for (int n = 0; n < length; n++) {
+        double t = static_cast<double>(n - half_length_);
+        double sinc = (t == 0.0) ? 2.0 * cutoff :
+            std::sin(2.0 * M_PI * cutoff * t) / (M_PI * t);
+
+        double ratio = (half_length_ == 0) ? 0.0 : t / half_length_;
+        double window = besselI0(kKaiserBeta *
+            std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) / window_norm;
+
+        taps[n] = sinc * window;
+        sum += taps[n];
+    }
+
+    for (int n = 0; n < length; n++) {
+        taps_[n] = static_cast<float>(taps[n] / sum);
+    }
+
+    reset();
+}
+
+void PolyphaseDecimator::reset() {
+    history_.clear();
+    history_start_ = 0;
+    next_center_ = 0;
+    n_input_samples_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int PolyphaseDecimator::getFactor() const {
+    return factor_;
+}
+
+bool PolyphaseDecimator::supports(int src_sample_rate_hz,
+    int target_sample_rate_hz) {
+    //
+    return target_sample_rate_hz > 0 &&
+        src_sample_rate_hz >= target_sample_rate_hz &&
+        src_sample_rate_hz % target_sample_rate_hz == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Decimation /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void PolyphaseDecimator::process(const float *input, int n_samples,
+    std::vector<float> &output) {
+    //
+    history_.insert(history_.end(), input, input + n_samples);
+    n_input_samples_ += n_samples;
+
+    // Only output samples whose entire filter support has arrived may be
+    // computed. Intermediate samples are never computed at all, which is what
+    // makes decimation cheaper than filtering followed by downsampling
+    while (next_center_ + half_length_ < n_input_samples_) {
+        output.push_back(evaluate(next_center_));
+        next_center_ += factor_;
+    }
+
+    // Discard input which lies entirely behind the next filter position
+    auto n_stale = next_center_ - half_length_ - history_start_;
+
+    if (n_stale > 0) {
+        history_.erase(history_.begin(), history_.begin() + n_stale);
+        history_start_ += n_stale;
+    }
+}
+
+void PolyphaseDecimator::flush(std::vector<float> &output) {
+    while (next_center_ < n_input_samples_) {
+        output.push_back(evaluate(next_center_));
+        next_center_ += factor_;
+    }
+}
+
+std::vector<float> PolyphaseDecimator::decimate(
+    const std::vector<float> &samples) {
+    //
+    auto output = std::vector<float>();
+    output.reserve(samples.size() / factor_ + 1);
+
+    reset();
+    process(samples.data(), static_cast<int>(samples.size()), output);
+    flush(output);
+    reset();
+
+    return output;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+float PolyphaseDecimator::evaluate(long center) const {
+    auto first = center - half_length_;
+    auto last = center + half_length_;
+    auto history_end = history_start_ + static_cast<long>(history_.size());
+
+    // Samples before the start or after the end of the stream are silent
+    auto begin = std::max(first, history_start_);
+    auto end = std::min(last + 1, history_end);
+
+    const float *x = history_.data() + (begin - history_start_);
+    const float *h = taps_.data() + (begin - first);
+    float sum = 0.0f;
+
+    for (long i = 0; i < end - begin; i++) {
+        sum += h[i] * x[i];
+    }
+
+    return sum;
+}
+
+};  // namespace tms_express
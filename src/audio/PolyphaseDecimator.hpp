@@ -0,0 +1,105 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_AUDIO_POLYPHASEDECIMATOR_HPP_
+#define TMS_EXPRESS_AUDIO_POLYPHASEDECIMATOR_HPP_
+
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Reduces the sample rate of audio by an integer factor, using a
+///         linear-phase anti-aliasing FIR filter which is only evaluated at
+///         the retained output samples
+/// @details Input may be supplied in blocks of any size. The filter delay is
+///             compensated, such that output sample m is centered on input
+///             sample (m * factor), as with libsamplerate
+class PolyphaseDecimator {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Polyphase Decimator
+    /// @param factor Decimation factor, such as 6 for 48 kHz to 8 kHz
+    /// @param taps_per_phase Filter taps per output sample, which trades the
+    ///                         steepness of the anti-aliasing filter for speed
+    explicit PolyphaseDecimator(int factor, int taps_per_phase = 64);
+
+    /// @brief Discards buffered input, in preparation for a new stream
+    void reset();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the decimation factor
+    /// @return Decimation factor
+    int getFactor() const;
+
+    /// @brief Reports whether a conversion may be performed by decimation
+    /// @param src_sample_rate_hz Original sample rate, in Hertz
+    /// @param target_sample_rate_hz Target sample rate, in Hertz
+    /// @return true if the original rate is an integer multiple of the target
+    ///         rate, false otherwise
+    static bool supports(int src_sample_rate_hz, int target_sample_rate_hz);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decimation /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Decimates the next block of a stream
+    /// @param input Block of input samples
+    /// @param n_samples Number of input samples
+    /// @param output Vector to which output samples are appended
+    void process(const float *input, int n_samples, std::vector<float> &output);
+
+    /// @brief Produces the output samples which depend on input beyond the end
+    ///         of the stream, treating that input as silence
+    /// @param output Vector to which output samples are appended
+    void flush(std::vector<float> &output);
+
+    /// @brief Decimates an entire signal
+    /// @param samples Input samples
+    /// @return Decimated samples, of which there are ceil(size / factor)
+    std::vector<float> decimate(const std::vector<float> &samples);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Evaluates the filter centered on the given input sample
+    /// @param center Absolute index of input sample
+    /// @return Output sample
+    float evaluate(long center) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Decimation factor
+    int factor_;
+
+    /// @brief Half of the (odd) filter length, which is also its delay
+    int half_length_;
+
+    /// @brief Anti-aliasing filter taps
+    std::vector<float> taps_;
+
+    /// @brief Input samples which may still contribute to future output
+    std::vector<float> history_;
+
+    /// @brief Absolute index of the first sample in the history
+    long history_start_;
+
+    /// @brief Absolute index of the input sample on which the next output
+    ///         sample is centered
+    long next_center_;
+
+    /// @brief Number of input samples received since the last reset
+    long n_input_samples_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_AUDIO_POLYPHASEDECIMATOR_HPP_
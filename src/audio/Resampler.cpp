@@ -0,0 +1,142 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "audio/Resampler.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <samplerate.h>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/PolyphaseDecimator.hpp"
+
+namespace tms_express {
+
+/// @brief Capacity of the intermediate libsamplerate output, in samples
+static constexpr int kScratchSize = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+Resampler::Resampler(int src_sample_rate_hz, int target_sample_rate_hz,
+    AudioBuffer::ResampleQuality quality) {
+    //
+    ratio_ = static_cast<double>(target_sample_rate_hz) /
+        static_cast<double>(src_sample_rate_hz);
+    converter_ = nullptr;
+
+    // Integer-ratio conversions, such as 48 kHz to 8 kHz, may bypass
+    // libsamplerate entirely
+    if (quality == AudioBuffer::RESAMPLEQUALITY_POLYPHASE &&
+        PolyphaseDecimator::supports(src_sample_rate_hz,
+            target_sample_rate_hz)) {
+        //
+        decimator_ = std::make_unique<PolyphaseDecimator>(
+            src_sample_rate_hz / target_sample_rate_hz);
+        return;
+    }
+
+    int converter_type;
+
+    switch (quality) {
+        case AudioBuffer::RESAMPLEQUALITY_SINC_BEST:
+            converter_type = SRC_SINC_BEST_QUALITY;
+            break;
+
+        case AudioBuffer::RESAMPLEQUALITY_SINC_MEDIUM:
+            converter_type = SRC_SINC_MEDIUM_QUALITY;
+            break;
+
+        default:
+            converter_type = SRC_SINC_FASTEST;
+            break;
+    }
+
+    int error = 0;
+    converter_ = src_new(converter_type, 1, &error);
+
+    if (converter_ == nullptr) {
+        throw std::runtime_error(std::string("Could not resample audio: ") +
+            src_strerror(error));
+    }
+
+    scratch_ = std::vector<float>(kScratchSize);
+}
+
+Resampler::~Resampler() {
+    if (converter_ != nullptr) {
+        src_delete(converter_);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Resampling /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Resampler::process(const float *input, int n_samples,
+    std::vector<float> &output) {
+    //
+    if (decimator_ != nullptr) {
+        decimator_->process(input, n_samples, output);
+
+    } else {
+        convert(input, n_samples, false, output);
+    }
+}
+
+void Resampler::flush(std::vector<float> &output) {
+    if (decimator_ != nullptr) {
+        decimator_->flush(output);
+
+    } else {
+        convert(nullptr, 0, true, output);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Resampler::convert(const float *input, int n_samples, bool end_of_input,
+    std::vector<float> &output) {
+    //
+    auto data = SRC_DATA();
+    data.data_in = input;
+    data.input_frames = n_samples;
+    data.end_of_input = end_of_input;
+    data.src_ratio = ratio_;
+
+    // The converter may produce more output than the scratch buffer holds, so
+    // it is drained until all input is consumed and no output remains
+    while (true) {
+        data.data_out = scratch_.data();
+        data.output_frames = static_cast<long>(scratch_.size());
+
+        auto error = src_process(converter_, &data);
+
+        if (error) {
+            throw std::runtime_error(
+                std::string("Could not resample audio: ") +
+                src_strerror(error));
+        }
+
+        output.insert(output.end(), scratch_.begin(),
+            scratch_.begin() + data.output_frames_gen);
+
+        data.data_in += data.input_frames_used;
+        data.input_frames -= data.input_frames_used;
+
+        auto made_progress = data.input_frames_used > 0 ||
+            data.output_frames_gen > 0;
+
+        if (!made_progress || (data.input_frames == 0 &&
+            data.output_frames_gen < data.output_frames && !end_of_input)) {
+            break;
+        }
+    }
+}
+
+};  // namespace tms_express
@@ -0,0 +1,87 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_AUDIO_RESAMPLER_HPP_
+#define TMS_EXPRESS_AUDIO_RESAMPLER_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/PolyphaseDecimator.hpp"
+
+// Opaque libsamplerate converter state, as declared by <samplerate.h>
+struct SRC_STATE_tag;
+
+namespace tms_express {
+
+/// @brief Converts a stream of mono samples between sample rates, block by
+///         block, such that the entire input need never be held in memory
+class Resampler {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Resampler
+    /// @param src_sample_rate_hz Original sample rate, in Hertz
+    /// @param target_sample_rate_hz Target sample rate, in Hertz
+    /// @param quality Resampling algorithm
+    /// @throws std::runtime_error if libsamplerate cannot be initialized
+    Resampler(int src_sample_rate_hz, int target_sample_rate_hz,
+        AudioBuffer::ResampleQuality quality);
+
+    ~Resampler();
+
+    Resampler(const Resampler &) = delete;
+    Resampler &operator=(const Resampler &) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Resampling /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Resamples the next block of a stream
+    /// @param input Block of input samples
+    /// @param n_samples Number of input samples
+    /// @param output Vector to which output samples are appended
+    /// @throws std::runtime_error if libsamplerate reports an error
+    void process(const float *input, int n_samples, std::vector<float> &output);
+
+    /// @brief Produces any output samples still held by the Resampler at the
+    ///         end of the stream
+    /// @param output Vector to which output samples are appended
+    /// @throws std::runtime_error if libsamplerate reports an error
+    void flush(std::vector<float> &output);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Passes a block of input to libsamplerate until it is consumed
+    /// @param input Block of input samples
+    /// @param n_samples Number of input samples
+    /// @param end_of_input true if no input will follow, false otherwise
+    /// @param output Vector to which output samples are appended
+    void convert(const float *input, int n_samples, bool end_of_input,
+        std::vector<float> &output);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Ratio of target to original sample rate
+    double ratio_;
+
+    /// @brief Integer-ratio decimator, or nullptr if libsamplerate is used
+    std::unique_ptr<PolyphaseDecimator> decimator_;
+
+    /// @brief libsamplerate converter, or nullptr if the decimator is used
+    SRC_STATE_tag *converter_;
+
+    /// @brief Intermediate output of libsamplerate
+    std::vector<float> scratch_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_AUDIO_RESAMPLER_HPP_
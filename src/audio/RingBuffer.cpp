@@ -0,0 +1,92 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "audio/RingBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace tms_express {
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+RingBuffer::RingBuffer(int capacity) {
+    samples_ = std::vector<float>(std::max(capacity, 1));
+    read_count_ = 0;
+    write_count_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Producer Interface /////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int RingBuffer::write(const float *samples, int n_samples) {
+    auto capacity = static_cast<int64_t>(samples_.size());
+
+    // Only the producer advances the write count, so it may be read relaxed
+    auto write_count = write_count_.load(std::memory_order_relaxed);
+    auto read_count = read_count_.load(std::memory_order_acquire);
+
+    auto n_written = static_cast<int>(std::min<int64_t>(n_samples,
+        capacity - (write_count - read_count)));
+
+    // The free region may wrap around the end of storage, in which case it is
+    // filled in two parts
+    auto start = static_cast<int>(write_count % capacity);
+    auto n_first = std::min(n_written, static_cast<int>(capacity) - start);
+
+    std::copy(samples, samples + n_first, samples_.begin() + start);
+    std::copy(samples + n_first, samples + n_written, samples_.begin());
+
+    write_count_.store(write_count + n_written, std::memory_order_release);
+    return n_written;
+}
+
+int RingBuffer::getNWritable() const {
+    return getCapacity() - getNReadable();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Consumer Interface /////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int RingBuffer::read(float *samples, int n_samples) {
+    auto capacity = static_cast<int64_t>(samples_.size());
+
+    auto read_count = read_count_.load(std::memory_order_relaxed);
+    auto write_count = write_count_.load(std::memory_order_acquire);
+
+    auto n_read = static_cast<int>(std::min<int64_t>(n_samples,
+        write_count - read_count));
+
+    auto start = static_cast<int>(read_count % capacity);
+    auto n_first = std::min(n_read, static_cast<int>(capacity) - start);
+
+    std::copy(samples_.begin() + start, samples_.begin() + start + n_first,
+        samples);
+    std::copy(samples_.begin(), samples_.begin() + (n_read - n_first),
+        samples + n_first);
+
+    read_count_.store(read_count + n_read, std::memory_order_release);
+    return n_read;
+}
+
+int RingBuffer::getNReadable() const {
+    auto write_count = write_count_.load(std::memory_order_acquire);
+    auto read_count = read_count_.load(std::memory_order_acquire);
+
+    return static_cast<int>(write_count - read_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int RingBuffer::getCapacity() const {
+    return static_cast<int>(samples_.size());
+}
+
+};  // namespace tms_express
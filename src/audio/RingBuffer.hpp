@@ -0,0 +1,85 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_AUDIO_RINGBUFFER_HPP_
+#define TMS_EXPRESS_AUDIO_RINGBUFFER_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace tms_express {
+
+/// @brief Lock-free queue of samples between exactly one producer thread and
+///         exactly one consumer thread, such as a synthesizer and an audio
+///         device callback
+/// @details Neither side ever blocks or allocates. Each side owns one index,
+///             which only it advances, and reads the other's with acquire
+///             semantics, such that samples are fully written before they
+///             become visible to the consumer
+class RingBuffer {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Ring Buffer
+    /// @param capacity Max number of samples held at once
+    explicit RingBuffer(int capacity);
+
+    RingBuffer(const RingBuffer &) = delete;
+    RingBuffer &operator=(const RingBuffer &) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Producer Interface /////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Appends as many samples as fit
+    /// @param samples Samples to append
+    /// @param n_samples Number of samples to append
+    /// @return Number of samples appended
+    int write(const float *samples, int n_samples);
+
+    /// @brief Counts the samples which may be appended without overflow
+    /// @return Number of free slots
+    int getNWritable() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Consumer Interface /////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Removes as many samples as are available, up to a limit
+    /// @param samples Destination of removed samples
+    /// @param n_samples Max number of samples to remove
+    /// @return Number of samples removed
+    int read(float *samples, int n_samples);
+
+    /// @brief Counts the samples which may be removed
+    /// @return Number of queued samples
+    int getNReadable() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the capacity of the buffer
+    /// @return Max number of samples held at once
+    int getCapacity() const;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sample storage
+    std::vector<float> samples_;
+
+    /// @brief Total number of samples ever removed, advanced by the consumer
+    std::atomic<int64_t> read_count_;
+
+    /// @brief Total number of samples ever appended, advanced by the producer
+    std::atomic<int64_t> write_count_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_AUDIO_RINGBUFFER_HPP_
@@ -0,0 +1,461 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "bitstream/AnalysisPipeline.hpp"
+
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/FilterBank.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/FramePostprocessor.hpp"
+#include "encoding/Synthesizer.hpp"
+#include "analysis/Autocorrelation.hpp"
+
+namespace tms_express {
+
+/// @brief Sample rate of analyzed audio, in Hertz
+static constexpr int kSampleRateHz = 8000;
+
+/// @brief Order of the linear predictor, which needs only the leading
+///         kModelOrder + 1 autocorrelation lags of each segment
+static constexpr int kModelOrder = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+AnalysisPipeline::AnalysisPipeline(): pitch_estimator_(kSampleRateHz),
+    yin_estimator_(kSampleRateHz), linear_predictor_(kModelOrder) {
+    //
+    is_valid_.fill(false);
+    computed_with_.fill(AnalysisParameters());
+    n_computations_.fill(0);
+    has_source_ = false;
+}
+
+void AnalysisPipeline::setSource(const AudioBuffer &source) {
+    source_ = source.copy();
+    has_source_ = true;
+    invalidate(STAGE_PITCH_FILTER);
+    invalidate(STAGE_LPC_FILTER);
+}
+
+void AnalysisPipeline::setFrames(const std::vector<Frame> &frames) {
+    source_ = AudioBuffer();
+    has_source_ = false;
+
+    // The imported table stands in for the output of analysis, which is
+    // cleared such that no stale intermediate results are mistaken for it
+    filtered_samples_.clear();
+    pitch_filtered_ = AudioBuffer();
+    lpc_filtered_ = AudioBuffer();
+    pitch_buffer_ = AudioBuffer();
+    lpc_buffer_ = AudioBuffer();
+    pitch_acfs_.clear();
+    lpc_acfs_.clear();
+    pitch_periods_.clear();
+    coeffs_.clear();
+    gains_.clear();
+
+    invalidate(STAGE_PITCH_FILTER);
+    invalidate(STAGE_LPC_FILTER);
+    raw_frames_ = frames;
+
+    for (int stage = 0; stage <= STAGE_FRAMES; stage++) {
+        is_valid_[stage] = true;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Evaluation /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool AnalysisPipeline::run(const AnalysisParameters &parameters,
+    const std::function<bool()> &is_cancelled) {
+    //
+    auto cancelled = [&is_cancelled]() {
+        return is_cancelled != nullptr && is_cancelled();
+    };
+
+    // Analysis stages are meaningless for an imported Frame table, whose
+    // settings are adopted as-is such that only post-processing may be stale
+    int first_stage = has_source_ ? 0 : static_cast<int>(STAGE_POSTPROC);
+
+    // The estimators are configured on every run, as the pitch range also
+    // normalizes the plotted pitch curve of imported Frame tables
+    pitch_estimator_.setMaxPeriod(parameters.min_pitch_hz);
+    pitch_estimator_.setMinPeriod(parameters.max_pitch_hz);
+
+    yin_estimator_.setMaxPeriod(parameters.min_pitch_hz);
+    yin_estimator_.setMinPeriod(parameters.max_pitch_hz);
+    yin_estimator_.setThreshold(parameters.yin_threshold);
+
+    for (int i = first_stage; i < STAGE_COUNT; i++) {
+        auto stage = static_cast<Stage>(i);
+
+        if (is_valid_[stage] &&
+            !settingsDiffer(stage, computed_with_[stage], parameters)) {
+            continue;
+        }
+
+        invalidate(stage);
+        auto completed = true;
+
+        switch (stage) {
+            case STAGE_PITCH_FILTER:
+                filterPitch(parameters);
+                break;
+
+            case STAGE_LPC_FILTER:
+                filterLpc(parameters);
+                break;
+
+            case STAGE_PITCH_ACF:
+                completed = correlatePitch(parameters, cancelled);
+                break;
+
+            case STAGE_LPC_ACF:
+                completed = correlateLpc(parameters, cancelled);
+                break;
+
+            case STAGE_PITCH:
+                completed = estimatePitch(parameters.yin_enabled, cancelled);
+                break;
+
+            case STAGE_LPC:
+                completed = predict(cancelled);
+                break;
+
+            case STAGE_FRAMES:
+                assembleFrames();
+                break;
+
+            case STAGE_POSTPROC:
+                postProcess(parameters);
+                break;
+
+            case STAGE_SYNTHESIS:
+                synthesize();
+                break;
+
+            default:
+                break;
+        }
+
+        if (!completed) {
+            return false;
+        }
+
+        is_valid_[stage] = true;
+        computed_with_[stage] = parameters;
+        n_computations_[stage]++;
+
+        if (cancelled()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+const std::vector<float> &AnalysisPipeline::getFilteredSamples() const {
+    return filtered_samples_;
+}
+
+const std::vector<Frame> &AnalysisPipeline::getFrames() const {
+    return frames_;
+}
+
+const std::vector<float> &AnalysisPipeline::getSynthesizedSamples() const {
+    return synthesized_samples_;
+}
+
+int AnalysisPipeline::getMaxPitchHz() const {
+    return pitch_estimator_.getMaxFrq();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Metadata ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int AnalysisPipeline::getNComputations(Stage stage) const {
+    return n_computations_[stage];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Stages /////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void AnalysisPipeline::filterPitch(const AnalysisParameters &parameters) {
+    pitch_filtered_ = source_.copy();
+
+    auto filter_bank = FilterBank();
+
+    if (parameters.pitch_hpf_enabled) {
+        filter_bank.addHighpass(parameters.pitch_hpf_cutoff_hz);
+    }
+
+    if (parameters.pitch_lpf_enabled) {
+        filter_bank.addLowpass(parameters.pitch_lpf_cutoff_hz);
+    }
+
+    if (parameters.pitch_pre_emphasis_enabled) {
+        filter_bank.addPreEmphasis(parameters.pitch_pre_emphasis_alpha);
+    }
+
+    filter_bank.apply(pitch_filtered_);
+    filtered_samples_ = pitch_filtered_.getSamples();
+}
+
+void AnalysisPipeline::filterLpc(const AnalysisParameters &parameters) {
+    lpc_filtered_ = source_.copy();
+
+    auto filter_bank = FilterBank();
+
+    if (parameters.lpc_hpf_enabled) {
+        filter_bank.addHighpass(parameters.lpc_hpf_cutoff_hz);
+    }
+
+    if (parameters.lpc_lpf_enabled) {
+        filter_bank.addLowpass(parameters.lpc_lpf_cutoff_hz);
+    }
+
+    if (parameters.lpc_pre_emphasis_enabled) {
+        filter_bank.addPreEmphasis(parameters.lpc_pre_emphasis_alpha);
+    }
+
+    filter_bank.apply(lpc_filtered_);
+}
+
+bool AnalysisPipeline::correlatePitch(const AnalysisParameters &parameters,
+    const std::function<bool()> &is_cancelled) {
+    //
+    // Segmentation is applied to a copy, such that changing the window width
+    // does not require the input to be filtered again
+    pitch_buffer_ = pitch_filtered_.copy();
+    pitch_buffer_.setWindowWidthMs(parameters.window_width_ms);
+    pitch_acfs_.clear();
+
+    for (const auto &segment : pitch_buffer_.getAllSegments()) {
+        if (is_cancelled()) {
+            return false;
+        }
+
+        pitch_acfs_.push_back(tms_express::Autocorrelation(segment));
+    }
+
+    return true;
+}
+
+bool AnalysisPipeline::correlateLpc(const AnalysisParameters &parameters,
+    const std::function<bool()> &is_cancelled) {
+    //
+    lpc_buffer_ = lpc_filtered_.copy();
+    lpc_buffer_.setWindowWidthMs(parameters.window_width_ms);
+    lpc_acfs_.clear();
+
+    for (const auto &segment : lpc_buffer_.getAllSegments()) {
+        if (is_cancelled()) {
+            return false;
+        }
+
+        lpc_acfs_.push_back(
+            tms_express::Autocorrelation(segment, kModelOrder + 1));
+    }
+
+    return true;
+}
+
+bool AnalysisPipeline::estimatePitch(bool yin_enabled,
+    const std::function<bool()> &is_cancelled) {
+    //
+    pitch_periods_.clear();
+
+    for (int i = 0; i < static_cast<int>(pitch_acfs_.size()); i++) {
+        if (is_cancelled()) {
+            return false;
+        }
+
+        const auto &acf = pitch_acfs_[i];
+        auto period = yin_enabled ?
+            yin_estimator_.estimatePeriod(pitch_buffer_.getSegment(i), acf) :
+            static_cast<float>(pitch_estimator_.estimatePeriod(acf));
+
+        pitch_periods_.push_back(period);
+    }
+
+    return true;
+}
+
+bool AnalysisPipeline::predict(const std::function<bool()> &is_cancelled) {
+    coeffs_.clear();
+    gains_.clear();
+
+    for (const auto &acf : lpc_acfs_) {
+        if (is_cancelled()) {
+            return false;
+        }
+
+        coeffs_.push_back(linear_predictor_.computeCoeffs(acf));
+        gains_.push_back(linear_predictor_.gain());
+    }
+
+    return true;
+}
+
+void AnalysisPipeline::assembleFrames() {
+    raw_frames_.clear();
+    voicing_classifier_.reset(VoicingClassifier::peakEnergy(
+        pitch_buffer_.getData(), pitch_buffer_.getNSamples(),
+        pitch_buffer_.getNSamplesPerSegment()));
+
+    // The voicing classifier carries hysteresis from segment to segment, and
+    // so must visit every segment in order
+    for (int i = 0; i < static_cast<int>(coeffs_.size()); i++) {
+        auto period = pitch_periods_[i];
+        auto is_voiced = voicing_classifier_.classify(
+            pitch_buffer_.getSegment(i), pitch_acfs_[i], period,
+            lpc_buffer_.getSegment(i), coeffs_[i][0]);
+
+        raw_frames_.emplace_back(period, is_voiced, gains_[i], coeffs_[i]);
+    }
+}
+
+void AnalysisPipeline::postProcess(const AnalysisParameters &parameters) {
+    // Post-processing always starts over from the raw Frame table, which is
+    // cheap compared to analysis
+    frames_ = raw_frames_;
+    auto post_processor = FramePostprocessor(&frames_,
+        parameters.max_voiced_gain_db, parameters.max_unvoiced_gain_db);
+
+    if (parameters.gain_normalization_enabled) {
+        post_processor.normalizeGain();
+    }
+
+    // Perform either a pitch shift or a fixed-pitch offset
+    if (parameters.pitch_shift_enabled) {
+        post_processor.shiftPitch(parameters.pitch_shift);
+
+    } else if (parameters.pitch_override_enabled) {
+        post_processor.overridePitch(parameters.pitch_override);
+    }
+
+    if (parameters.repeat_frames_enabled) {
+        post_processor.detectRepeatFrames();
+    }
+
+    if (parameters.gain_shift_enabled) {
+        post_processor.shiftGain(parameters.gain_shift);
+    }
+}
+
+void AnalysisPipeline::synthesize() {
+    auto synthesizer = Synthesizer();
+    synthesized_samples_ = synthesizer.synthesize(frames_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool AnalysisPipeline::settingsDiffer(Stage stage, const AnalysisParameters &a,
+    const AnalysisParameters &b) {
+    //
+    switch (stage) {
+        case STAGE_PITCH_FILTER:
+            return std::tie(a.pitch_hpf_enabled, a.pitch_hpf_cutoff_hz,
+                a.pitch_lpf_enabled, a.pitch_lpf_cutoff_hz,
+                a.pitch_pre_emphasis_enabled, a.pitch_pre_emphasis_alpha) !=
+                std::tie(b.pitch_hpf_enabled, b.pitch_hpf_cutoff_hz,
+                b.pitch_lpf_enabled, b.pitch_lpf_cutoff_hz,
+                b.pitch_pre_emphasis_enabled, b.pitch_pre_emphasis_alpha);
+
+        case STAGE_LPC_FILTER:
+            return std::tie(a.lpc_hpf_enabled, a.lpc_hpf_cutoff_hz,
+                a.lpc_lpf_enabled, a.lpc_lpf_cutoff_hz,
+                a.lpc_pre_emphasis_enabled, a.lpc_pre_emphasis_alpha) !=
+                std::tie(b.lpc_hpf_enabled, b.lpc_hpf_cutoff_hz,
+                b.lpc_lpf_enabled, b.lpc_lpf_cutoff_hz,
+                b.lpc_pre_emphasis_enabled, b.lpc_pre_emphasis_alpha);
+
+        case STAGE_PITCH_ACF:
+        case STAGE_LPC_ACF:
+            return a.window_width_ms != b.window_width_ms;
+
+        case STAGE_PITCH:
+            return std::tie(a.min_pitch_hz, a.max_pitch_hz, a.yin_enabled,
+                a.yin_threshold) != std::tie(b.min_pitch_hz, b.max_pitch_hz,
+                b.yin_enabled, b.yin_threshold);
+
+        case STAGE_POSTPROC:
+            return std::tie(a.max_unvoiced_gain_db, a.max_voiced_gain_db,
+                a.gain_normalization_enabled, a.pitch_shift_enabled,
+                a.pitch_shift, a.pitch_override_enabled, a.pitch_override,
+                a.repeat_frames_enabled, a.gain_shift_enabled,
+                a.gain_shift) != std::tie(b.max_unvoiced_gain_db,
+                b.max_voiced_gain_db, b.gain_normalization_enabled,
+                b.pitch_shift_enabled, b.pitch_shift,
+                b.pitch_override_enabled, b.pitch_override,
+                b.repeat_frames_enabled, b.gain_shift_enabled, b.gain_shift);
+
+        // The remaining stages are fully determined by their inputs
+        default:
+            return false;
+    }
+}
+
+void AnalysisPipeline::invalidate(Stage stage) {
+    is_valid_[stage] = false;
+
+    // Stages are ordered such that every dependency precedes its dependents,
+    // so a single forward sweep propagates invalidation transitively
+    for (int i = stage + 1; i < STAGE_COUNT; i++) {
+        auto is_stale = false;
+
+        switch (i) {
+            case STAGE_PITCH_ACF:
+                is_stale = !is_valid_[STAGE_PITCH_FILTER];
+                break;
+
+            case STAGE_LPC_ACF:
+                is_stale = !is_valid_[STAGE_LPC_FILTER];
+                break;
+
+            case STAGE_PITCH:
+                is_stale = !is_valid_[STAGE_PITCH_ACF];
+                break;
+
+            case STAGE_LPC:
+                is_stale = !is_valid_[STAGE_LPC_ACF];
+                break;
+
+            case STAGE_FRAMES:
+                is_stale = !is_valid_[STAGE_PITCH] || !is_valid_[STAGE_LPC];
+                break;
+
+            case STAGE_POSTPROC:
+                is_stale = !is_valid_[STAGE_FRAMES];
+                break;
+
+            case STAGE_SYNTHESIS:
+                is_stale = !is_valid_[STAGE_POSTPROC];
+                break;
+
+            default:
+                break;
+        }
+
+        if (is_stale) {
+            is_valid_[i] = false;
+        }
+    }
+}
+
+};  // namespace tms_express
@@ -0,0 +1,270 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_BITSTREAM_GENERATION_ANALYSISPIPELINE_HPP_
+#define TMS_EXPRESS_BITSTREAM_GENERATION_ANALYSISPIPELINE_HPP_
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "encoding/Frame.hpp"
+#include "analysis/LinearPredictor.hpp"
+#include "analysis/PitchEstimator.hpp"
+#include "analysis/VoicingClassifier.hpp"
+#include "analysis/YinPitchEstimator.hpp"
+
+namespace tms_express {
+
+/// @brief Snapshot of every Control Panel setting which affects analysis,
+///         taken on the UI thread such that analysis never reads widgets
+struct AnalysisParameters {
+    // Pitch analysis
+    bool pitch_hpf_enabled = false;
+    int pitch_hpf_cutoff_hz = 0;
+    bool pitch_lpf_enabled = false;
+    int pitch_lpf_cutoff_hz = 0;
+    bool pitch_pre_emphasis_enabled = false;
+    float pitch_pre_emphasis_alpha = 0.0f;
+    int min_pitch_hz = 50;
+    int max_pitch_hz = 500;
+    bool yin_enabled = false;
+    float yin_threshold = 0.1f;
+
+    // LPC analysis
+    float window_width_ms = 25.0f;
+    bool lpc_hpf_enabled = false;
+    int lpc_hpf_cutoff_hz = 0;
+    bool lpc_lpf_enabled = false;
+    int lpc_lpf_cutoff_hz = 0;
+    bool lpc_pre_emphasis_enabled = false;
+    float lpc_pre_emphasis_alpha = 0.0f;
+
+    // Post-processing
+    float max_unvoiced_gain_db = 37.5f;
+    float max_voiced_gain_db = 37.5f;
+    bool gain_normalization_enabled = false;
+    bool pitch_shift_enabled = false;
+    int pitch_shift = 0;
+    bool pitch_override_enabled = false;
+    int pitch_override = 0;
+    bool repeat_frames_enabled = false;
+    bool gain_shift_enabled = false;
+    int gain_shift = 0;
+};
+
+/// @brief Analyzes, post-processes, and synthesizes audio incrementally
+/// @details The pipeline is a chain of stages, each of which caches its
+///             output along with the settings from which it was computed.
+///             When run with new settings, a stage is recomputed only if one
+///             of its own settings has changed or if a stage on which it
+///             depends was recomputed. Editing a post-processing setting thus
+///             costs only post-processing and synthesis, while editing the
+///             pitch filters leaves the LPC filter, autocorrelation, and
+///             coefficients untouched
+class AnalysisPipeline {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Enums //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Pipeline stages, in order of evaluation
+    enum Stage {
+        STAGE_PITCH_FILTER,
+        STAGE_LPC_FILTER,
+        STAGE_PITCH_ACF,
+        STAGE_LPC_ACF,
+        STAGE_PITCH,
+        STAGE_LPC,
+        STAGE_FRAMES,
+        STAGE_POSTPROC,
+        STAGE_SYNTHESIS,
+        STAGE_COUNT
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new, empty Analysis Pipeline
+    AnalysisPipeline();
+
+    /// @brief Replaces the input audio, invalidating every stage
+    /// @param source Decoded input audio
+    void setSource(const AudioBuffer &source);
+
+    /// @brief Replaces the input audio with an imported Frame table, which
+    ///         is post-processed and synthesized without analysis
+    /// @param frames Imported Frame table
+    void setFrames(const std::vector<Frame> &frames);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Evaluation /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Brings every stage up to date with the given settings
+    /// @param parameters Settings with which to analyze
+    /// @param is_cancelled Callback which is polled between segments, and
+    ///                     which returns true if the run should be abandoned
+    /// @return true if every stage is up to date, false if cancelled
+    /// @note Stages completed before cancellation remain cached, and the
+    ///         abandoned stage is recomputed by the next run
+    bool run(const AnalysisParameters &parameters,
+        const std::function<bool()> &is_cancelled = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the input audio, as filtered for pitch analysis
+    /// @return Filtered input audio, or empty if a Frame table was imported
+    const std::vector<float> &getFilteredSamples() const;
+
+    /// @brief Accesses the post-processed Frame table
+    /// @return Frame table
+    const std::vector<Frame> &getFrames() const;
+
+    /// @brief Accesses the audio synthesized from the Frame table
+    /// @return Synthesized samples
+    const std::vector<float> &getSynthesizedSamples() const;
+
+    /// @brief Accesses the highest pitch representable by the pitch estimator
+    /// @return Max pitch, in Hertz
+    int getMaxPitchHz() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Metadata ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Counts the computations of a stage since initialization
+    /// @param stage Pipeline stage
+    /// @return Number of times the stage has been computed
+    int getNComputations(Stage stage) const;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Stages /////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Filters the input audio for pitch analysis
+    void filterPitch(const AnalysisParameters &parameters);
+
+    /// @brief Filters the input audio for LPC analysis
+    void filterLpc(const AnalysisParameters &parameters);
+
+    /// @brief Computes the autocorrelation of each pitch segment
+    /// @return true if completed, false if cancelled
+    bool correlatePitch(const AnalysisParameters &parameters,
+        const std::function<bool()> &is_cancelled);
+
+    /// @brief Computes the leading autocorrelation lags of each LPC segment
+    /// @return true if completed, false if cancelled
+    bool correlateLpc(const AnalysisParameters &parameters,
+        const std::function<bool()> &is_cancelled);
+
+    /// @brief Estimates the pitch period of each segment
+    /// @return true if completed, false if cancelled
+    bool estimatePitch(bool yin_enabled,
+        const std::function<bool()> &is_cancelled);
+
+    /// @brief Computes the reflector coefficients and gain of each segment
+    /// @return true if completed, false if cancelled
+    bool predict(const std::function<bool()> &is_cancelled);
+
+    /// @brief Classifies the voicing of each segment and assembles the raw
+    ///         Frame table
+    void assembleFrames();
+
+    /// @brief Post-processes the raw Frame table
+    void postProcess(const AnalysisParameters &parameters);
+
+    /// @brief Synthesizes the post-processed Frame table
+    void synthesize();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Checks whether the settings read by a stage differ between two
+    ///         snapshots
+    /// @param stage Pipeline stage
+    /// @param a First snapshot
+    /// @param b Second snapshot
+    /// @return true if the stage would produce different output, false
+    ///         otherwise
+    static bool settingsDiffer(Stage stage, const AnalysisParameters &a,
+        const AnalysisParameters &b);
+
+    /// @brief Marks a stage, and every stage which depends on it, as out of
+    ///         date
+    /// @param stage Pipeline stage
+    void invalidate(Stage stage);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief true if each stage's cached output is up to date with the
+    ///         settings it was computed from
+    std::array<bool, STAGE_COUNT> is_valid_;
+
+    /// @brief Settings from which each stage's cached output was computed
+    std::array<AnalysisParameters, STAGE_COUNT> computed_with_;
+
+    /// @brief Number of computations of each stage
+    std::array<int, STAGE_COUNT> n_computations_;
+
+    /// @brief true if the input is audio, false if an imported Frame table
+    bool has_source_;
+
+    /// @brief Unfiltered input audio
+    AudioBuffer source_;
+
+    /// @brief Input audio, as filtered for pitch analysis
+    AudioBuffer pitch_filtered_;
+
+    /// @brief Input audio, as filtered for LPC analysis
+    AudioBuffer lpc_filtered_;
+
+    /// @brief Filtered pitch audio, segmented by the analysis window
+    AudioBuffer pitch_buffer_;
+
+    /// @brief Filtered LPC audio, segmented by the analysis window
+    AudioBuffer lpc_buffer_;
+
+    /// @brief Autocorrelation of each pitch segment
+    std::vector<std::vector<float>> pitch_acfs_;
+
+    /// @brief Leading autocorrelation lags of each LPC segment
+    std::vector<std::vector<float>> lpc_acfs_;
+
+    /// @brief Pitch period of each segment, in samples
+    std::vector<float> pitch_periods_;
+
+    /// @brief Reflector coefficients of each segment
+    std::vector<std::vector<float>> coeffs_;
+
+    /// @brief Predictor gain of each segment
+    std::vector<float> gains_;
+
+    /// @brief Frame table prior to post-processing
+    std::vector<Frame> raw_frames_;
+
+    /// @brief Post-processed Frame table
+    std::vector<Frame> frames_;
+
+    /// @brief Audio synthesized from the post-processed Frame table
+    std::vector<float> synthesized_samples_;
+
+    /// @brief Pitch filtered samples, as exposed to callers
+    std::vector<float> filtered_samples_;
+
+    PitchEstimator pitch_estimator_;
+    YinPitchEstimator yin_estimator_;
+    LinearPredictor linear_predictor_;
+    VoicingClassifier voicing_classifier_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_BITSTREAM_GENERATION_ANALYSISPIPELINE_HPP_
@@ -2,20 +2,37 @@
 
 #include "bitstream/BitstreamGenerator.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "audio/AudioBuffer.hpp"
-#include "audio/AudioFilter.hpp"
+#include "audio/AudioCache.hpp"
+#include "audio/FilterBank.hpp"
+#include "audio/Resampler.hpp"
+#include "bitstream/FrameAnalyzer.hpp"
+#include "bitstream/FrameCache.hpp"
+#include "encoding/CoefficientQuantizer.hpp"
 #include "encoding/Frame.hpp"
 #include "encoding/FrameEncoder.hpp"
 #include "encoding/FramePostprocessor.hpp"
-#include "analysis/Autocorrelation.hpp"
-#include "analysis/LinearPredictor.hpp"
-#include "analysis/PitchEstimator.hpp"
+#include "encoding/RateController.hpp"
+#include "encoding/Synthesizer.hpp"
+#include "analysis/ParallelFor.hpp"
+#include "analysis/QualityMetrics.hpp"
+#include "stats/EncoderStats.hpp"
+#include "stats/Tracer.hpp"
 
 namespace tms_express {
 
@@ -37,51 +54,171 @@ BitstreamGenerator::BitstreamGenerator(float window_width_ms,
     detect_repeat_frames_ = detect_repeat_frames;
     max_pitch_hz_ = max_pitch_hz;
     min_pitch_hz_ = min_pitch_hz;
+    pitch_algorithm_ = FrameAnalyzer::PITCHALGORITHM_ACF;
+    yin_threshold_ = 0.1f;
+    pitch_decimation_ = 1;
+    voicing_hysteresis_ = 0.0f;
+    filter_order_ = 2;
+    resample_quality_ = AudioBuffer::RESAMPLEQUALITY_SINC_BEST;
+    cache_directory_ = "";
+    closed_loop_quantization_ = false;
+    repeat_distortion_db_ = 0.0f;
+    max_repeat_chain_ = 4;
+    max_spectral_change_db_ = 0.0f;
+    max_bytes_ = 0;
+    max_bits_per_second_ = 0.0f;
+    n_threads_ = 0;
+    n_analysis_cache_hits_ = 0;
+    n_analysis_cache_misses_ = 0;
+}
+
+void BitstreamGenerator::setPitchAlgorithm(PitchAlgorithm algorithm,
+    float yin_threshold) {
+    //
+    pitch_algorithm_ = algorithm;
+    yin_threshold_ = yin_threshold;
+}
+
+void BitstreamGenerator::setPitchDecimation(int factor) {
+    pitch_decimation_ = factor;
+}
+
+void BitstreamGenerator::setVoicingHysteresis(float hysteresis) {
+    voicing_hysteresis_ = hysteresis;
+}
+
+void BitstreamGenerator::setFilterOrder(int order) {
+    filter_order_ = order;
+}
+
+void BitstreamGenerator::setThreads(int n_threads) {
+    n_threads_ = n_threads;
+}
+
+void BitstreamGenerator::setResampleQuality(
+    AudioBuffer::ResampleQuality quality) {
+    //
+    resample_quality_ = quality;
+}
+
+void BitstreamGenerator::setCacheDirectory(const std::string &directory) {
+    cache_directory_ = directory;
+}
+
+void BitstreamGenerator::setClosedLoopQuantization(bool enabled) {
+    closed_loop_quantization_ = enabled;
+}
+
+void BitstreamGenerator::setRepeatDistortion(float distortion_db,
+    int max_repeat_chain) {
+    //
+    repeat_distortion_db_ = distortion_db;
+    max_repeat_chain_ = max_repeat_chain;
+}
+
+void BitstreamGenerator::setVariableFrameRate(float max_change_db) {
+    max_spectral_change_db_ = max_change_db;
+}
+
+void BitstreamGenerator::setBudget(int max_bytes, float max_bits_per_second) {
+    max_bytes_ = max_bytes;
+    max_bits_per_second_ = max_bits_per_second;
 }
 
 void BitstreamGenerator::encode(const std::string &audio_input_path,
-    const std::string &bitstream_name, const std::string &output_path) const {
+    const std::string &bitstream_name, const std::string &output_path,
+    QualityMetrics::Report *report, RateController::Result *rate) const {
+    auto scope = Tracer::Scope(bitstream_name, "file");
+
     // Perform LPC analysis and convert audio data to a bitstream
-    auto frames = generateFrames(audio_input_path);
-    auto bitstream = serializeFrames(frames, bitstream_name);
+    auto frames = generateFrames(audio_input_path, report, rate);
+    auto bitstream = std::string();
 
-    // Write bitstream to disk
-    std::ofstream lpcOut;
-    lpcOut.open(output_path);
-    lpcOut << bitstream;
-    lpcOut.close();
+    {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_SERIALIZE);
+        bitstream = serializeFrames(frames, bitstream_name);
+    }
+
+    writeBitstream(bitstream, output_path);
 }
 
 void BitstreamGenerator::encodeBatch(
     const std::vector<std::string> &audio_input_paths,
     const std::vector<std::string> &bitstream_names,
-    const std::string &output_path) const {
-    std::string in_path, filename;
+    const std::string &output_path,
+    std::vector<QualityMetrics::Report> *reports,
+    std::vector<RateController::Result> *rates) const {
+    //
+    auto n_files = static_cast<int>(audio_input_paths.size());
+
+    if (reports != nullptr) {
+        reports->resize(n_files);
+    }
+
+    if (rates != nullptr) {
+        rates->resize(n_files);
+    }
 
     if (style_ == ENCODERSTYLE_ASCII) {
         // Create directory to populate with encoded files
         std::filesystem::create_directory(output_path);
+    }
 
-        for (int i = 0; i < static_cast<int>(audio_input_paths.size()); i++) {
-            in_path = audio_input_paths[i];
-            filename = bitstream_names[i];
-
-            std::filesystem::path out_path = output_path;
-            out_path /= (filename + ".lpc");
+    // Quality metrics are computed in parallel in their own right, and are
+    // confined to a single thread per file when files are encoded in parallel
+    auto n_threads = (n_threads_ > 0) ? n_threads_ :
+        static_cast<int>(std::thread::hardware_concurrency());
+    auto n_metrics_threads = (std::min(n_threads, n_files) > 1) ? 1 : 0;
+
+    // Each file collects into Encoder Stats of its own, as workers do not
+    // share the stats of the calling thread, which are updated once the file
+    // is complete
+    auto stats = EncoderStats::active();
+    auto stats_mutex = std::mutex();
+    auto bitstreams = std::vector<std::string>(n_files);
+
+    ParallelFor(n_files, n_threads_, [&](int i) {
+        auto file_stats = EncoderStats();
+
+        {
+            auto collector = EncoderStats::Collector(
+                (stats != nullptr) ? &file_stats : nullptr);
+            auto scope = Tracer::Scope(bitstream_names[i], "file");
+
+            auto frames = generateFrames(audio_input_paths[i],
+                (reports != nullptr) ? &reports->at(i) : nullptr,
+                (rates != nullptr) ? &rates->at(i) : nullptr,
+                n_metrics_threads);
+
+            {
+                auto timer = EncoderStats::ScopedTimer(
+                    EncoderStats::STAGE_SERIALIZE);
+
+                bitstreams[i] = serializeFrames(frames, bitstream_names[i]);
+            }
+
+            if (style_ == ENCODERSTYLE_ASCII) {
+                auto out_path = std::filesystem::path(output_path) /
+                    (bitstream_names[i] + ".lpc");
+
+                writeBitstream(bitstreams[i], out_path.string());
+                bitstreams[i].clear();
+            }
+        }
 
-            encode(in_path, filename, out_path.string());
+        if (stats != nullptr) {
+            auto lock = std::lock_guard<std::mutex>(stats_mutex);
+            stats->merge(file_stats);
         }
-    } else {
-        std::ofstream lpcOut;
-        lpcOut.open(output_path);
+    });
 
-        for (int i = 0; i < static_cast<int>(audio_input_paths.size()); i++) {
-            in_path = audio_input_paths[i];
-            filename = bitstream_names[i];
+    if (style_ != ENCODERSTYLE_ASCII) {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_WRITE);
 
-            auto frames = generateFrames(in_path);
-            auto bitstream = serializeFrames(frames, filename);
+        std::ofstream lpcOut;
+        lpcOut.open(output_path);
 
+        for (const auto &bitstream : bitstreams) {
             lpcOut << bitstream << std::endl;
         }
 
@@ -89,84 +226,336 @@ void BitstreamGenerator::encodeBatch(
     }
 }
 
+std::vector<Frame> BitstreamGenerator::encodeFrames(
+    const std::vector<float> &samples, int sample_rate_hz,
+    QualityMetrics::Report *report, RateController::Result *rate) const {
+    //
+    auto source_samples = std::vector<float>();
+
+    if (sample_rate_hz == 8000) {
+        source_samples = samples;
+
+    } else {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_RESAMPLE);
+        auto resampler = Resampler(sample_rate_hz, 8000, resample_quality_);
+
+        resampler.process(samples.data(), static_cast<int>(samples.size()),
+            source_samples);
+        resampler.flush(source_samples);
+    }
+
+    auto lpc_buffer = AudioBuffer(source_samples, 8000, window_width_ms_);
+    auto frames = analyzeBuffer(lpc_buffer);
+
+    finalizeFrames(frames, source_samples, report, rate);
+    return frames;
+}
+
+std::vector<std::byte> BitstreamGenerator::encodeBytes(
+    const std::vector<float> &samples, int sample_rate_hz,
+    RateController::Result *rate) const {
+    //
+    auto frames = encodeFrames(samples, sample_rate_hz, nullptr, rate);
+
+    auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_SERIALIZE);
+    return FrameEncoder(frames).toBytes(include_stop_frame_);
+}
+
+std::string BitstreamGenerator::encodeBitstream(
+    const std::vector<float> &samples, int sample_rate_hz,
+    const std::string &bitstream_name, RateController::Result *rate) const {
+    //
+    auto frames = encodeFrames(samples, sample_rate_hz, nullptr, rate);
+
+    auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_SERIALIZE);
+    return serializeFrames(frames, bitstream_name);
+}
+
+int BitstreamGenerator::getAnalysisCacheHits() const {
+    return n_analysis_cache_hits_;
+}
+
+int BitstreamGenerator::getAnalysisCacheMisses() const {
+    return n_analysis_cache_misses_;
+}
+
+int BitstreamGenerator::getFilterOrder() const {
+    return filter_order_;
+}
+
+AudioBuffer::ResampleQuality BitstreamGenerator::getResampleQuality() const {
+    return resample_quality_;
+}
+
+FrameAnalyzer BitstreamGenerator::getAnalyzer() const {
+    auto analyzer = FrameAnalyzer(min_pitch_hz_, max_pitch_hz_);
+    analyzer.setPitchAlgorithm(pitch_algorithm_, yin_threshold_);
+    analyzer.setPitchDecimation(pitch_decimation_);
+    analyzer.setVoicingHysteresis(voicing_hysteresis_);
+    analyzer.setSpectralChange(max_spectral_change_db_ > 0.0f);
+
+    return analyzer;
+}
+
 std::vector<Frame> BitstreamGenerator::generateFrames(
-    const std::string &path) const {
-    // Mix audio to 8kHz mono and store in a segmented buffer
-    // TODO(Joseph Bellahcen): Handle nullptr
-    auto lpc_buffer = *AudioBuffer::Create(path, 8000, window_width_ms_);
+    const std::string &path, QualityMetrics::Report *report,
+    RateController::Result *rate, int n_metrics_threads) const {
+    //
+    auto source_samples = std::vector<float>();
+    auto frames = analyzeFrames(path,
+        (report != nullptr) ? &source_samples : nullptr);
+
+    finalizeFrames(frames, source_samples, report, rate, n_metrics_threads);
+    return frames;
+}
 
-    // Copy the buffer so that upper and lower vocal tract analysis may occur
-    // separately
-    auto pitch_buffer = lpc_buffer.copy();
+void BitstreamGenerator::finalizeFrames(std::vector<Frame> &frames,
+    const std::vector<float> &source_samples, QualityMetrics::Report *report,
+    RateController::Result *rate, int n_metrics_threads) const {
+    //
+    auto result = RateController::Result();
+    {
+        auto timer = EncoderStats::ScopedTimer(
+            EncoderStats::STAGE_POSTPROCESS);
+
+        result = postprocessFrames(frames);
+    }
+
+    if (rate != nullptr) {
+        *rate = result;
+    }
+
+    if (EncoderStats::active() != nullptr) {
+        countFrames(frames, result);
+    }
+
+    // Score the frames exactly as they will be heard
+    if (report != nullptr) {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_METRICS);
+        auto synthesizer = Synthesizer(8000, window_width_ms_);
+        auto metrics = QualityMetrics(8000, window_width_ms_);
+        metrics.setThreads(n_metrics_threads);
+
+        *report = metrics.evaluate(source_samples,
+            synthesizer.synthesize(frames));
+    }
+}
+
+std::shared_ptr<AudioBuffer> BitstreamGenerator::loadAudio(
+    const std::string &path, uint32_t checksum, uint64_t size) const {
+    //
+    // Mix audio to 8kHz mono and store in a segmented buffer, skipping the
+    // decode entirely if the cache holds a previous result
+    auto input_buffer = std::shared_ptr<AudioBuffer>();
+
+    if (!cache_directory_.empty()) {
+        auto cache = AudioCache(cache_directory_);
+        input_buffer = cache.load(path, checksum, size, 8000,
+            window_width_ms_, resample_quality_);
+
+    } else {
+        input_buffer = AudioBuffer::Create(path, 8000, window_width_ms_,
+            resample_quality_);
+    }
+
+    if (input_buffer == nullptr) {
+        throw std::runtime_error("Could not read audio file: " + path);
+    }
+
+    return input_buffer;
+}
+
+std::vector<Frame> BitstreamGenerator::analyzeFrames(const std::string &path,
+    std::vector<float> *source_samples) const {
+    //
+    // Post-processing is cheap compared to analysis, so the raw frames are
+    // cached such that sweeps over post-processing settings skip analysis.
+    // Both caches are keyed by the contents of the audio file, which is
+    // therefore checksummed only once
+    auto frame_cache = std::unique_ptr<FrameCache>();
+    auto cache_key = std::string();
+    uint32_t checksum = 0;
+    uint64_t size = 0;
+
+    if (!cache_directory_.empty()) {
+        if (!AudioCache::checksumFile(path, checksum, size)) {
+            throw std::runtime_error("Could not read audio file: " + path);
+        }
+
+        frame_cache = std::make_unique<FrameCache>(cache_directory_);
+        cache_key = FrameCache::makeKey(checksum, size,
+            describeAnalysisParameters());
+
+        auto cached_frames = std::vector<Frame>();
+
+        if (frame_cache->load(cache_key, cached_frames)) {
+            n_analysis_cache_hits_++;
+
+            if (source_samples != nullptr) {
+                *source_samples = loadAudio(path, checksum, size)->
+                    getSamples();
+            }
+
+            return cached_frames;
+        }
 
+        n_analysis_cache_misses_++;
+    }
+
+    auto input_buffer = loadAudio(path, checksum, size);
+
+    if (source_samples != nullptr) {
+        *source_samples = input_buffer->getSamples();
+    }
+
+    auto frames = analyzeBuffer(*input_buffer);
+
+    if (frame_cache != nullptr) {
+        frame_cache->store(cache_key, frames);
+    }
+
+    return frames;
+}
+
+std::vector<Frame> BitstreamGenerator::analyzeBuffer(
+    AudioBuffer &lpc_buffer) const {
     // Apply preprocessing
     //
     // The pitch buffer will ONLY be lowpass-filtered, as pitch is a
     // low-frequency component of the signal. Neither highpass filtering nor
     // pre-emphasis, which exaggerate high-frequency components, will improve
     // pitch estimation
-    auto preprocessor = AudioFilter();
-    preprocessor.applyPreEmphasis(lpc_buffer, pre_emphasis_alpha_);
-    preprocessor.applyHighpass(lpc_buffer, highpass_cutoff_hz_);
-    preprocessor.applyLowpass(pitch_buffer, lowpass_cutoff_hz_);
-
-    // Extract buffer metadata
-    //
-    // Only the LPC buffer is queried for metadata, since it will have the same
-    // number of samples as the pitch buffer. The sample rate of the buffer is
-    // extracted despite being known, as future iterations of TMS Express may
-    // support encoding 10kHz/variable sample rate audio for the TMS5200C
-    auto n_segments = lpc_buffer.getNSegments();
+    //
+    // Both branches are produced by a single pass over the input, which is
+    // filtered in place to become the LPC buffer. This avoids copying the
+    // input for the pitch branch and then traversing it once per filter
+    //
+    // The sample rate of the buffer is extracted despite being known, as
+    // future iterations of TMS Express may support encoding 10kHz/variable
+    // sample rate audio for the TMS5200C
     auto sample_rate = lpc_buffer.getSampleRateHz();
 
-    // Initialize analysis objects and data structures
-    auto linear_predictor = LinearPredictor();
-    auto pitch_estimator = PitchEstimator(sample_rate, min_pitch_hz_,
-        max_pitch_hz_);
-    auto frames = std::vector<Frame>();
+    auto lpc_filter_bank = FilterBank();
+    lpc_filter_bank.addPreEmphasis(pre_emphasis_alpha_);
+    lpc_filter_bank.addHighpass(highpass_cutoff_hz_, filter_order_);
 
-    for (int i = 0; i < n_segments; i++) {
-        // Get segment for frame
-        auto pitch_segment = pitch_buffer.getSegment(i);
-        auto lpc_segment = lpc_buffer.getSegment(i);
+    auto pitch_filter_bank = FilterBank();
+    pitch_filter_bank.addLowpass(lowpass_cutoff_hz_, filter_order_);
 
-        // Apply a window function to the segment to smoothen its boundaries
-        //
-        // Because information about the transition between adjacent frames is
-        // lost during segmentation, a window will help produce smoother results
-        preprocessor.applyHammingWindow(lpc_segment);
+    auto pitch_samples = std::vector<float>(lpc_buffer.getNSamples());
+    {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_FILTER);
 
-        // Compute the autocorrelation of each segment, which serves as the
-        // basis of all analysis
-        auto lpc_acf = tms_express::Autocorrelation(lpc_segment);
-        auto pitch_acf = tms_express::Autocorrelation(pitch_segment);
-
-        // Extract LPC reflector coefficients and compute the predictor gain
-        auto coeffs = linear_predictor.computeCoeffs(lpc_acf);
-        auto gain = linear_predictor.gain();
+        FilterBank::applySplit(lpc_buffer.getData(), lpc_buffer.getNSamples(),
+            sample_rate, lpc_filter_bank, lpc_buffer.getData(),
+            pitch_filter_bank, pitch_samples.data());
+    }
 
-        // Estimate pitch
-        auto pitch_period = pitch_estimator.estimatePeriod(pitch_acf);
+    EncoderStats::count(EncoderStats::COUNTER_SAMPLES,
+        lpc_buffer.getNSamples());
 
-        // Decide whether the segment is voiced or unvoiced
-        auto segment_is_voiced = coeffs[0] < 0;
+    auto pitch_buffer = AudioBuffer(sample_rate, window_width_ms_);
+    pitch_buffer.setSamples(std::move(pitch_samples));
 
-        // Store parameters in a Frame object
-        auto frame = Frame(pitch_period, segment_is_voiced, gain, coeffs);
-        frames.push_back(frame);
-    }
+    auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_ANALYSIS);
+    return getAnalyzer().analyze(lpc_buffer, pitch_buffer);
+}
 
-    // Apply post-processing
+RateController::Result BitstreamGenerator::postprocessFrames(
+    std::vector<Frame> &frames) const {
+    //
     auto post_processor = FramePostprocessor(&frames, main_voiced_gain_db_,
         max_unvoiced_gain_db_);
     post_processor.normalizeGain();
     post_processor.shiftGain(gain_shift_);
 
-    if (detect_repeat_frames_) {
+    // Quantization follows the gain adjustments, which determine the frames
+    // that are silent, and precedes repeat detection, which compares the
+    // quantized coefficients
+    if (closed_loop_quantization_) {
+        auto quantizer = CoefficientQuantizer();
+        quantizer.apply(frames);
+    }
+
+    // The budget is the tighter of the byte and bitrate limits, if any
+    auto max_bytes = max_bytes_;
+
+    if (max_bits_per_second_ > 0.0f) {
+        auto bitrate_bytes = RateController::bytesForBitrate(
+            max_bits_per_second_, static_cast<int>(frames.size()),
+            window_width_ms_);
+
+        max_bytes = (max_bytes > 0) ?
+            std::min(max_bytes, bitrate_bytes) : bitrate_bytes;
+    }
+
+    auto rate_controller = RateController(max_bytes, include_stop_frame_);
+    rate_controller.setMaxRepeatChain(max_repeat_chain_);
+
+    if (max_bytes > 0) {
+        return rate_controller.fit(frames);
+
+    } else if (repeat_distortion_db_ > 0.0f) {
+        post_processor.setMaxRepeatChain(max_repeat_chain_);
+        post_processor.fitRepeatFramesToDistortion(repeat_distortion_db_);
+
+    } else if (max_spectral_change_db_ > 0.0f) {
+        post_processor.setMaxRepeatChain(max_repeat_chain_);
+        post_processor.adaptFrameRate(max_spectral_change_db_);
+
+    } else if (detect_repeat_frames_) {
         post_processor.detectRepeatFrames();
     }
 
-    return frames;
+    // Without a budget, the rate controller only measures the frames
+    return rate_controller.fit(frames);
+}
+
+void BitstreamGenerator::countFrames(const std::vector<Frame> &frames,
+    const RateController::Result &result) const {
+    //
+    EncoderStats::count(EncoderStats::COUNTER_FILES);
+    EncoderStats::count(EncoderStats::COUNTER_FRAMES,
+        static_cast<int64_t>(frames.size()));
+    EncoderStats::count(EncoderStats::COUNTER_BYTES, result.n_bytes);
+
+    for (const auto &frame : frames) {
+        if (frame.isSilent()) {
+            EncoderStats::count(EncoderStats::COUNTER_SILENT_FRAMES);
+
+        } else if (frame.isVoiced()) {
+            EncoderStats::count(EncoderStats::COUNTER_VOICED_FRAMES);
+
+        } else {
+            EncoderStats::count(EncoderStats::COUNTER_UNVOICED_FRAMES);
+        }
+
+        if (frame.isRepeat()) {
+            EncoderStats::count(EncoderStats::COUNTER_REPEAT_FRAMES);
+        }
+    }
+}
+
+std::string BitstreamGenerator::describeAnalysisParameters() const {
+    // Every setting read by analyzeFrames() must be described here, lest a
+    // stale analysis be served from the cache
+    auto parameters = std::ostringstream();
+    parameters.precision(9);
+    parameters << "window=" << window_width_ms_
+        << ";highpass=" << highpass_cutoff_hz_
+        << ";lowpass=" << lowpass_cutoff_hz_
+        << ";pre_emphasis=" << pre_emphasis_alpha_
+        << ";filter_order=" << filter_order_
+        << ";max_pitch=" << max_pitch_hz_
+        << ";min_pitch=" << min_pitch_hz_
+        << ";pitch_algorithm=" << pitch_algorithm_
+        << ";yin_threshold=" << yin_threshold_
+        << ";pitch_decimation=" << pitch_decimation_
+        << ";voicing_hysteresis=" << voicing_hysteresis_
+        << ";spectral_change=" << (max_spectral_change_db_ > 0.0f)
+        << ";resampler=" << resample_quality_;
+
+    return parameters.str();
 }
 
 std::string BitstreamGenerator::serializeFrames(
@@ -206,4 +595,15 @@ std::string BitstreamGenerator::serializeFrames(
     return bitstream;
 }
 
+void BitstreamGenerator::writeBitstream(const std::string &bitstream,
+    const std::string &path) const {
+    //
+    auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_WRITE);
+
+    std::ofstream lpcOut;
+    lpcOut.open(path);
+    lpcOut << bitstream;
+    lpcOut.close();
+}
+
 };  // namespace tms_express
@@ -3,10 +3,18 @@
 #ifndef TMS_EXPRESS_BITSTREAM_GENERATION_BITSTREAMGENERATOR_HPP_
 #define TMS_EXPRESS_BITSTREAM_GENERATION_BITSTREAMGENERATOR_HPP_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "analysis/QualityMetrics.hpp"
+#include "audio/AudioBuffer.hpp"
+#include "bitstream/FrameAnalyzer.hpp"
 #include "encoding/Frame.hpp"
+#include "encoding/RateController.hpp"
 
 namespace tms_express {
 
@@ -32,6 +40,9 @@ class BitstreamGenerator {
         ENCODERSTYLE_JSON
     };
 
+    /// @brief Defines the algorithm used to estimate the pitch of each segment
+    using PitchAlgorithm = FrameAnalyzer::PitchAlgorithm;
+
     ///////////////////////////////////////////////////////////////////////////
     // Initializers ///////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -57,6 +68,87 @@ class BitstreamGenerator {
         float max_unvoiced_gain_db, bool detect_repeat_frames,
         int max_pitch_hz, int min_pitch_hz);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration //////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Selects the pitch estimation algorithm
+    /// @param algorithm Pitch estimation algorithm
+    /// @param yin_threshold Absolute threshold of the YIN estimator, which is
+    ///                         ignored by other algorithms
+    void setPitchAlgorithm(PitchAlgorithm algorithm,
+        float yin_threshold = 0.1f);
+
+    /// @brief Enables the decimated autocorrelation pitch path
+    /// @param factor Decimation factor of the coarse pitch search, from 1
+    ///                 (full-rate search) to 4
+    /// @note Only the autocorrelation pitch estimator is affected, as the YIN
+    ///         estimator requires the full-rate autocorrelation
+    void setPitchDecimation(int factor);
+
+    /// @brief Sets the hysteresis of voicing decisions
+    /// @param hysteresis Distance of the voicing score from the decision
+    ///                     threshold required to change the decision, where
+    ///                     zero disables hysteresis
+    void setVoicingHysteresis(float hysteresis);
+
+    /// @brief Sets the order of the highpass and lowpass filters
+    /// @param order Butterworth filter order, where order 2 is a single biquad
+    void setFilterOrder(int order);
+
+    /// @brief Sets the number of files encoded concurrently by a batch
+    /// @param n_threads Number of threads, or zero to use every hardware
+    ///                     thread
+    void setThreads(int n_threads);
+
+    /// @brief Selects the algorithm used to resample audio to 8 kHz
+    /// @param quality Resampling algorithm
+    void setResampleQuality(AudioBuffer::ResampleQuality quality);
+
+    /// @brief Enables the decoded-audio and analysis caches
+    /// @param directory Directory in which to cache decoded and resampled
+    ///                     audio as well as raw analysis results, or an empty
+    ///                     string to disable caching
+    /// @note Analysis results are reused whenever only post-processing
+    ///         settings (gain shift, gain limits, repeat detection, and
+    ///         coefficient quantization) differ
+    void setCacheDirectory(const std::string &directory);
+
+    /// @brief Enables closed-loop quantization of reflector coefficients
+    /// @param enabled true to search neighboring Coding Table entries of the
+    ///                 low-order coefficients for the combination with the
+    ///                 least spectral distortion, false to round each
+    ///                 coefficient to its nearest entry
+    void setClosedLoopQuantization(bool enabled);
+
+    /// @brief Enables rate-distortion optimized selection of repeat and
+    ///         silent frames, which supersedes repeat frame detection
+    /// @param distortion_db Max mean spectral distortion of non-silent frames,
+    ///                         in decibels, or zero to disable optimization
+    /// @param max_repeat_chain Max number of consecutive repeat frames
+    void setRepeatDistortion(float distortion_db, int max_repeat_chain = 4);
+
+    /// @brief Enables variable frame rate encoding, in which frames within
+    ///         spectrally steady regions repeat their predecessors, which
+    ///         supersedes repeat frame detection
+    /// @param max_change_db Max spectral change between a fully-encoded frame
+    ///                         and its repeats, in decibels, or zero to
+    ///                         disable variable frame rate encoding
+    /// @note Repeat chains are limited to the max repeat chain length given to
+    ///         setRepeatDistortion()
+    void setVariableFrameRate(float max_change_db);
+
+    /// @brief Limits the size of each bitstream, which supersedes repeat
+    ///         frame detection and optimization
+    /// @param max_bytes Max size of each bitstream, in bytes, or zero for no
+    ///                     limit
+    /// @param max_bits_per_second Max bitrate of each bitstream, or zero for
+    ///                             no limit
+    /// @note Repeat frames, demotion of voiced frames to unvoiced, and
+    ///         silence are chosen to fit the tighter of the two limits with
+    ///         the least spectral distortion
+    void setBudget(int max_bytes, float max_bits_per_second = 0.0f);
+
     ///////////////////////////////////////////////////////////////////////////
     // Encoding ///////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -66,9 +158,14 @@ class BitstreamGenerator {
     /// @param bitstream_name Name of bitstream, for C headers, which will
     ///                         become the name of the byte array
     /// @param output_path Output path of bitstream file
+    /// @param report Destination of objective quality metrics, which compare
+    ///                 the audio file to the resynthesized bitstream, or
+    ///                 nullptr to skip their computation
+    /// @param rate Destination of the achieved bitstream size, or nullptr
     void encode(const std::string &audio_input_path,
-        const std::string &bitstream_name, const std::string &output_path)
-        const;
+        const std::string &bitstream_name, const std::string &output_path,
+        QualityMetrics::Report *report = nullptr,
+        RateController::Result *rate = nullptr) const;
 
     /// @brief Produces composite bitstream from multiple audio files
     /// @param audio_input_paths Vector of audio file paths as inputs
@@ -77,13 +174,99 @@ class BitstreamGenerator {
     /// @param output_path Output path to bitstream directory in the case
     ///                     of ASCII-style bitstream, path to single bitstream
     ///                     file otherwise
+    /// @param reports Destination of objective quality metrics of each audio
+    ///                 file, or nullptr to skip their computation
+    /// @param rates Destination of the achieved size of each bitstream, or
+    ///                 nullptr
     /// @note If instructed to produce ASCII bitstreams, this function will
     ///         produce on bitstream per audio file in a directory specified
     ///         by the output path. For all other formats, the bitstream
     ///         will be a single file
+    /// @note Files are encoded concurrently, but composite bitstreams are
+    ///         always written in the order of the input paths
     void encodeBatch(const std::vector<std::string> &audio_input_paths,
         const std::vector<std::string> &bitstream_names,
-        const std::string &output_path) const;
+        const std::string &output_path,
+        std::vector<QualityMetrics::Report> *reports = nullptr,
+        std::vector<RateController::Result> *rates = nullptr) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // In-Memory Encoding /////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Converts mono samples to Frames, without accessing the
+    ///         filesystem
+    /// @param samples Floating-point PCM samples
+    /// @param sample_rate_hz Sample rate of samples, in Hertz, which are
+    ///                         resampled to 8 kHz if necessary
+    /// @param report Destination of objective quality metrics, which compare
+    ///                 the samples to the resynthesized Frames, or nullptr to
+    ///                 skip their computation
+    /// @param rate Destination of the achieved bitstream size, or nullptr
+    /// @return Post-processed Frames, ready for serialization
+    /// @throws std::runtime_error if samples cannot be resampled
+    /// @note The decoded-audio and analysis caches, which are keyed by path,
+    ///         do not apply
+    std::vector<Frame> encodeFrames(const std::vector<float> &samples,
+        int sample_rate_hz, QualityMetrics::Report *report = nullptr,
+        RateController::Result *rate = nullptr) const;
+
+    /// @brief Converts mono samples to a binary TMS5220 bitstream
+    /// @param samples Floating-point PCM samples
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    /// @param rate Destination of the achieved bitstream size, or nullptr
+    /// @return Bitstream bytes, as consumed by the TMS5220, which end with a
+    ///         stop frame if so configured
+    /// @throws std::runtime_error if samples cannot be resampled
+    std::vector<std::byte> encodeBytes(const std::vector<float> &samples,
+        int sample_rate_hz, RateController::Result *rate = nullptr) const;
+
+    /// @brief Converts mono samples to a bitstream in the configured style
+    /// @param samples Floating-point PCM samples
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    /// @param bitstream_name Name of bitstream, for C headers
+    /// @param rate Destination of the achieved bitstream size, or nullptr
+    /// @return Bitstream, as it would be written to a bitstream file
+    /// @throws std::runtime_error if samples cannot be resampled
+    std::string encodeBitstream(const std::vector<float> &samples,
+        int sample_rate_hz, const std::string &bitstream_name,
+        RateController::Result *rate = nullptr) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Metadata ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the number of analyses served from the cache
+    /// @return Analysis cache hits
+    int getAnalysisCacheHits() const;
+
+    /// @brief Accesses the number of analyses which were not cached
+    /// @return Analysis cache misses
+    int getAnalysisCacheMisses() const;
+
+    /// @brief Accesses the order of the highpass and lowpass filters
+    /// @return Butterworth filter order
+    int getFilterOrder() const;
+
+    /// @brief Accesses the algorithm used to resample audio to 8 kHz
+    /// @return Resampling algorithm
+    AudioBuffer::ResampleQuality getResampleQuality() const;
+
+    /// @brief Creates a Frame Analyzer which analyzes segments exactly as the
+    ///         Bitstream Generator does
+    /// @return Frame Analyzer
+    FrameAnalyzer getAnalyzer() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Post-Processing ////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Applies gain normalization, gain shift, coefficient
+    ///         quantization, and repeat detection, optimization, or rate
+    ///         control
+    /// @param frames Raw frames, which are modified in place
+    /// @return Achieved bitstream size
+    RateController::Result postprocessFrames(std::vector<Frame> &frames) const;
 
  private:
     ///////////////////////////////////////////////////////////////////////////
@@ -93,8 +276,70 @@ class BitstreamGenerator {
     /// @brief Converts audio file to sequence of LPC frames which characterize
     ///         the sample within each segmentation window
     /// @param path Path to audio file
+    /// @param report Destination of objective quality metrics, or nullptr to
+    ///                 skip their computation
+    /// @param rate Destination of the achieved bitstream size, or nullptr
+    /// @param n_metrics_threads Number of threads which compute quality
+    ///                             metrics, or zero to use every hardware
+    ///                             thread
     /// @return Vector of encoded frames
-    std::vector<Frame> generateFrames(const std::string &path) const;
+    std::vector<Frame> generateFrames(const std::string &path,
+        QualityMetrics::Report *report = nullptr,
+        RateController::Result *rate = nullptr,
+        int n_metrics_threads = 0) const;
+
+    /// @brief Decodes audio file to 8 kHz mono, via the decoded-audio cache if
+    ///         enabled
+    /// @param path Path to audio file
+    /// @param checksum CRC32 of audio file, which is required only if the
+    ///                 cache is enabled
+    /// @param size Size of audio file, in bytes, which is required only if the
+    ///             cache is enabled
+    /// @return Segmented Audio Buffer
+    /// @throws std::runtime_error if audio file cannot be read
+    std::shared_ptr<AudioBuffer> loadAudio(const std::string &path,
+        uint32_t checksum, uint64_t size) const;
+
+    /// @brief Performs LPC analysis of audio file, or retrieves the result of
+    ///         a previous analysis from the cache
+    /// @param path Path to audio file
+    /// @param source_samples Destination of the unfiltered 8 kHz samples of
+    ///                         the audio file, or nullptr if not required
+    /// @return Vector of raw frames, prior to post-processing
+    std::vector<Frame> analyzeFrames(const std::string &path,
+        std::vector<float> *source_samples = nullptr) const;
+
+    /// @brief Filters and performs LPC analysis of 8 kHz audio
+    /// @param lpc_buffer Audio Buffer, which is filtered in place
+    /// @return Vector of raw frames, prior to post-processing
+    std::vector<Frame> analyzeBuffer(AudioBuffer &lpc_buffer) const;
+
+    /// @brief Post-processes raw frames and scores the result
+    /// @param frames Raw frames, which are post-processed in place
+    /// @param source_samples Unfiltered 8 kHz samples from which the frames
+    ///                         were analyzed, which are only required if a
+    ///                         report is requested
+    /// @param report Destination of objective quality metrics, or nullptr to
+    ///                 skip their computation
+    /// @param rate Destination of the achieved bitstream size, or nullptr
+    /// @param n_metrics_threads Number of threads which compute quality
+    ///                             metrics, or zero to use every hardware
+    ///                             thread
+    void finalizeFrames(std::vector<Frame> &frames,
+        const std::vector<float> &source_samples,
+        QualityMetrics::Report *report, RateController::Result *rate,
+        int n_metrics_threads = 0) const;
+
+    /// @brief Reports the Frames of a bitstream to the active Encoder Stats
+    /// @param frames Post-processed Frames
+    /// @param result Achieved bitstream size
+    void countFrames(const std::vector<Frame> &frames,
+        const RateController::Result &result) const;
+
+    /// @brief Describes every setting which affects LPC analysis, for use as
+    ///         part of an analysis cache key
+    /// @return Analysis parameters, as a string
+    std::string describeAnalysisParameters() const;
 
     /// @brief Converts Frame vector to bitstream file(s)
     /// @param frames Vector of Frames
@@ -103,6 +348,12 @@ class BitstreamGenerator {
     std::string serializeFrames(const std::vector<Frame>& frames,
         const std::string &filename) const;
 
+    /// @brief Writes a bitstream to disk
+    /// @param bitstream Bitstream, as a string
+    /// @param path Output path of bitstream file
+    void writeBitstream(const std::string &bitstream,
+        const std::string &path) const;
+
     ///////////////////////////////////////////////////////////////////////////
     // Members ////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -144,6 +395,59 @@ class BitstreamGenerator {
 
     /// @brief Min pitch frequency, in Hertz
     int min_pitch_hz_;
+
+    /// @brief Pitch estimation algorithm
+    PitchAlgorithm pitch_algorithm_;
+
+    /// @brief Absolute threshold of the YIN pitch estimator
+    float yin_threshold_;
+
+    /// @brief Decimation factor of the autocorrelation pitch search
+    int pitch_decimation_;
+
+    /// @brief Hysteresis of voicing decisions
+    float voicing_hysteresis_;
+
+    /// @brief Order of the highpass and lowpass filters
+    int filter_order_;
+
+    /// @brief Resampling algorithm
+    AudioBuffer::ResampleQuality resample_quality_;
+
+    /// @brief Directory of the decoded-audio and analysis caches, or empty if
+    ///         disabled
+    std::string cache_directory_;
+
+    /// @brief true if reflector coefficients are quantized closed-loop, false
+    ///         if rounded to their nearest Coding Table entries
+    bool closed_loop_quantization_;
+
+    /// @brief Max mean spectral distortion of rate-distortion optimized
+    ///         repeat frames, in decibels, or zero if disabled
+    float repeat_distortion_db_;
+
+    /// @brief Max number of consecutive repeat frames
+    int max_repeat_chain_;
+
+    /// @brief Max spectral change within a variable frame rate repeat chain,
+    ///         in decibels, or zero if disabled
+    float max_spectral_change_db_;
+
+    /// @brief Max size of each bitstream, in bytes, or zero if unlimited
+    int max_bytes_;
+
+    /// @brief Max bitrate of each bitstream, or zero if unlimited
+    float max_bits_per_second_;
+
+    /// @brief Number of files encoded concurrently by a batch, or zero to use
+    ///         every hardware thread
+    int n_threads_;
+
+    /// @brief Number of analyses served from the cache
+    mutable std::atomic<int> n_analysis_cache_hits_;
+
+    /// @brief Number of analyses which were not cached
+    mutable std::atomic<int> n_analysis_cache_misses_;
 };
 
 };  // namespace tms_express
@@ -0,0 +1,223 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "bitstream/FrameAnalyzer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/AudioFilter.hpp"
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/LinearPredictor.hpp"
+#include "analysis/PitchEstimator.hpp"
+#include "analysis/Spectrum.hpp"
+#include "analysis/VoicingClassifier.hpp"
+#include "analysis/YinPitchEstimator.hpp"
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FrameAnalyzer::FrameAnalyzer(int min_pitch_hz, int max_pitch_hz) {
+    min_pitch_hz_ = min_pitch_hz;
+    max_pitch_hz_ = max_pitch_hz;
+    pitch_algorithm_ = PITCHALGORITHM_ACF;
+    yin_threshold_ = 0.1f;
+    pitch_decimation_ = 1;
+    voicing_hysteresis_ = 0.0f;
+    spectral_change_ = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Configuration //////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void FrameAnalyzer::setPitchRange(int min_pitch_hz, int max_pitch_hz) {
+    min_pitch_hz_ = min_pitch_hz;
+    max_pitch_hz_ = max_pitch_hz;
+}
+
+void FrameAnalyzer::setPitchAlgorithm(PitchAlgorithm algorithm,
+    float yin_threshold) {
+    //
+    pitch_algorithm_ = algorithm;
+    yin_threshold_ = yin_threshold;
+}
+
+void FrameAnalyzer::setPitchDecimation(int factor) {
+    pitch_decimation_ = factor;
+}
+
+void FrameAnalyzer::setVoicingHysteresis(float hysteresis) {
+    voicing_hysteresis_ = hysteresis;
+}
+
+void FrameAnalyzer::setSpectralChange(bool enabled) {
+    spectral_change_ = enabled;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Analysis ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::vector<Frame> FrameAnalyzer::analyze(const AudioBuffer &lpc_buffer,
+    const AudioBuffer &pitch_buffer) const {
+    //
+    return assembleFrames(analyzeLpc(lpc_buffer), analyzePitch(pitch_buffer));
+}
+
+std::vector<FrameAnalyzer::LpcSegment> FrameAnalyzer::analyzeLpc(
+    const AudioBuffer &lpc_buffer) const {
+    //
+    auto preprocessor = AudioFilter();
+    auto linear_predictor = LinearPredictor();
+    auto spectrum = Spectrum(lpc_buffer.getNSamplesPerSegment());
+    auto n_bins = spectral_change_ ? spectrum.getNBins() : 0;
+    auto spectrum_db = std::vector<float>(n_bins);
+    auto previous_spectrum_db = std::vector<float>(n_bins);
+    auto segments = std::vector<LpcSegment>();
+
+    for (int i = 0; i < lpc_buffer.getNSegments(); i++) {
+        auto lpc_segment = lpc_buffer.getSegment(i);
+        auto spectral_change_db = 0.0f;
+
+        // Measure how far the spectral envelope has moved since the previous
+        // segment. Changes in level are discounted, as every Frame encodes its
+        // own gain, such that steady vowels score low and plosives score high
+        if (spectral_change_) {
+            spectrum.logPowerSpectrum(lpc_segment.data(),
+                static_cast<int>(lpc_segment.size()), spectrum_db.data());
+
+            if (i > 0) {
+                auto offset_db = 0.0f;
+
+                for (int k = 0; k < n_bins; k++) {
+                    offset_db += spectrum_db[k] - previous_spectrum_db[k];
+                }
+
+                offset_db /= static_cast<float>(n_bins);
+                spectral_change_db = Spectrum::logSpectralDistance(
+                    spectrum_db.data(), previous_spectrum_db.data(), n_bins,
+                    offset_db);
+            }
+
+            std::swap(spectrum_db, previous_spectrum_db);
+        }
+
+        // Count zero crossings before windowing, which would otherwise
+        // attenuate the crossings near the segment boundaries
+        auto zero_crossing_rate =
+            VoicingClassifier::zeroCrossingRate(lpc_segment);
+
+        // Apply a window function to the segment to smoothen its boundaries
+        //
+        // Because information about the transition between adjacent frames is
+        // lost during segmentation, a window will help produce smoother results
+        preprocessor.applyHammingWindow(lpc_segment);
+
+        // Compute the autocorrelation of each segment, which serves as the
+        // basis of all analysis
+        auto lpc_acf = tms_express::Autocorrelation(lpc_segment);
+
+        // Extract LPC reflector coefficients and compute the predictor gain
+        auto coeffs = linear_predictor.computeCoeffs(lpc_acf);
+        auto gain = linear_predictor.gain();
+
+        segments.push_back({std::move(coeffs), gain,
+            zero_crossing_rate, spectral_change_db});
+    }
+
+    return segments;
+}
+
+std::vector<FrameAnalyzer::PitchSegment> FrameAnalyzer::analyzePitch(
+    const AudioBuffer &pitch_buffer) const {
+    //
+    auto sample_rate = pitch_buffer.getSampleRateHz();
+    auto pitch_estimator = PitchEstimator(sample_rate, min_pitch_hz_,
+        max_pitch_hz_);
+    auto yin_estimator = YinPitchEstimator(sample_rate, min_pitch_hz_,
+        max_pitch_hz_, yin_threshold_);
+    auto segments = std::vector<PitchSegment>();
+
+    for (int i = 0; i < pitch_buffer.getNSegments(); i++) {
+        auto pitch_segment = pitch_buffer.getSegment(i);
+
+        // Estimate pitch. The YIN estimator re-uses the autocorrelation of the
+        // pitch segment, adding only a linear-time pass to the analysis. The
+        // decimated path never computes the full-rate autocorrelation, and
+        // evaluates only the lags which voicing requires
+        float pitch_period;
+        auto pitch_acf = std::vector<float>();
+
+        if (pitch_algorithm_ == PITCHALGORITHM_YIN) {
+            pitch_acf = tms_express::Autocorrelation(pitch_segment);
+            pitch_period = yin_estimator.estimatePeriod(pitch_segment,
+                pitch_acf);
+
+        } else if (pitch_decimation_ > 1) {
+            pitch_period = static_cast<float>(
+                pitch_estimator.estimatePeriodDecimated(pitch_segment,
+                    pitch_decimation_));
+
+        } else {
+            pitch_acf = tms_express::Autocorrelation(pitch_segment);
+            pitch_period = static_cast<float>(
+                pitch_estimator.estimatePeriod(pitch_acf));
+        }
+
+        auto lag = static_cast<int>(std::lround(pitch_period));
+        auto n_acf = static_cast<int>(pitch_acf.size());
+
+        auto energy = (n_acf > 0) ? pitch_acf[0] :
+            AutocorrelationAtLag(pitch_segment, 0);
+        auto correlation = (lag >= 0 && lag < n_acf) ? pitch_acf[lag] :
+            AutocorrelationAtLag(pitch_segment, lag);
+
+        segments.push_back({pitch_period, energy,
+            VoicingClassifier::periodicity(energy, correlation, lag,
+                static_cast<int>(pitch_segment.size()))});
+    }
+
+    return segments;
+}
+
+std::vector<Frame> FrameAnalyzer::assembleFrames(
+    const std::vector<LpcSegment> &lpc,
+    const std::vector<PitchSegment> &pitch) const {
+    //
+    auto n_segments = std::min(lpc.size(), pitch.size());
+
+    // The energy of each segment is judged against the loudest segment of
+    // the utterance, rather than the loudest seen so far
+    auto peak_energy = 0.0f;
+
+    for (const auto &segment : pitch) {
+        peak_energy = std::max(peak_energy, segment.energy);
+    }
+
+    auto voicing_classifier = VoicingClassifier(voicing_hysteresis_);
+    voicing_classifier.reset(peak_energy);
+
+    auto frames = std::vector<Frame>();
+    frames.reserve(n_segments);
+
+    for (size_t i = 0; i < n_segments; i++) {
+        auto is_voiced = voicing_classifier.classify(pitch[i].energy,
+            lpc[i].zero_crossing_rate, pitch[i].periodicity,
+            lpc[i].coeffs[0]);
+
+        frames.emplace_back(pitch[i].period, is_voiced, lpc[i].gain_db,
+            lpc[i].coeffs);
+        frames.back().setSpectralChange(lpc[i].spectral_change_db);
+    }
+
+    return frames;
+}
+
+};  // namespace tms_express
@@ -0,0 +1,164 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_BITSTREAM_GENERATION_FRAMEANALYZER_HPP_
+#define TMS_EXPRESS_BITSTREAM_GENERATION_FRAMEANALYZER_HPP_
+
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Performs the per-segment analysis which turns the filtered pitch
+///         and LPC branches of an utterance into raw Frames
+/// @details Analysis is split into an LPC stage, a pitch stage, and the
+///             voicing decisions which combine them, such that callers which
+///             re-use one stage across many settings of the other (such as a
+///             Parameter Sweep) analyze exactly as the encoder does
+class FrameAnalyzer {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Enums //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Defines the algorithm used to estimate the pitch of each segment
+    enum PitchAlgorithm {
+        /// @brief Integer period from the peak of the autocorrelation
+        PITCHALGORITHM_ACF,
+
+        /// @brief Fractional period from the YIN normalized difference function
+        PITCHALGORITHM_YIN
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Types //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Result of LPC analysis of one segment
+    struct LpcSegment {
+        /// @brief Reflector coefficients
+        std::vector<float> coeffs;
+
+        /// @brief Predictor gain, in decibels
+        float gain_db;
+
+        /// @brief Fraction of adjacent samples which differ in sign, prior to
+        ///         windowing
+        float zero_crossing_rate;
+
+        /// @brief Level-independent change of the spectral envelope since the
+        ///         previous segment, in decibels
+        float spectral_change_db;
+    };
+
+    /// @brief Result of pitch analysis of one segment
+    struct PitchSegment {
+        /// @brief Pitch period, in (fractional) samples
+        float period;
+
+        /// @brief Mean-square energy
+        float energy;
+
+        /// @brief Normalized autocorrelation at the pitch period
+        float periodicity;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Frame Analyzer
+    /// @param min_pitch_hz Min pitch frequency, in Hertz
+    /// @param max_pitch_hz Max pitch frequency, in Hertz
+    explicit FrameAnalyzer(int min_pitch_hz = 50, int max_pitch_hz = 500);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration //////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sets the range of pitch frequencies
+    /// @param min_pitch_hz Min pitch frequency, in Hertz
+    /// @param max_pitch_hz Max pitch frequency, in Hertz
+    void setPitchRange(int min_pitch_hz, int max_pitch_hz);
+
+    /// @brief Sets the pitch estimation algorithm
+    /// @param algorithm Pitch estimator
+    /// @param yin_threshold Absolute threshold of the YIN estimator, from 0
+    ///                         to 1
+    void setPitchAlgorithm(PitchAlgorithm algorithm,
+        float yin_threshold = 0.1f);
+
+    /// @brief Sets the decimation factor of the autocorrelation pitch search
+    /// @param factor Decimation factor, where 1 disables decimation
+    void setPitchDecimation(int factor);
+
+    /// @brief Sets the hysteresis of voicing decisions
+    /// @param hysteresis Voicing decision hysteresis, or zero to disable
+    void setVoicingHysteresis(float hysteresis);
+
+    /// @brief Sets whether the spectral change of each segment is measured
+    /// @param enabled true to measure spectral change, which only variable
+    ///                 frame rate encoding reads, false to leave it at zero
+    void setSpectralChange(bool enabled);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Analysis ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Analyzes both branches of an utterance
+    /// @param lpc_buffer Pre-emphasized and highpass-filtered samples
+    /// @param pitch_buffer Lowpass-filtered samples, segmented identically
+    /// @return Raw Frames, prior to post-processing
+    std::vector<Frame> analyze(const AudioBuffer &lpc_buffer,
+        const AudioBuffer &pitch_buffer) const;
+
+    /// @brief Performs LPC analysis of each segment
+    /// @param lpc_buffer Pre-emphasized and highpass-filtered samples
+    /// @return Result of each segment
+    std::vector<LpcSegment> analyzeLpc(const AudioBuffer &lpc_buffer) const;
+
+    /// @brief Estimates the pitch of each segment
+    /// @param pitch_buffer Lowpass-filtered samples
+    /// @return Result of each segment
+    std::vector<PitchSegment> analyzePitch(const AudioBuffer &pitch_buffer)
+        const;
+
+    /// @brief Decides the voicing of each segment, and assembles Frames
+    /// @param lpc Result of LPC analysis
+    /// @param pitch Result of pitch analysis, of the same segments
+    /// @return Raw Frames, prior to post-processing
+    std::vector<Frame> assembleFrames(const std::vector<LpcSegment> &lpc,
+        const std::vector<PitchSegment> &pitch) const;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Min pitch frequency, in Hertz
+    int min_pitch_hz_;
+
+    /// @brief Max pitch frequency, in Hertz
+    int max_pitch_hz_;
+
+    /// @brief Pitch estimation algorithm
+    PitchAlgorithm pitch_algorithm_;
+
+    /// @brief Absolute threshold of the YIN pitch estimator
+    float yin_threshold_;
+
+    /// @brief Decimation factor of the autocorrelation pitch search
+    int pitch_decimation_;
+
+    /// @brief Hysteresis of voicing decisions
+    float voicing_hysteresis_;
+
+    /// @brief true to measure the spectral change of each segment, false
+    ///         otherwise
+    bool spectral_change_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_BITSTREAM_GENERATION_FRAMEANALYZER_HPP_
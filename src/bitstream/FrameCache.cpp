@@ -0,0 +1,218 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "bitstream/FrameCache.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "lib/CRC.h"
+
+#include "audio/AudioCache.hpp"
+#include "encoding/CodingTable.hpp"
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Layout of the header which precedes the Frame records of a cache
+///         entry
+/// @details Each record consists of the pitch period, gain, spectral change,
+///             and n_coeffs reflector coefficients as float32, followed by a
+///             voicing byte
+struct FrameCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t n_frames;
+    uint32_t n_coeffs;
+};
+
+static_assert(sizeof(FrameCacheHeader) == 16, "Unexpected header padding");
+
+/// @brief Identifies a cache entry file
+static constexpr char kMagic[4] = {'T', 'M', 'S', 'F'};
+
+/// @brief Version of the cache entry format, which must be incremented if the
+///         format or the analysis algorithms change
+static constexpr uint32_t kVersion = 3;
+
+/// @brief Number of reflector coefficients in every record
+static constexpr uint32_t kNCoeffs = coding_table::tms5220::kNCoeffs;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+FrameCache::FrameCache(const std::string &directory) {
+    directory_ = directory;
+
+    auto error = std::error_code();
+    std::filesystem::create_directories(directory_, error);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FrameCache::getDirectory() const {
+    return directory_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Cache Operations ///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::string FrameCache::makeKey(const std::string &path,
+    const std::string &parameters) {
+    //
+    uint32_t checksum;
+    uint64_t size;
+
+    if (!AudioCache::checksumFile(path, checksum, size)) {
+        return "";
+    }
+
+    return makeKey(checksum, size, parameters);
+}
+
+std::string FrameCache::makeKey(uint32_t checksum, uint64_t size,
+    const std::string &parameters) {
+    //
+    auto parameters_checksum = CRC::Calculate(parameters.data(),
+        parameters.size(), CRC::CRC_32());
+
+    char key[64];
+    snprintf(key, sizeof(key), "%08x-%llx-%08x", checksum,
+        static_cast<unsigned long long>(size), parameters_checksum);
+
+    return key;
+}
+
+bool FrameCache::load(const std::string &key, std::vector<Frame> &frames)
+    const {
+    //
+    auto entry_path = std::filesystem::path(directory_) / (key + ".frames");
+    auto error = std::error_code();
+    auto file_size = std::filesystem::file_size(entry_path, error);
+
+    if (error || file_size < sizeof(FrameCacheHeader)) {
+        return false;
+    }
+
+    auto file = std::ifstream(entry_path, std::ios::binary);
+    auto header = FrameCacheHeader();
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+    // Validate the header before trusting the size of the records
+    auto records_size = file_size - sizeof(header);
+    auto record_size = (3 + kNCoeffs) * sizeof(float) + 1;
+    auto is_valid = file &&
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+        header.version == kVersion && header.n_coeffs == kNCoeffs &&
+        record_size * header.n_frames == records_size;
+
+    if (!is_valid) {
+        return false;
+    }
+
+    // Read every record at once, rather than one field at a time
+    auto records = std::vector<char>(records_size);
+    file.read(records.data(), static_cast<std::streamsize>(records.size()));
+
+    if (!file) {
+        return false;
+    }
+
+    frames.clear();
+    frames.reserve(header.n_frames);
+
+    auto coeffs = std::vector<float>(header.n_coeffs);
+
+    for (uint32_t i = 0; i < header.n_frames; i++) {
+        auto record = records.data() + i * record_size;
+
+        float pitch_period, gain_db, spectral_change_db;
+        std::memcpy(&pitch_period, record, sizeof(float));
+        std::memcpy(&gain_db, record + sizeof(float), sizeof(float));
+        std::memcpy(&spectral_change_db, record + 2 * sizeof(float),
+            sizeof(float));
+        std::memcpy(coeffs.data(), record + 3 * sizeof(float),
+            header.n_coeffs * sizeof(float));
+
+        auto is_voiced = record[record_size - 1] != 0;
+        frames.emplace_back(pitch_period, is_voiced, gain_db, coeffs);
+        frames.back().setSpectralChange(spectral_change_db);
+    }
+
+    return true;
+}
+
+bool FrameCache::store(const std::string &key,
+    const std::vector<Frame> &frames) const {
+    //
+    auto header = FrameCacheHeader();
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.n_frames = static_cast<uint32_t>(frames.size());
+    header.n_coeffs = kNCoeffs;
+
+    auto record_size = (3 + header.n_coeffs) * sizeof(float) + 1;
+    auto records = std::vector<char>(record_size * header.n_frames);
+
+    for (uint32_t i = 0; i < header.n_frames; i++) {
+        const auto &frame = frames[i];
+        auto coeffs = frame.getCoeffs();
+
+        // Frames are analyzed at the model order of the coding table
+        if (coeffs.size() != header.n_coeffs) {
+            return false;
+        }
+
+        auto record = records.data() + i * record_size;
+        auto pitch_period = frame.getPitch();
+        auto gain_db = frame.getGain();
+        auto spectral_change_db = frame.getSpectralChange();
+
+        std::memcpy(record, &pitch_period, sizeof(float));
+        std::memcpy(record + sizeof(float), &gain_db, sizeof(float));
+        std::memcpy(record + 2 * sizeof(float), &spectral_change_db,
+            sizeof(float));
+        std::memcpy(record + 3 * sizeof(float), coeffs.data(),
+            header.n_coeffs * sizeof(float));
+
+        record[record_size - 1] = frame.isVoiced() ? 1 : 0;
+    }
+
+    // Write to a uniquely-named temporary file, then rename it into place, so
+    // that concurrent encodes never observe a partially-written entry
+    auto entry_path = std::filesystem::path(directory_) / (key + ".frames");
+    auto temp_path = AudioCache::makeTempPath(entry_path.string());
+
+    {
+        auto file = std::ofstream(temp_path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(records.data(),
+            static_cast<std::streamsize>(records.size()));
+
+        if (!file) {
+            file.close();
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+
+    auto error = std::error_code();
+    std::filesystem::rename(temp_path, entry_path, error);
+
+    if (error) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+};  // namespace tms_express
@@ -0,0 +1,84 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_BITSTREAM_GENERATION_FRAMECACHE_HPP_
+#define TMS_EXPRESS_BITSTREAM_GENERATION_FRAMECACHE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Stores the results of LPC analysis on disk, such that encodes which
+///         differ only in post-processing settings skip analysis entirely
+/// @details Entries hold the raw Frame table produced by analysis, before any
+///             gain normalization, gain shift, or repeat detection, and are
+///             keyed by a CRC32 of the input file and of a description of the
+///             analysis parameters
+class FrameCache {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Frame Cache backed by the given directory
+    /// @param directory Directory in which to store cache entries, which will
+    ///                     be created if it does not exist
+    explicit FrameCache(const std::string &directory);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the cache directory
+    /// @return Path to cache directory
+    std::string getDirectory() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Cache Operations ///////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes the key of a cache entry
+    /// @param path Path to audio file
+    /// @param parameters Description of every parameter which affects analysis
+    /// @return Cache key, or empty string if audio file cannot be read
+    static std::string makeKey(const std::string &path,
+        const std::string &parameters);
+
+    /// @brief Computes the key of a cache entry, given the previously
+    ///         computed checksum of the audio file
+    /// @param checksum CRC32 of audio file, as computed by
+    ///                 AudioCache::checksumFile()
+    /// @param size Size of audio file, in bytes
+    /// @param parameters Description of every parameter which affects analysis
+    /// @return Cache key
+    static std::string makeKey(uint32_t checksum, uint64_t size,
+        const std::string &parameters);
+
+    /// @brief Reads the Frame table of a cache entry
+    /// @param key Cache key
+    /// @param frames Destination of cached Frames
+    /// @return true if entry exists and is valid, false otherwise
+    bool load(const std::string &key, std::vector<Frame> &frames) const;
+
+    /// @brief Writes a Frame table to a cache entry, atomically replacing any
+    ///         existing entry
+    /// @param key Cache key
+    /// @param frames Frames to cache
+    /// @return true if entry was written, false otherwise
+    bool store(const std::string &key, const std::vector<Frame> &frames) const;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Cache directory
+    std::string directory_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_BITSTREAM_GENERATION_FRAMECACHE_HPP_
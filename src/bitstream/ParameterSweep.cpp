@@ -0,0 +1,415 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "bitstream/ParameterSweep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/FilterBank.hpp"
+#include "analysis/ParallelFor.hpp"
+#include "analysis/QualityMetrics.hpp"
+#include "bitstream/BitstreamGenerator.hpp"
+#include "bitstream/FrameAnalyzer.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/Synthesizer.hpp"
+
+namespace tms_express {
+
+/// @brief Sample rate of analysis, in Hertz
+static constexpr int kSampleRateHz = 8000;
+
+///////////////////////////////////////////////////////////////////////////////
+// Range //////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool ParameterSweep::Range::parse(const std::string &str, Range &range) {
+    auto fields = std::vector<float>();
+    size_t start = 0;
+
+    while (true) {
+        auto end = str.find(':', start);
+        auto field = str.substr(start, end - start);
+
+        try {
+            size_t n_parsed;
+            fields.push_back(std::stof(field, &n_parsed));
+
+            if (n_parsed != field.size()) {
+                return false;
+            }
+
+        } catch (const std::exception &) {
+            return false;
+        }
+
+        if (end == std::string::npos) {
+            break;
+        }
+
+        start = end + 1;
+    }
+
+    if (fields.size() == 1) {
+        range = {fields[0], fields[0], 1.0f};
+        return true;
+    }
+
+    if (fields.size() != 3 || fields[2] <= 0.0f || fields[1] < fields[0]) {
+        return false;
+    }
+
+    range = {fields[0], fields[1], fields[2]};
+    return true;
+}
+
+std::vector<float> ParameterSweep::Range::values() const {
+    // Tolerate accumulated rounding error, such that "20:30:2.5" includes 30
+    auto n_values = static_cast<int>(floorf((stop - start) / step + 1.0e-4f))
+        + 1;
+
+    auto values = std::vector<float>();
+    for (int i = 0; i < n_values; i++) {
+        values.push_back(start + static_cast<float>(i) * step);
+    }
+
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+ParameterSweep::ParameterSweep(const Range &window_width_ms,
+    const Range &highpass_cutoff_hz, const Range &lowpass_cutoff_hz,
+    const Range &pre_emphasis_alpha, const Range &min_pitch_hz,
+    const Range &max_pitch_hz) {
+    //
+    window_widths_ms_ = window_width_ms.values();
+    highpass_cutoffs_hz_ = highpass_cutoff_hz.values();
+    lowpass_cutoffs_hz_ = lowpass_cutoff_hz.values();
+    pre_emphasis_alphas_ = pre_emphasis_alpha.values();
+    min_pitches_hz_ = min_pitch_hz.values();
+    max_pitches_hz_ = max_pitch_hz.values();
+    n_threads_ = 0;
+
+    // The swept parameters of the default encoder are ignored, and the rest
+    // match the defaults of the encode command
+    encoder_ = std::make_shared<BitstreamGenerator>(25.0f, 1000, 800,
+        -0.9375f, BitstreamGenerator::ENCODERSTYLE_ASCII, true, 2, 37.5f,
+        30.0f, false, 500, 50);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Configuration //////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void ParameterSweep::setThreads(int n_threads) {
+    n_threads_ = n_threads;
+}
+
+void ParameterSweep::setEncoder(
+    std::shared_ptr<const BitstreamGenerator> encoder) {
+    //
+    encoder_ = std::move(encoder);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::vector<ParameterSweep::Settings> ParameterSweep::getCombinations()
+    const {
+    //
+    auto n_min_pitches = static_cast<int>(min_pitches_hz_.size());
+    auto n_max_pitches = static_cast<int>(max_pitches_hz_.size());
+    auto combinations = std::vector<Settings>();
+
+    for (auto window_width_ms : window_widths_ms_) {
+        for (auto highpass_cutoff_hz : highpass_cutoffs_hz_) {
+            for (auto lowpass_cutoff_hz : lowpass_cutoffs_hz_) {
+                for (auto pre_emphasis_alpha : pre_emphasis_alphas_) {
+                    for (int min_pitch = 0; min_pitch < n_min_pitches;
+                        min_pitch++) {
+                        //
+                        for (int max_pitch = 0; max_pitch < n_max_pitches;
+                            max_pitch++) {
+                            //
+                            if (!isPitchRangeValid(min_pitch, max_pitch)) {
+                                continue;
+                            }
+
+                            combinations.push_back({window_width_ms,
+                                static_cast<int>(highpass_cutoff_hz),
+                                static_cast<int>(lowpass_cutoff_hz),
+                                pre_emphasis_alpha,
+                                static_cast<int>(min_pitches_hz_[min_pitch]),
+                                static_cast<int>(max_pitches_hz_[max_pitch])});
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return combinations;
+}
+
+int ParameterSweep::getNSkippedCombinations() const {
+    auto n_min_pitches = static_cast<int>(min_pitches_hz_.size());
+    auto n_max_pitches = static_cast<int>(max_pitches_hz_.size());
+    int n_skipped_ranges = 0;
+
+    for (int min_pitch = 0; min_pitch < n_min_pitches; min_pitch++) {
+        for (int max_pitch = 0; max_pitch < n_max_pitches; max_pitch++) {
+            n_skipped_ranges += !isPitchRangeValid(min_pitch, max_pitch);
+        }
+    }
+
+    return n_skipped_ranges * static_cast<int>(window_widths_ms_.size() *
+        highpass_cutoffs_hz_.size() * lowpass_cutoffs_hz_.size() *
+        pre_emphasis_alphas_.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Sweep //////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::vector<ParameterSweep::Result> ParameterSweep::run(
+    const std::vector<std::string> &paths) const {
+    //
+    auto n_files = static_cast<int>(paths.size());
+    auto n_windows = static_cast<int>(window_widths_ms_.size());
+    auto n_highpass = static_cast<int>(highpass_cutoffs_hz_.size());
+    auto n_lowpass = static_cast<int>(lowpass_cutoffs_hz_.size());
+    auto n_alphas = static_cast<int>(pre_emphasis_alphas_.size());
+    auto n_min_pitches = static_cast<int>(min_pitches_hz_.size());
+    auto n_max_pitches = static_cast<int>(max_pitches_hz_.size());
+    auto filter_order = encoder_->getFilterOrder();
+    auto resample_quality = encoder_->getResampleQuality();
+    auto analyzer = encoder_->getAnalyzer();
+
+    // Stage 1: Decode each file exactly once, resampling exactly as the
+    // encoder would
+    auto sources = std::vector<std::vector<float>>(n_files);
+
+    ParallelFor(n_files, n_threads_, [&](int file) {
+        if (!AudioBuffer::Decode(paths[file], kSampleRateHz, resample_quality,
+            sources[file])) {
+            //
+            throw std::runtime_error("Could not read audio file: " +
+                paths[file]);
+        }
+    });
+
+    // Stage 2: Filter the pitch branch once per lowpass cutoff, and the LPC
+    // branch once per pre-emphasis and highpass pair
+    auto pitch_branches = std::vector<std::vector<float>>(n_files * n_lowpass);
+
+    ParallelFor(n_files * n_lowpass, n_threads_, [&](int task) {
+        auto file = task / n_lowpass;
+        auto lowpass = task % n_lowpass;
+
+        auto filter_bank = FilterBank();
+        filter_bank.addLowpass(static_cast<int>(lowpass_cutoffs_hz_[lowpass]),
+            filter_order);
+
+        pitch_branches[task] = sources[file];
+        filter_bank.apply(pitch_branches[task], kSampleRateHz);
+    });
+
+    auto lpc_branches = std::vector<std::vector<float>>(
+        n_files * n_alphas * n_highpass);
+
+    ParallelFor(static_cast<int>(lpc_branches.size()), n_threads_,
+        [&](int task) {
+        auto file = task / (n_alphas * n_highpass);
+        auto alpha = (task / n_highpass) % n_alphas;
+        auto highpass = task % n_highpass;
+
+        auto filter_bank = FilterBank();
+        filter_bank.addPreEmphasis(pre_emphasis_alphas_[alpha]);
+        filter_bank.addHighpass(
+            static_cast<int>(highpass_cutoffs_hz_[highpass]), filter_order);
+
+        lpc_branches[task] = sources[file];
+        filter_bank.apply(lpc_branches[task], kSampleRateHz);
+    });
+
+    // Stage 3: Analyze the LPC branch once per window width, and estimate
+    // pitch once per window width and pitch range
+    auto n_lpc_branches = n_alphas * n_highpass;
+    auto lpc_tables = std::vector<std::vector<FrameAnalyzer::LpcSegment>>(
+        n_files * n_lpc_branches * n_windows);
+
+    ParallelFor(static_cast<int>(lpc_tables.size()), n_threads_,
+        [&](int task) {
+        auto branch = task / n_windows;
+        auto window = task % n_windows;
+
+        auto buffer = AudioBuffer(lpc_branches[branch], kSampleRateHz,
+            window_widths_ms_[window]);
+
+        lpc_tables[task] = analyzer.analyzeLpc(buffer);
+    });
+
+    auto n_pitch_ranges = n_min_pitches * n_max_pitches;
+    auto pitch_tables = std::vector<std::vector<FrameAnalyzer::PitchSegment>>(
+        n_files * n_lowpass * n_windows * n_pitch_ranges);
+
+    ParallelFor(static_cast<int>(pitch_tables.size()), n_threads_,
+        [&](int task) {
+        auto branch = task / (n_windows * n_pitch_ranges);
+        auto window = (task / n_pitch_ranges) % n_windows;
+        auto min_pitch = (task / n_max_pitches) % n_min_pitches;
+        auto max_pitch = task % n_max_pitches;
+
+        // Empty pitch ranges are never scored, and would search past the end
+        // of the autocorrelation
+        if (!isPitchRangeValid(min_pitch, max_pitch)) {
+            return;
+        }
+
+        auto buffer = AudioBuffer(pitch_branches[branch], kSampleRateHz,
+            window_widths_ms_[window]);
+
+        auto pitch_analyzer = analyzer;
+        pitch_analyzer.setPitchRange(
+            static_cast<int>(min_pitches_hz_[min_pitch]),
+            static_cast<int>(max_pitches_hz_[max_pitch]));
+
+        pitch_tables[task] = pitch_analyzer.analyzePitch(buffer);
+    });
+
+    // Stage 4: Combine the tables of each combination, then post-process,
+    // resynthesize, and score. Tasks span every pitch range, and those which
+    // are empty are dropped afterward, in the order of enumeration
+    auto n_tasks = n_windows * n_highpass * n_lowpass * n_alphas *
+        n_pitch_ranges;
+    auto results = std::vector<Result>(n_tasks);
+    auto is_scored = std::vector<char>(n_tasks, 0);
+
+    ParallelFor(n_tasks, n_threads_, [&](int task) {
+        // Recover the index of each parameter, in the order of enumeration
+        int index = task;
+        auto max_pitch = index % n_max_pitches;
+        index /= n_max_pitches;
+        auto min_pitch = index % n_min_pitches;
+        index /= n_min_pitches;
+        auto alpha = index % n_alphas;
+        index /= n_alphas;
+        auto lowpass = index % n_lowpass;
+        index /= n_lowpass;
+        auto highpass = index % n_highpass;
+        index /= n_highpass;
+        auto window = index;
+
+        if (!isPitchRangeValid(min_pitch, max_pitch)) {
+            return;
+        }
+
+        auto window_width_ms = window_widths_ms_[window];
+
+        // Combinations are already scored in parallel, so each is scored on
+        // a single thread
+        auto metrics = QualityMetrics(kSampleRateHz, window_width_ms);
+        metrics.setThreads(1);
+
+        float total_error = 0.0f;
+
+        for (int file = 0; file < n_files; file++) {
+            auto pitch_branch = file * n_lowpass + lowpass;
+            auto lpc_branch = (file * n_alphas + alpha) * n_highpass +
+                highpass;
+
+            const auto &lpc_table = lpc_tables[lpc_branch * n_windows +
+                window];
+            const auto &pitch_table = pitch_tables[
+                (pitch_branch * n_windows + window) * n_pitch_ranges +
+                min_pitch * n_max_pitches + max_pitch];
+
+            auto frames = analyzer.assembleFrames(lpc_table, pitch_table);
+            encoder_->postprocessFrames(frames);
+
+            auto synthesizer = Synthesizer(kSampleRateHz, window_width_ms);
+            auto synthesized = synthesizer.synthesize(frames);
+
+            total_error += metrics.logSpectralDistance(sources[file],
+                synthesized);
+        }
+
+        auto settings = Settings{window_width_ms,
+            static_cast<int>(highpass_cutoffs_hz_[highpass]),
+            static_cast<int>(lowpass_cutoffs_hz_[lowpass]),
+            pre_emphasis_alphas_[alpha],
+            static_cast<int>(min_pitches_hz_[min_pitch]),
+            static_cast<int>(max_pitches_hz_[max_pitch])};
+
+        results[task] = {settings,
+            total_error / static_cast<float>(std::max(n_files, 1))};
+        is_scored[task] = 1;
+    });
+
+    int n_scored = 0;
+
+    for (int task = 0; task < n_tasks; task++) {
+        if (is_scored[task]) {
+            results[n_scored++] = results[task];
+        }
+    }
+
+    results.resize(n_scored);
+
+    std::stable_sort(results.begin(), results.end(),
+        [](const Result &a, const Result &b) {
+            return a.score_db < b.score_db;
+        });
+
+    return results;
+}
+
+std::string ParameterSweep::formatTable(const std::vector<Result> &results,
+    int n_rows) {
+    //
+    auto table = std::string(
+        "Rank  Score (dB)  Window (ms)  Highpass (Hz)  Lowpass (Hz)   Alpha"
+        "  Min Pitch (Hz)  Max Pitch (Hz)\n");
+
+    n_rows = std::min(n_rows, static_cast<int>(results.size()));
+
+    for (int i = 0; i < n_rows; i++) {
+        const auto &settings = results[i].settings;
+
+        char row[160];
+        snprintf(row, sizeof(row),
+            "%4d  %10.3f  %11.2f  %13d  %12d  %6.3f  %14d  %14d\n", i + 1,
+            results[i].score_db, settings.window_width_ms,
+            settings.highpass_cutoff_hz, settings.lowpass_cutoff_hz,
+            settings.pre_emphasis_alpha, settings.min_pitch_hz,
+            settings.max_pitch_hz);
+
+        table += row;
+    }
+
+    return table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool ParameterSweep::isPitchRangeValid(int min_pitch, int max_pitch) const {
+    // Compare the bounds as they are passed to the analyzer
+    return static_cast<int>(min_pitches_hz_[min_pitch]) <
+        static_cast<int>(max_pitches_hz_[max_pitch]);
+}
+
+};  // namespace tms_express
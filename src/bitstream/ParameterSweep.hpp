@@ -0,0 +1,194 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_BITSTREAM_GENERATION_PARAMETERSWEEP_HPP_
+#define TMS_EXPRESS_BITSTREAM_GENERATION_PARAMETERSWEEP_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bitstream/BitstreamGenerator.hpp"
+
+namespace tms_express {
+
+/// @brief Evaluates every combination of a set of analysis parameter ranges on
+///         a set of audio files, ranking combinations by resynthesis error
+/// @details Each stage of analysis is computed once per distinct set of the
+///             parameters which affect it. Audio is decoded once, the pitch
+///             branch is filtered once per lowpass cutoff, the LPC branch once
+///             per pre-emphasis and highpass pair, and pitch and LPC tables
+///             once per window width. Only voicing decisions, post-processing,
+///             synthesis, and scoring are performed per combination. Every
+///             stage is performed exactly as by the encoder, apart from the
+///             swept parameters
+class ParameterSweep {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Types //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Inclusive range of parameter values
+    struct Range {
+        /// @brief First value
+        float start;
+
+        /// @brief Last value, which is included if the range reaches it
+        float stop;
+
+        /// @brief Increment between values
+        float step;
+
+        /// @brief Parses a range from a "start:stop:step" string, or a single
+        ///         value
+        /// @param str Range string
+        /// @param range Destination of parsed range
+        /// @return true if string is a valid range, false otherwise
+        static bool parse(const std::string &str, Range &range);
+
+        /// @brief Enumerates the values of the range
+        /// @return Values, from start to stop
+        std::vector<float> values() const;
+    };
+
+    /// @brief Analysis parameters of a single combination
+    struct Settings {
+        /// @brief Segmentation window width, in milliseconds
+        float window_width_ms;
+
+        /// @brief Highpass filter cutoff, in Hertz
+        int highpass_cutoff_hz;
+
+        /// @brief Lowpass filter cutoff, in Hertz
+        int lowpass_cutoff_hz;
+
+        /// @brief Pre-emphasis filter coefficient
+        float pre_emphasis_alpha;
+
+        /// @brief Pitch frequency floor, in Hertz
+        int min_pitch_hz;
+
+        /// @brief Pitch frequency ceiling, in Hertz
+        int max_pitch_hz;
+    };
+
+    /// @brief Score of a single combination
+    struct Result {
+        /// @brief Analysis parameters
+        Settings settings;
+
+        /// @brief Mean log-spectral distance between source and resynthesized
+        ///         audio, in decibels, where lower is better
+        /// @see QualityMetrics::logSpectralDistance
+        float score_db;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Parameter Sweep over the given ranges
+    /// @param window_width_ms Segmentation window widths, in milliseconds
+    /// @param highpass_cutoff_hz Highpass filter cutoffs, in Hertz
+    /// @param lowpass_cutoff_hz Lowpass filter cutoffs, in Hertz
+    /// @param pre_emphasis_alpha Pre-emphasis filter coefficients
+    /// @param min_pitch_hz Pitch frequency floors, in Hertz
+    /// @param max_pitch_hz Pitch frequency ceilings, in Hertz
+    ParameterSweep(const Range &window_width_ms,
+        const Range &highpass_cutoff_hz, const Range &lowpass_cutoff_hz,
+        const Range &pre_emphasis_alpha, const Range &min_pitch_hz,
+        const Range &max_pitch_hz);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration //////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sets the number of worker threads
+    /// @param n_threads Number of threads, or zero to use every hardware
+    ///                     thread
+    void setThreads(int n_threads);
+
+    /// @brief Sets the encoder whose remaining settings apply to every
+    ///         combination
+    /// @param encoder Bitstream Generator, whose resampler, filter order,
+    ///                 pitch algorithm and decimation, voicing hysteresis,
+    ///                 and post-processing (gain limits, coefficient
+    ///                 quantization, and repeat frames) are used, and whose
+    ///                 swept parameters are ignored
+    void setEncoder(std::shared_ptr<const BitstreamGenerator> encoder);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Enumerates every combination of the parameter ranges
+    /// @return Analysis parameters of each combination
+    /// @note Combinations whose pitch floor is not below their pitch ceiling
+    ///         are skipped
+    std::vector<Settings> getCombinations() const;
+
+    /// @brief Counts the combinations skipped for an empty pitch range
+    /// @return Number of combinations whose pitch floor is not below their
+    ///         pitch ceiling
+    int getNSkippedCombinations() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sweep //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Evaluates every combination on the given audio files
+    /// @param paths Paths to audio files
+    /// @return Score of each combination, from best to worst
+    /// @throws std::runtime_error if an audio file cannot be read
+    std::vector<Result> run(const std::vector<std::string> &paths) const;
+
+    /// @brief Formats results as a ranked table
+    /// @param results Scored combinations, from best to worst
+    /// @param n_rows Max number of rows to include
+    /// @return Table, as a string
+    static std::string formatTable(const std::vector<Result> &results,
+        int n_rows);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Checks whether a pair of swept pitch bounds forms a non-empty
+    ///         range
+    /// @param min_pitch Index of pitch frequency floor
+    /// @param max_pitch Index of pitch frequency ceiling
+    /// @return true if floor is below ceiling, false otherwise
+    bool isPitchRangeValid(int min_pitch, int max_pitch) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Segmentation window widths, in milliseconds
+    std::vector<float> window_widths_ms_;
+
+    /// @brief Highpass filter cutoffs, in Hertz
+    std::vector<float> highpass_cutoffs_hz_;
+
+    /// @brief Lowpass filter cutoffs, in Hertz
+    std::vector<float> lowpass_cutoffs_hz_;
+
+    /// @brief Pre-emphasis filter coefficients
+    std::vector<float> pre_emphasis_alphas_;
+
+    /// @brief Pitch frequency floors, in Hertz
+    std::vector<float> min_pitches_hz_;
+
+    /// @brief Pitch frequency ceilings, in Hertz
+    std::vector<float> max_pitches_hz_;
+
+    /// @brief Number of worker threads
+    int n_threads_;
+
+    /// @brief Encoder whose remaining settings apply to every combination
+    std::shared_ptr<const BitstreamGenerator> encoder_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_BITSTREAM_GENERATION_PARAMETERSWEEP_HPP_
@@ -15,12 +15,38 @@ namespace tms_express::coding_table::tms5220 {
 // Metadata //////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static const int kNCoeffs = 10;
+static constexpr int kNCoeffs = 10;
 
-static const int kGainBitWidth = 4;
-static const int kPitchBitWidth = 6;
-static const int kVoicingBitWidth = 1;
-static const int kCoeffBitWidths[] = {5, 5, 4, 4, 4, 4, 4, 3, 3, 3};
+static constexpr int kGainBitWidth = 4;
+static constexpr int kPitchBitWidth = 6;
+static constexpr int kVoicingBitWidth = 1;
+static constexpr int kCoeffBitWidths[] = {5, 5, 4, 4, 4, 4, 4, 3, 3, 3};
+
+///////////////////////////////////////////////////////////////////////////////
+// Frame Sizes ////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+/// @brief Bits in a silent frame, which holds only a zero gain
+static constexpr int kSilentFrameBitWidth = kGainBitWidth;
+
+/// @brief Bits in a repeat frame, which holds gain, repeat flag, and pitch
+static constexpr int kRepeatFrameBitWidth = kGainBitWidth + 1 + kPitchBitWidth;
+
+/// @brief Bits in an unvoiced frame, which adds the first four coefficients
+static constexpr int kUnvoicedFrameBitWidth = kRepeatFrameBitWidth +
+    kCoeffBitWidths[0] + kCoeffBitWidths[1] + kCoeffBitWidths[2] +
+    kCoeffBitWidths[3];
+
+/// @brief Bits in a voiced frame, which adds all ten coefficients
+static constexpr int kVoicedFrameBitWidth = kUnvoicedFrameBitWidth +
+    kCoeffBitWidths[4] + kCoeffBitWidths[5] + kCoeffBitWidths[6] +
+    kCoeffBitWidths[7] + kCoeffBitWidths[8] + kCoeffBitWidths[9];
+
+/// @brief Bits in the stop frame, which holds an all-ones gain
+static constexpr int kStopFrameBitWidth = kGainBitWidth;
+
+static_assert(kRepeatFrameBitWidth == 11 && kUnvoicedFrameBitWidth == 29 &&
+    kVoicedFrameBitWidth == 50, "Frame sizes must match the TMS5220");
 
 ///////////////////////////////////////////////////////////////////////////////
 // RMS (Gain) Table ///////////////////////////////////////////////////////////
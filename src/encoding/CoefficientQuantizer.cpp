@@ -0,0 +1,301 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "encoding/CoefficientQuantizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "encoding/CodingTable.hpp"
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Number of frequencies, spanning 0 to Nyquist, at which envelopes
+///         are compared
+static constexpr int kNBins = 32;
+
+/// @brief Number of low-order coefficients whose neighboring table entries
+///         are searched
+static constexpr int kNSearchedCoeffs = 4;
+
+/// @brief Number of coefficients synthesized for unvoiced frames
+static constexpr int kNUnvoicedCoeffs = 4;
+
+/// @brief Fraction of the interval between two table entries which a
+///         coefficient must lie from the nearer entry for the farther entry
+///         to be searched
+/// @note Coefficients very close to a table entry almost never benefit from
+///         the farther entry, so pruning them shrinks the search considerably
+static constexpr float kSearchFraction = 0.25f;
+
+/// @brief Floor applied to filter power response, preventing log(0)
+static constexpr float kPowerFloor = 1.0e-12f;
+
+/// @brief Decibels per octave of power, which converts log2 to decibels
+static constexpr float kDecibelsPerOctave = 3.0102999566f;
+
+/// @brief Copies reflector coefficients into a full-length array, treating
+///         any which are missing as zero
+/// @param coeffs Reflector coefficients, of any length
+/// @param padded Destination of kNCoeffs coefficients
+static void padCoeffs(const std::vector<float> &coeffs, float *padded) {
+    const auto n_tables = coding_table::tms5220::kNCoeffs;
+    auto n_coeffs = std::min(static_cast<int>(coeffs.size()), n_tables);
+
+    std::fill_n(padded, n_tables, 0.0f);
+    std::copy_n(coeffs.begin(), n_coeffs, padded);
+}
+
+/// @brief Approximates log2 of a positive, normal float to within 1e-4
+/// @details Unlike log10f(), the approximation is branchless arithmetic on the
+///             bits of its argument, which allows the compiler to vectorize
+///             loops over it
+static inline float fastLog2(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    // Split x into exponent and a mantissa in [1, 2), then approximate the
+    // log of the mantissa with a least-squares polynomial centered on 1.5
+    auto exponent = static_cast<float>(static_cast<int>(bits >> 23) - 127);
+    bits = (bits & 0x007fffffu) | 0x3f800000u;
+
+    float mantissa;
+    std::memcpy(&mantissa, &bits, sizeof(mantissa));
+
+    auto t = mantissa - 1.5f;
+    auto poly = 0.58495050f + t * (0.96096307f + t * (-0.31974894f +
+        t * (0.15544726f - t * 0.08001168f)));
+
+    return exponent + poly;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+CoefficientQuantizer::CoefficientQuantizer() {
+    const auto n_coeffs = coding_table::tms5220::kNCoeffs;
+
+    for (int i = 0; i < n_coeffs; i++) {
+        tables_.push_back(coding_table::tms5220::getCoeffTable(i));
+    }
+
+    cos_table_.resize((n_coeffs + 1) * kNBins);
+    sin_table_.resize((n_coeffs + 1) * kNBins);
+
+    // Bins are centered within equal divisions of 0 to pi
+    for (int lag = 0; lag <= n_coeffs; lag++) {
+        for (int bin = 0; bin < kNBins; bin++) {
+            auto theta = M_PI * (bin + 0.5) / kNBins * lag;
+
+            cos_table_[lag * kNBins + bin] = static_cast<float>(cos(theta));
+            sin_table_[lag * kNBins + bin] = static_cast<float>(sin(theta));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Quantization ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::vector<int> CoefficientQuantizer::quantize(
+    const std::vector<float> &coeffs, int n_coeffs) const {
+    //
+    const auto n_tables = coding_table::tms5220::kNCoeffs;
+    n_coeffs = std::min(n_coeffs, n_tables);
+
+    float padded[coding_table::tms5220::kNCoeffs];
+    padCoeffs(coeffs, padded);
+
+    // Begin from the closest table entries, which agree with
+    // Frame::quantizedCoeffs()
+    auto indices = std::vector<int>(n_tables);
+    int candidates[kNSearchedCoeffs][2];
+    int n_candidates[kNSearchedCoeffs];
+    int n_combinations = 1;
+
+    for (int i = 0; i < n_tables; i++) {
+        const auto &table = tables_[i];
+        auto size = static_cast<int>(table.size());
+        auto right = static_cast<int>(std::upper_bound(table.begin(),
+            table.end(), padded[i]) - table.begin());
+
+        int nearest = std::min(right, size - 1);
+        int runner_up = -1;
+
+        if (right > 0 && right < size) {
+            auto left_distance = padded[i] - table[right - 1];
+            auto right_distance = table[right] - padded[i];
+            auto gap = table[right] - table[right - 1];
+
+            nearest = (right_distance < left_distance) ? right : right - 1;
+            runner_up = (nearest == right) ? right - 1 : right;
+
+            if (std::min(left_distance, right_distance) <
+                kSearchFraction * gap) {
+                runner_up = -1;
+            }
+        }
+
+        indices[i] = nearest;
+
+        if (i < kNSearchedCoeffs && i < n_coeffs) {
+            candidates[i][0] = nearest;
+            candidates[i][1] = runner_up;
+            n_candidates[i] = (runner_up < 0) ? 1 : 2;
+            n_combinations *= n_candidates[i];
+        }
+    }
+
+    if (n_combinations == 1) {
+        return indices;
+    }
+
+    // Exhaustively search the pruned neighborhood, of at most 16 combinations
+    float reference[kNBins];
+    logEnvelope(padded, n_coeffs, reference);
+
+    auto n_searched = std::min(n_coeffs, kNSearchedCoeffs);
+    auto best_indices = indices;
+    auto best_error = std::numeric_limits<float>::infinity();
+
+    float quantized[coding_table::tms5220::kNCoeffs];
+    float envelope[kNBins];
+
+    for (int i = 0; i < n_coeffs; i++) {
+        quantized[i] = tables_[i][indices[i]];
+    }
+
+    for (int combination = 0; combination < n_combinations; combination++) {
+        auto remainder = combination;
+
+        for (int i = 0; i < n_searched; i++) {
+            auto choice = remainder % n_candidates[i];
+            remainder /= n_candidates[i];
+
+            indices[i] = candidates[i][choice];
+            quantized[i] = tables_[i][indices[i]];
+        }
+
+        logEnvelope(quantized, n_coeffs, envelope);
+
+        float error = 0.0f;
+        for (int bin = 0; bin < kNBins; bin++) {
+            auto difference = envelope[bin] - reference[bin];
+            error += difference * difference;
+        }
+
+        if (error < best_error) {
+            best_error = error;
+            best_indices = indices;
+        }
+    }
+
+    return best_indices;
+}
+
+void CoefficientQuantizer::apply(std::vector<Frame> &frames) const {
+    const auto n_tables = coding_table::tms5220::kNCoeffs;
+
+    for (auto &frame : frames) {
+        auto coeffs = frame.getCoeffs();
+
+        if (frame.isSilent() || static_cast<int>(coeffs.size()) < n_tables) {
+            continue;
+        }
+
+        auto n_coeffs = frame.isVoiced() ? n_tables : kNUnvoicedCoeffs;
+        auto indices = quantize(coeffs, n_coeffs);
+
+        for (int i = 0; i < n_tables; i++) {
+            coeffs[i] = tables_[i][indices[i]];
+        }
+
+        frame.setCoeffs(coeffs);
+    }
+}
+
+float CoefficientQuantizer::envelopeError(const std::vector<float> &coeffs,
+    const std::vector<int> &indices, int n_coeffs,
+    int n_quantized_coeffs) const {
+    //
+    n_coeffs = std::min(n_coeffs, coding_table::tms5220::kNCoeffs);
+
+    if (n_quantized_coeffs < 0 || n_quantized_coeffs > n_coeffs) {
+        n_quantized_coeffs = n_coeffs;
+    }
+
+    float padded[coding_table::tms5220::kNCoeffs];
+    padCoeffs(coeffs, padded);
+
+    float quantized[coding_table::tms5220::kNCoeffs];
+    for (int i = 0; i < n_quantized_coeffs; i++) {
+        quantized[i] = tables_[i][indices[i]];
+    }
+
+    float reference[kNBins];
+    float envelope[kNBins];
+    logEnvelope(padded, n_coeffs, reference);
+    logEnvelope(quantized, n_quantized_coeffs, envelope);
+
+    float error = 0.0f;
+    for (int bin = 0; bin < kNBins; bin++) {
+        auto difference = envelope[bin] - reference[bin];
+        error += difference * difference;
+    }
+
+    return error / kNBins;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void CoefficientQuantizer::logEnvelope(const float *coeffs, int n_coeffs,
+    float *envelope) const {
+    //
+    // Convert reflector coefficients to the predictor polynomial A(z) via the
+    // step-up recursion, matching the lattice of the Synthesizer
+    float a[coding_table::tms5220::kNCoeffs + 1] = {1.0f};
+    float previous[coding_table::tms5220::kNCoeffs + 1];
+
+    for (int m = 1; m <= n_coeffs; m++) {
+        std::copy(a, a + m, previous);
+
+        for (int i = 1; i < m; i++) {
+            a[i] = previous[i] + coeffs[m - 1] * previous[m - i];
+        }
+
+        a[m] = coeffs[m - 1];
+    }
+
+    // Evaluate A on the frequency grid one lag at a time, such that the inner
+    // loops run over contiguous bins and vectorize
+    float re[kNBins];
+    float im[kNBins];
+    std::fill(re, re + kNBins, 1.0f);
+    std::fill(im, im + kNBins, 0.0f);
+
+    for (int m = 1; m <= n_coeffs; m++) {
+        const auto *cos_row = &cos_table_[m * kNBins];
+        const auto *sin_row = &sin_table_[m * kNBins];
+
+        for (int bin = 0; bin < kNBins; bin++) {
+            re[bin] += a[m] * cos_row[bin];
+            im[bin] -= a[m] * sin_row[bin];
+        }
+    }
+
+    // The envelope is the power response of the all-pole filter 1/A(z)
+    for (int bin = 0; bin < kNBins; bin++) {
+        auto power = re[bin] * re[bin] + im[bin] * im[bin];
+        envelope[bin] = -kDecibelsPerOctave *
+            fastLog2(std::max(power, kPowerFloor));
+    }
+}
+
+};  // namespace tms_express
@@ -0,0 +1,94 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_FRAME_ENCODING_COEFFICIENTQUANTIZER_HPP_
+#define TMS_EXPRESS_FRAME_ENCODING_COEFFICIENTQUANTIZER_HPP_
+
+#include <vector>
+
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Quantizes LPC reflector coefficients by analysis-by-synthesis
+/// @details Rounding each coefficient to its nearest TMS5220 Coding Table
+///             entry ignores that errors in the low-order coefficients
+///             dominate spectral distortion. The Coefficient Quantizer
+///             instead searches the table entries neighboring k1-k4 and
+///             selects the combination whose all-pole envelope is closest to
+///             that of the unquantized filter
+class CoefficientQuantizer {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Coefficient Quantizer, precomputing the
+    ///         frequency grid on which envelopes are compared
+    CoefficientQuantizer();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Quantization ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Quantizes reflector coefficients via TMS5220 Coding Table
+    /// @param coeffs Unquantized reflector coefficients, where any beyond the
+    ///                 end of the vector are treated as zero
+    /// @param n_coeffs Number of coefficients which will be synthesized, which
+    ///                 is 10 for voiced frames and 4 for unvoiced frames
+    /// @return Vector of Coding Table indices, one per table. Indices beyond
+    ///         n_coeffs are those of the closest table entry
+    std::vector<int> quantize(const std::vector<float> &coeffs,
+        int n_coeffs) const;
+
+    /// @brief Replaces the coefficients of each non-silent Frame with the
+    ///         Coding Table entries selected by quantize()
+    /// @param frames Frame table, which is modified in place
+    /// @note Because the replaced coefficients lie exactly on table entries,
+    ///         Frame::quantizedCoeffs() subsequently yields the selected
+    ///         indices
+    void apply(std::vector<Frame> &frames) const;
+
+    /// @brief Measures the distortion introduced by quantization
+    /// @param coeffs Unquantized reflector coefficients, where any beyond the
+    ///                 end of the vector are treated as zero
+    /// @param indices Coding Table indices
+    /// @param n_coeffs Number of coefficients to compare
+    /// @param n_quantized_coeffs Number of coefficients of the quantized
+    ///                             filter, if fewer than n_coeffs, such as
+    ///                             when a voiced frame is encoded as unvoiced
+    /// @return Mean squared difference between the log envelopes of the
+    ///         unquantized and quantized filters, in squared decibels
+    float envelopeError(const std::vector<float> &coeffs,
+        const std::vector<int> &indices, int n_coeffs,
+        int n_quantized_coeffs = -1) const;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes log power envelope of all-pole lattice filter
+    /// @param coeffs Reflector coefficients
+    /// @param n_coeffs Number of reflector coefficients
+    /// @param envelope Destination of envelope, in decibels
+    void logEnvelope(const float *coeffs, int n_coeffs, float *envelope) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief TMS5220 Coding Table of each reflector coefficient
+    std::vector<std::vector<float>> tables_;
+
+    /// @brief Cosine of each bin frequency times each polynomial lag, as one
+    ///         row of bins per lag
+    std::vector<float> cos_table_;
+
+    /// @brief Sine of each bin frequency times each polynomial lag, as one
+    ///         row of bins per lag
+    std::vector<float> sin_table_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_FRAME_ENCODING_COEFFICIENTQUANTIZER_HPP_
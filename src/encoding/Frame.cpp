@@ -16,7 +16,7 @@ namespace tms_express {
 // Initializers ///////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-Frame::Frame(int pitch_period, bool is_voiced, float gain_db,
+Frame::Frame(float pitch_period, bool is_voiced, float gain_db,
     std::vector<float> coeffs) {
     //
     gain_db_ = gain_db;
@@ -24,6 +24,7 @@ Frame::Frame(int pitch_period, bool is_voiced, float gain_db,
     coeffs_ = coeffs;
     is_repeat_ = false;
     is_voiced_ = is_voiced;
+    spectral_change_db_ = 0.0f;
 
     // The gain may be NaN if the autocorrelation is zero, meaning:
     //  1. The Frame is completely silent (source audio is noise-isolated)
@@ -66,11 +67,11 @@ void Frame::setGain(int idx) {
     }
 }
 
-int Frame::getPitch() const {
+float Frame::getPitch() const {
     return pitch_period_;
 }
 
-void Frame::setPitch(int pitch) {
+void Frame::setPitch(float pitch) {
     pitch_period_ = pitch;
 }
 
@@ -90,6 +91,14 @@ void Frame::setVoicing(bool isVoiced) {
     is_voiced_ = isVoiced;
 }
 
+float Frame::getSpectralChange() const {
+    return spectral_change_db_;
+}
+
+void Frame::setSpectralChange(float change_db) {
+    spectral_change_db_ = change_db;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Quantized Getters //////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -148,6 +157,20 @@ bool Frame::isVoiced() const {
     return is_voiced_;
 }
 
+int Frame::getNBits() const {
+    if (isSilent()) {
+        return coding_table::tms5220::kSilentFrameBitWidth;
+
+    } else if (isRepeat()) {
+        return coding_table::tms5220::kRepeatFrameBitWidth;
+
+    } else if (isVoiced()) {
+        return coding_table::tms5220::kVoicedFrameBitWidth;
+    }
+
+    return coding_table::tms5220::kUnvoicedFrameBitWidth;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Serializers ////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -20,12 +20,12 @@ class Frame {
     ///////////////////////////////////////////////////////////////////////////
 
     /// @brief Stores a new Frame
-    /// @param pitch_period Pitch period, in samples
+    /// @param pitch_period Pitch period, in (possibly fractional) samples
     /// @param is_voiced true if Frame represents voiced (vowel) sample,
     ///                     false for unvoiced (consonant)
     /// @param gain_db Gain, in decibels
     /// @param coeffs LPC reflector coefficients
-    Frame(int pitch_period, bool is_voiced, float gain_db,
+    Frame(float pitch_period, bool is_voiced, float gain_db,
         std::vector<float> coeffs);
 
     ///////////////////////////////////////////////////////////////////////////
@@ -61,11 +61,11 @@ class Frame {
 
     /// @brief Accesses the pitch period
     /// @return Pitch period, in samples
-    int getPitch() const;
+    float getPitch() const;
 
     /// @brief Sets the pitch period
     /// @param pitch New pitch period, in samples
-    void setPitch(int pitch);
+    void setPitch(float pitch);
 
     /// @brief Checks if Frame is repeat of adjacent Frame
     /// @return true if Frame marked as repeat, false otherwise
@@ -84,6 +84,17 @@ class Frame {
     /// @param isVoiced true if Frame is voiced (vowel) or unvoiced (consonant)
     void setVoicing(bool isVoiced);
 
+    /// @brief Accesses the spectral change since the previous Frame
+    /// @return Log-spectral distance between the source segments of this Frame
+    ///         and its predecessor, in decibels
+    /// @note This property is determined during analysis, and is zero for
+    ///         Frames which were not produced by analysis
+    float getSpectralChange() const;
+
+    /// @brief Sets the spectral change since the previous Frame
+    /// @param change_db Log-spectral distance, in decibels
+    void setSpectralChange(float change_db);
+
     ///////////////////////////////////////////////////////////////////////////
     // Quantized Getters //////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -121,6 +132,10 @@ class Frame {
     /// @return true if Frame is voiced, false if unvoiced
     bool isVoiced() const;
 
+    /// @brief Computes the size of the encoded Frame without serializing it
+    /// @return Number of bits in the binary representation of the Frame
+    int getNBits() const;
+
     ///////////////////////////////////////////////////////////////////////////
     // Serializers ////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -161,7 +176,9 @@ class Frame {
     float gain_db_;
 
     /// @brief Pitch period, in samples
-    int pitch_period_;
+    /// @note The period may be fractional, as sub-sample pitch estimates map
+    ///         more accurately onto the TMS5220 Coding Table
+    float pitch_period_;
 
     /// @brief LPC reflector coefficients
     std::vector<float> coeffs_;
@@ -171,6 +188,9 @@ class Frame {
 
     /// @brief true if Frame is voiced (vowel), false if unvoiced (consonant)
     bool is_voiced_;
+
+    /// @brief Spectral change since the previous Frame, in decibels
+    float spectral_change_db_;
 };
 
 };  // namespace tms_express
@@ -2,13 +2,47 @@
 
 #include "encoding/FramePostprocessor.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 #include "encoding/CodingTable.hpp"
+#include "encoding/CoefficientQuantizer.hpp"
 #include "encoding/Frame.hpp"
 
 namespace tms_express {
 
+/// @brief Default max number of consecutive repeat Frames
+static constexpr int kDefaultMaxRepeatChain = 4;
+
+/// @brief Spectral distortion charged for silencing a Frame, per step of its
+///         gain in the TMS5220 Coding Table, in decibels
+/// @note Frames at the quietest non-zero gain are barely audible, but dropping
+///         one is worse than a poor repeat
+static constexpr float kSilencedFrameDistortionDb = 10.0f;
+
+/// @brief Spectral distortion charged for demoting a voiced Frame to
+///         unvoiced, in addition to the loss of its upper six coefficients,
+///         in decibels
+static constexpr float kDemotedFrameDistortionDb = 6.0f;
+
+/// @brief Number of coefficients encoded by unvoiced Frames
+static constexpr int kNUnvoicedCoeffs = 4;
+
+/// @brief Upper bound of the bit cost searched when fitting a budget, in
+///         decibels per bit, beyond which every permissible repeat is chosen
+static constexpr float kMaxLambda = 10.0f;
+
+/// @brief Number of bisection steps when fitting a budget
+static constexpr int kNBisectionSteps = 32;
+
+/// @brief Placeholder in a plan for a silent Frame
+static constexpr int kSilentAnchor = -1;
+
+/// @brief Placeholder in a plan for a voiced Frame encoded as unvoiced
+static constexpr int kDemotedAnchor = -2;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Initializers ///////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -20,6 +54,9 @@ FramePostprocessor::FramePostprocessor(std::vector<Frame> *frames,
     frame_table_ = frames;
     max_unvoiced_gain_db_ = max_unvoiced_gain_db;
     max_voiced_gain_db_ = max_voiced_gain_db;
+    max_repeat_chain_ = kDefaultMaxRepeatChain;
+    max_silenced_gain_ = 1;
+    voiced_demotion_ = false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -42,6 +79,30 @@ void FramePostprocessor::setMaxVoicedGainDB(float gain_db) {
     max_voiced_gain_db_ = gain_db;
 }
 
+int FramePostprocessor::getMaxRepeatChain() const {
+    return max_repeat_chain_;
+}
+
+void FramePostprocessor::setMaxRepeatChain(int length) {
+    max_repeat_chain_ = std::max(length, 0);
+}
+
+int FramePostprocessor::getMaxSilencedGain() const {
+    return max_silenced_gain_;
+}
+
+void FramePostprocessor::setMaxSilencedGain(int index) {
+    max_silenced_gain_ = std::max(index, 0);
+}
+
+bool FramePostprocessor::getVoicedDemotion() const {
+    return voiced_demotion_;
+}
+
+void FramePostprocessor::setVoicedDemotion(bool enabled) {
+    voiced_demotion_ = enabled;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Frame Table Manipulators ///////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -71,6 +132,116 @@ int FramePostprocessor::detectRepeatFrames() {
     return n_repeat_frames;
 }
 
+int FramePostprocessor::adaptFrameRate(float max_change_db) {
+    int n_repeat_frames = 0;
+    int chain = 0;
+    float change_db = 0.0f;
+
+    for (int i = 0; i < static_cast<int>(frame_table_->size()); i++) {
+        auto &frame = frame_table_->at(i);
+        frame.setRepeat(false);
+
+        if (i == 0 || frame.isSilent()) {
+            continue;
+        }
+
+        const auto &previous_frame = frame_table_->at(i - 1);
+
+        // Summing the change of each Frame bounds the change since the last
+        // fully-encoded Frame, as the log-spectral distance is a metric
+        change_db += frame.getSpectralChange();
+
+        auto is_steady = !previous_frame.isSilent() &&
+            previous_frame.isVoiced() == frame.isVoiced() &&
+            chain < max_repeat_chain_ && change_db <= max_change_db;
+
+        if (is_steady) {
+            frame.setRepeat(true);
+            n_repeat_frames++;
+            chain++;
+
+        } else {
+            chain = 0;
+            change_db = 0.0f;
+        }
+    }
+
+    return n_repeat_frames;
+}
+
+int FramePostprocessor::optimizeRepeatFrames(float lambda) {
+    auto distortions = computeRepeatDistortions();
+    auto anchors = std::vector<int>();
+    int n_bits = 0;
+
+    planRepeatFrames(lambda, distortions, &anchors, &n_bits);
+    return applyRepeatFrames(anchors);
+}
+
+int FramePostprocessor::fitRepeatFramesToBitrate(float bits_per_frame) {
+    auto distortions = computeRepeatDistortions();
+    auto anchors = std::vector<int>();
+    auto n_frames = static_cast<float>(frame_table_->size());
+    int n_bits = 0;
+
+    // Raising lambda trades distortion for bits, so bisect for the least
+    // lambda which meets the bitrate, as it yields the least distortion
+    planRepeatFrames(0.0f, distortions, &anchors, &n_bits);
+
+    if (n_bits <= bits_per_frame * n_frames) {
+        return applyRepeatFrames(anchors);
+    }
+
+    float lower = 0.0f;
+    float upper = kMaxLambda;
+
+    for (int step = 0; step < kNBisectionSteps; step++) {
+        auto lambda = 0.5f * (lower + upper);
+        planRepeatFrames(lambda, distortions, &anchors, &n_bits);
+
+        if (n_bits <= bits_per_frame * n_frames) {
+            upper = lambda;
+        } else {
+            lower = lambda;
+        }
+    }
+
+    planRepeatFrames(upper, distortions, &anchors, &n_bits);
+    return applyRepeatFrames(anchors);
+}
+
+int FramePostprocessor::fitRepeatFramesToDistortion(float distortion_db) {
+    auto distortions = computeRepeatDistortions();
+    auto anchors = std::vector<int>();
+    int n_bits = 0;
+
+    // Conversely, bisect for the greatest lambda which meets the distortion
+    // budget, as it yields the smallest bitstream
+    if (planRepeatFrames(kMaxLambda, distortions, &anchors, &n_bits) <=
+        distortion_db) {
+        //
+        return applyRepeatFrames(anchors);
+    }
+
+    float lower = 0.0f;
+    float upper = kMaxLambda;
+
+    for (int step = 0; step < kNBisectionSteps; step++) {
+        auto lambda = 0.5f * (lower + upper);
+
+        if (planRepeatFrames(lambda, distortions, &anchors, &n_bits) <=
+            distortion_db) {
+            //
+            lower = lambda;
+        } else {
+            upper = lambda;
+        }
+    }
+
+    planRepeatFrames(lower, distortions, &anchors, &n_bits);
+    return applyRepeatFrames(anchors);
+}
+
 void FramePostprocessor::normalizeGain() {
     normalizeGain(true);
     normalizeGain(false);
@@ -155,6 +326,20 @@ void FramePostprocessor::reset() {
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Metadata ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int FramePostprocessor::getNBits() const {
+    int n_bits = 0;
+
+    for (const Frame &frame : *frame_table_) {
+        n_bits += frame.getNBits();
+    }
+
+    return n_bits;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Helpers ////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -186,4 +371,213 @@ void FramePostprocessor::normalizeGain(bool target_voiced) {
     }
 }
 
+std::vector<float> FramePostprocessor::computeRepeatDistortions() const {
+    auto n_frames = static_cast<int>(frame_table_->size());
+    auto stride = max_repeat_chain_ + 2;
+    auto distortions = std::vector<float>(n_frames * stride,
+        std::numeric_limits<float>::infinity());
+
+    auto quantizer = CoefficientQuantizer();
+    auto indices = std::vector<std::vector<int>>(n_frames);
+
+    for (int i = 0; i < n_frames; i++) {
+        indices[i] = frame_table_->at(i).quantizedCoeffs();
+    }
+
+    // A repeat Frame is synthesized with the coefficients of the Frame that
+    // began its chain, which must be of the same voicing, since unvoiced
+    // Frames do not encode the upper six coefficients. Silent Frames neither
+    // repeat nor begin chains, and so end any chain which reaches them
+    for (int i = 0; i < n_frames; i++) {
+        const auto &frame = frame_table_->at(i);
+
+        if (frame.isSilent()) {
+            continue;
+        }
+
+        auto coeffs = frame.getCoeffs();
+        auto n_coeffs = frame.isVoiced() ?
+            coding_table::tms5220::kNCoeffs : kNUnvoicedCoeffs;
+
+        for (int r = 0; r <= max_repeat_chain_ && r <= i; r++) {
+            const auto &anchor = frame_table_->at(i - r);
+
+            if (anchor.isSilent() || anchor.isVoiced() != frame.isVoiced()) {
+                break;
+            }
+
+            distortions[i * stride + r] = sqrtf(quantizer.envelopeError(coeffs,
+                indices[i - r], n_coeffs));
+        }
+
+        if (voiced_demotion_ && frame.isVoiced()) {
+            distortions[i * stride + stride - 1] = kDemotedFrameDistortionDb +
+                sqrtf(quantizer.envelopeError(coeffs, indices[i], n_coeffs,
+                kNUnvoicedCoeffs));
+        }
+    }
+
+    return distortions;
+}
+
+float FramePostprocessor::planRepeatFrames(float lambda,
+    const std::vector<float> &distortions, std::vector<int> *anchors,
+    int *n_bits) const {
+    //
+    auto n_frames = static_cast<int>(frame_table_->size());
+    auto stride = max_repeat_chain_ + 2;
+
+    // The cost of the first i Frames, and the first Frame of the chain (or
+    // silence, or demotion) which ends at Frame i - 1, under the best plan
+    auto costs = std::vector<double>(n_frames + 1,
+        std::numeric_limits<double>::infinity());
+    auto starts = std::vector<int>(n_frames + 1, kSilentAnchor);
+    costs[0] = 0.0;
+
+    // Each chain begins with a fully-encoded Frame and is followed by up to
+    // max chain repeats. Since costs[j] is final once all chains ending
+    // before Frame j are considered, one forward pass suffices
+    for (int j = 0; j < n_frames; j++) {
+        const auto &frame = frame_table_->at(j);
+        auto gain = frame.quantizedGain();
+
+        if (frame.isSilent() || gain <= max_silenced_gain_) {
+            auto silence = costs[j] +
+                lambda * coding_table::tms5220::kSilentFrameBitWidth +
+                kSilencedFrameDistortionDb * gain;
+
+            if (silence < costs[j + 1]) {
+                costs[j + 1] = silence;
+                starts[j + 1] = kSilentAnchor;
+            }
+        }
+
+        if (frame.isSilent()) {
+            continue;
+        }
+
+        // A demoted Frame stands alone, as repeats of it would be voiced
+        // Frames synthesized without their upper six coefficients
+        auto demotion = distortions[j * stride + stride - 1];
+
+        if (!std::isinf(demotion)) {
+            auto cost = costs[j] + demotion +
+                lambda * coding_table::tms5220::kUnvoicedFrameBitWidth;
+
+            if (cost < costs[j + 1]) {
+                costs[j + 1] = cost;
+                starts[j + 1] = kDemotedAnchor;
+            }
+        }
+
+        auto bits = frame.isVoiced() ?
+            coding_table::tms5220::kVoicedFrameBitWidth :
+            coding_table::tms5220::kUnvoicedFrameBitWidth;
+        auto cost = costs[j] + lambda * bits + distortions[j * stride];
+
+        for (int e = j; e < n_frames && e - j <= max_repeat_chain_; e++) {
+            if (e > j) {
+                auto distortion = distortions[e * stride + (e - j)];
+
+                if (frame_table_->at(e).isSilent() || std::isinf(distortion)) {
+                    break;
+                }
+
+                cost += lambda * coding_table::tms5220::kRepeatFrameBitWidth +
+                    distortion;
+            }
+
+            if (cost < costs[e + 1]) {
+                costs[e + 1] = cost;
+                starts[e + 1] = j;
+            }
+        }
+    }
+
+    // Trace the best plan back from the final Frame
+    anchors->assign(n_frames, kSilentAnchor);
+    *n_bits = 0;
+
+    float total_distortion = 0.0f;
+    int n_active_frames = 0;
+
+    for (int i = n_frames; i > 0;) {
+        auto start = starts[i];
+        const auto &frame = frame_table_->at(i - 1);
+
+        if (start == kSilentAnchor || start == kDemotedAnchor) {
+            anchors->at(i - 1) = start;
+
+            if (start == kDemotedAnchor) {
+                *n_bits += coding_table::tms5220::kUnvoicedFrameBitWidth;
+                total_distortion += distortions[(i - 1) * stride + stride - 1];
+            } else {
+                *n_bits += coding_table::tms5220::kSilentFrameBitWidth;
+                total_distortion += kSilencedFrameDistortionDb *
+                    frame.quantizedGain();
+            }
+
+            n_active_frames += !frame.isSilent();
+            i--;
+            continue;
+        }
+
+        for (int k = start; k < i; k++) {
+            const auto &member = frame_table_->at(k);
+
+            anchors->at(k) = start;
+            total_distortion += distortions[k * stride + (k - start)];
+            n_active_frames++;
+
+            if (k > start) {
+                *n_bits += coding_table::tms5220::kRepeatFrameBitWidth;
+            } else if (member.isVoiced()) {
+                *n_bits += coding_table::tms5220::kVoicedFrameBitWidth;
+            } else {
+                *n_bits += coding_table::tms5220::kUnvoicedFrameBitWidth;
+            }
+        }
+
+        i = start;
+    }
+
+    if (n_active_frames == 0) {
+        return 0.0f;
+    }
+
+    return total_distortion / static_cast<float>(n_active_frames);
+}
+
+int FramePostprocessor::applyRepeatFrames(const std::vector<int> &anchors) {
+    int n_repeat_frames = 0;
+
+    for (int i = 0; i < static_cast<int>(frame_table_->size()); i++) {
+        auto &frame = frame_table_->at(i);
+
+        if (anchors[i] == kSilentAnchor) {
+            frame.setRepeat(false);
+
+            if (!frame.isSilent()) {
+                frame.setGain(0);
+            }
+
+            continue;
+        }
+
+        // The Synthesizer infers voicing from the pitch period
+        if (anchors[i] == kDemotedAnchor) {
+            frame.setRepeat(false);
+            frame.setVoicing(false);
+            frame.setPitch(0.0f);
+
+            continue;
+        }
+
+        frame.setRepeat(anchors[i] != i);
+        n_repeat_frames += (anchors[i] != i);
+    }
+
+    return n_repeat_frames;
+}
+
 };  // namespace tms_express
@@ -43,6 +43,36 @@ class FramePostprocessor {
     /// @param gain_db Max voiced gain, in decibels
     void setMaxVoicedGainDB(float gain_db);
 
+    /// @brief Accesses the max number of consecutive repeat Frames
+    /// @return Max repeat chain length
+    int getMaxRepeatChain() const;
+
+    /// @brief Sets the max number of consecutive repeat Frames which may share
+    ///         the coefficients of a single fully-encoded Frame
+    /// @param length Max repeat chain length
+    void setMaxRepeatChain(int length);
+
+    /// @brief Accesses the loudest gain at which Frames may be silenced
+    /// @return Index into TMS5220 Coding Table's RMS vector
+    int getMaxSilencedGain() const;
+
+    /// @brief Sets the loudest gain at which rate-distortion optimization may
+    ///         silence Frames
+    /// @param index Index into TMS5220 Coding Table's RMS vector, where 1 (the
+    ///                 quietest non-zero gain) is the default and 0 disables
+    ///                 silencing
+    void setMaxSilencedGain(int index);
+
+    /// @brief Checks whether rate-distortion optimization may encode voiced
+    ///         Frames as unvoiced
+    /// @return true if voiced Frames may be demoted, false otherwise
+    bool getVoicedDemotion() const;
+
+    /// @brief Allows rate-distortion optimization to encode voiced Frames as
+    ///         unvoiced, which omits their upper six coefficients
+    /// @param enabled true to allow demotion, false otherwise
+    void setVoicedDemotion(bool enabled);
+
     ///////////////////////////////////////////////////////////////////////////
     // Frame Table Manipulators ///////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -56,6 +86,51 @@ class FramePostprocessor {
     ///             encoded. This effectively compresses the bitstream
     int detectRepeatFrames();
 
+    /// @brief Marks Frames within spectrally steady regions as repeats, such
+    ///         that the effective frame rate adapts to the speech
+    /// @param max_change_db Max spectral change between a fully-encoded Frame
+    ///                         and its repeats, in decibels
+    /// @return Number of repeat Frames selected
+    /// @details During steady vowels, consecutive Frames share their
+    ///             coefficients in chains of up to the max repeat chain
+    ///             length, lowering the effective frame rate. A Frame whose
+    ///             spectrum has moved beyond the threshold since the last
+    ///             fully-encoded Frame, as in plosives and other transients,
+    ///             is fully encoded at the analysis frame rate. Spectral change
+    ///             is accumulated from the per-Frame measure computed during
+    ///             analysis
+    /// @note Previous repeat decisions are discarded
+    int adaptFrameRate(float max_change_db);
+
+    /// @brief Selects repeat and silent Frames which minimize spectral
+    ///         distortion plus lambda times bitstream size
+    /// @param lambda Cost of each bit, in decibels of spectral distortion
+    /// @return Number of repeat Frames selected
+    /// @details A repeat Frame costs 11 bits rather than 29 (unvoiced) or 50
+    ///             (voiced), but is synthesized with the coefficients of the
+    ///             last fully-encoded Frame. Likewise, the quietest Frames
+    ///             may be silenced, costing 4 bits, and, if permitted, voiced
+    ///             Frames may be demoted to unvoiced. The optimal selection is
+    ///             found via dynamic programming, in time linear in the
+    ///             number of Frames and the max repeat chain length
+    /// @note Previous repeat decisions are discarded. Frames must already be
+    ///         gain-adjusted, as gain determines which Frames are silent
+    int optimizeRepeatFrames(float lambda);
+
+    /// @brief Selects repeat and silent Frames which minimize spectral
+    ///         distortion without exceeding a bitrate
+    /// @param bits_per_frame Max mean size of each Frame, in bits
+    /// @return Number of repeat Frames selected
+    /// @note If the bitrate is unattainable, the smallest bitstream is chosen
+    int fitRepeatFramesToBitrate(float bits_per_frame);
+
+    /// @brief Selects repeat and silent Frames which minimize bitstream size
+    ///         without exceeding a spectral distortion
+    /// @param distortion_db Max mean spectral distortion of non-silent Frames,
+    ///                         in decibels
+    /// @return Number of repeat Frames selected
+    int fitRepeatFramesToDistortion(float distortion_db);
+
     /// @brief Applies gain normalization to all Frames
     /// @note Gain normalization reduces DC offset and creates natural volume
     void normalizeGain();
@@ -82,6 +157,14 @@ class FramePostprocessor {
     /// @note Does not reset voiced or unvoiced gain limits
     [[deprecated]] void reset();
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Metadata ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Computes the size of the encoded Frame table
+    /// @return Bits in bitstream, excluding the stop frame
+    int getNBits() const;
+
  private:
     ///////////////////////////////////////////////////////////////////////////
     // Helpers ////////////////////////////////////////////////////////////////
@@ -92,6 +175,31 @@ class FramePostprocessor {
     ///                         for unvoiced Frames
     void normalizeGain(bool target_voiced);
 
+    /// @brief Computes the spectral distortion of synthesizing each Frame
+    ///         with the quantized coefficients of each of its predecessors
+    ///         within the max repeat chain length
+    /// @return Distortion of Frame i with the coefficients of Frame i - r, in
+    ///         decibels, at index i * (max chain + 2) + r, followed by the
+    ///         distortion of demoting Frame i to unvoiced
+    std::vector<float> computeRepeatDistortions() const;
+
+    /// @brief Finds repeat and silent Frames which minimize distortion plus
+    ///         lambda times bitstream size, without modifying Frames
+    /// @param lambda Cost of each bit, in decibels of spectral distortion
+    /// @param distortions Output of computeRepeatDistortions()
+    /// @param anchors Destination of the index of the fully-encoded Frame
+    ///                 whose coefficients each Frame uses, -1 if silent, or -2
+    ///                 if demoted to unvoiced
+    /// @param n_bits Destination of bitstream size
+    /// @return Mean spectral distortion of non-silent Frames, in decibels
+    float planRepeatFrames(float lambda, const std::vector<float> &distortions,
+        std::vector<int> *anchors, int *n_bits) const;
+
+    /// @brief Marks Frames as repeat or silent per a plan
+    /// @param anchors Output of planRepeatFrames()
+    /// @return Number of repeat Frames
+    int applyRepeatFrames(const std::vector<int> &anchors);
+
     ///////////////////////////////////////////////////////////////////////////
     // Members ////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -108,6 +216,16 @@ class FramePostprocessor {
     /// @brief Max voiced (vowel) gain, in decibels
     float max_voiced_gain_db_;
 
+    /// @brief Max number of consecutive repeat Frames
+    int max_repeat_chain_;
+
+    /// @brief Loudest gain at which Frames may be silenced, as TMS5220 Coding
+    ///         Table index
+    int max_silenced_gain_;
+
+    /// @brief true if voiced Frames may be demoted to unvoiced
+    bool voiced_demotion_;
+
 };
 
 };  // namespace tms_express
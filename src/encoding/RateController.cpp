@@ -0,0 +1,159 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "encoding/RateController.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "encoding/CodingTable.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/FramePostprocessor.hpp"
+
+namespace tms_express {
+
+/// @brief Number of escalating rate control stages. The first permits
+///         repeats and silencing of the quietest gain, the second adds
+///         demotion, and each subsequent stage s permits silencing of gains
+///         up to s
+/// @note The loudest gain index (15) is reserved for the stop frame
+static constexpr int kNStages = 15;
+
+///////////////////////////////////////////////////////////////////////////////
+// Structures /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool RateController::Result::isWithinBudget() const {
+    return max_bytes <= 0 || n_bytes <= max_bytes;
+}
+
+std::string RateController::Result::toString() const {
+    char budget[64] = "unlimited";
+
+    if (max_bytes > 0) {
+        snprintf(budget, sizeof(budget), "%d bytes%s", max_bytes,
+            isWithinBudget() ? "" : ", exceeded");
+    }
+
+    char summary[512];
+    snprintf(summary, sizeof(summary),
+        "Bitstream size:         %d bytes\n"
+        "Budget:                 %s\n"
+        "Repeat frames:          %d\n"
+        "Demoted frames:         %d\n"
+        "Silenced frames:        %d\n",
+        n_bytes, budget, n_repeat_frames, n_demoted_frames,
+        n_silenced_frames);
+
+    return summary;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+RateController::RateController(int max_bytes, bool include_stop_frame) {
+    max_bytes_ = max_bytes;
+    include_stop_frame_ = include_stop_frame;
+    max_repeat_chain_ = 4;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Configuration //////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void RateController::setMaxRepeatChain(int length) {
+    max_repeat_chain_ = length;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Rate Control ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+RateController::Result RateController::fit(std::vector<Frame> &frames) const {
+    auto original = frames;
+
+    if (max_bytes_ <= 0 || frames.empty()) {
+        return measure(original, frames);
+    }
+
+    // The stop frame shares its byte with the final frame, so the budget is
+    // expressed in bits before padding
+    auto stop_bits = include_stop_frame_ ?
+        coding_table::tms5220::kStopFrameBitWidth : 0;
+    auto max_bits = 8 * max_bytes_ - stop_bits;
+    auto bits_per_frame = static_cast<float>(max_bits) /
+        static_cast<float>(frames.size());
+
+    // Each stage starts over from the original table, since demoted and
+    // silenced Frames cannot be restored
+    for (int stage = 0; stage < kNStages; stage++) {
+        auto trial = original;
+        auto post_processor = FramePostprocessor(&trial);
+
+        post_processor.setMaxRepeatChain(max_repeat_chain_);
+        post_processor.setVoicedDemotion(stage >= 1);
+        post_processor.setMaxSilencedGain(std::max(1, stage));
+        post_processor.fitRepeatFramesToBitrate(bits_per_frame);
+
+        frames = trial;
+
+        if (countBytes(frames, include_stop_frame_) <= max_bytes_) {
+            break;
+        }
+    }
+
+    return measure(original, frames);
+}
+
+int RateController::countBytes(const std::vector<Frame> &frames,
+    bool include_stop_frame) {
+    //
+    int n_bits = include_stop_frame ?
+        coding_table::tms5220::kStopFrameBitWidth : 0;
+
+    for (const auto &frame : frames) {
+        n_bits += frame.getNBits();
+    }
+
+    return (n_bits + 7) / 8;
+}
+
+int RateController::bytesForBitrate(float bits_per_second, int n_frames,
+    float window_width_ms) {
+    //
+    auto duration_s = static_cast<float>(n_frames) * window_width_ms * 1e-3f;
+    auto max_bytes = floorf(bits_per_second * duration_s / 8.0f);
+
+    // A budget of zero would instead disable rate control
+    return std::max(1, static_cast<int>(max_bytes));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+RateController::Result RateController::measure(
+    const std::vector<Frame> &original,
+    const std::vector<Frame> &frames) const {
+    //
+    auto result = Result();
+    result.n_bytes = countBytes(frames, include_stop_frame_);
+    result.max_bytes = max_bytes_;
+
+    for (int i = 0; i < static_cast<int>(frames.size()); i++) {
+        const auto &before = original[i];
+        const auto &after = frames[i];
+
+        result.n_repeat_frames += after.isRepeat() && !after.isSilent();
+        result.n_silenced_frames += after.isSilent() && !before.isSilent();
+        result.n_demoted_frames += before.isVoiced() && !after.isVoiced() &&
+            !after.isSilent();
+    }
+
+    return result;
+}
+
+};  // namespace tms_express
@@ -0,0 +1,126 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_FRAME_ENCODING_RATECONTROLLER_HPP_
+#define TMS_EXPRESS_FRAME_ENCODING_RATECONTROLLER_HPP_
+
+#include <string>
+#include <vector>
+
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Fits a Frame table to a byte budget
+/// @details The Rate Controller applies progressively more aggressive
+///             rate-distortion optimization until the encoded Frame table
+///             fits the budget: first repeat frames and silencing of the
+///             quietest frames, then demotion of voiced frames to unvoiced,
+///             then silencing of increasingly loud frames. Sizes are
+///             computed from the TMS5220 frame sizes, without serializing
+class RateController {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Structures /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Size of an encoded Frame table, and the means used to reach it
+    struct Result {
+        /// @brief Size of the bitstream, in bytes
+        int n_bytes = 0;
+
+        /// @brief Byte budget, or zero if unlimited
+        int max_bytes = 0;
+
+        /// @brief Number of repeat frames
+        int n_repeat_frames = 0;
+
+        /// @brief Number of voiced frames encoded as unvoiced
+        int n_demoted_frames = 0;
+
+        /// @brief Number of non-silent frames which were silenced
+        int n_silenced_frames = 0;
+
+        /// @brief Reports whether the bitstream fits the budget
+        /// @return true if within budget or unlimited, false otherwise
+        bool isWithinBudget() const;
+
+        /// @brief Summarizes the result, one field per line
+        /// @return Human-readable summary
+        std::string toString() const;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Rate Controller
+    /// @param max_bytes Max size of the bitstream, in bytes, or zero for no
+    ///                     limit
+    /// @param include_stop_frame true if the bitstream will end with a stop
+    ///                             frame, which counts against the budget
+    explicit RateController(int max_bytes = 0, bool include_stop_frame = true);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration //////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sets the max number of consecutive repeat frames
+    /// @param length Max repeat chain length
+    void setMaxRepeatChain(int length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Rate Control ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Selects repeat, demoted, and silent Frames such that the Frame
+    ///         table fits the budget with the least spectral distortion
+    /// @param frames Gain-adjusted Frame table, which is modified in place
+    /// @return Achieved size. If the budget is unattainable, the smallest
+    ///         possible Frame table is produced
+    /// @note If the budget is unlimited, the Frame table is only measured
+    Result fit(std::vector<Frame> &frames) const;
+
+    /// @brief Computes the size of a bitstream without serializing it
+    /// @param frames Frame table
+    /// @param include_stop_frame true if bitstream ends with a stop frame
+    /// @return Size of bitstream, in bytes
+    static int countBytes(const std::vector<Frame> &frames,
+        bool include_stop_frame);
+
+    /// @brief Converts a bitrate to the byte budget of a Frame table
+    /// @param bits_per_second Bitrate, in bits per second
+    /// @param n_frames Number of Frames
+    /// @param window_width_ms Duration of each Frame, in milliseconds
+    /// @return Byte budget, of at least one byte
+    static int bytesForBitrate(float bits_per_second, int n_frames,
+        float window_width_ms);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Describes the changes made to a Frame table
+    /// @param original Frame table prior to rate control
+    /// @param frames Frame table after rate control
+    /// @return Result describing the Frame table
+    Result measure(const std::vector<Frame> &original,
+        const std::vector<Frame> &frames) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Max size of the bitstream, in bytes, or zero for no limit
+    int max_bytes_;
+
+    /// @brief true if the bitstream ends with a stop frame
+    bool include_stop_frame_;
+
+    /// @brief Max number of consecutive repeat frames
+    int max_repeat_chain_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_FRAME_ENCODING_RATECONTROLLER_HPP_
@@ -0,0 +1,205 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "encoding/SynthesisStream.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/Resampler.hpp"
+#include "audio/RingBuffer.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/Synthesizer.hpp"
+
+namespace tms_express {
+
+/// @brief Sample rate of the TMS5220 synthesis model, in Hertz
+static constexpr int kSynthesisRateHz = 8000;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+SynthesisStream::SynthesisStream(int output_sample_rate_hz, float latency_ms):
+    synthesizer_(kSynthesisRateHz),
+    ring_buffer_(static_cast<int>(
+        static_cast<float>(output_sample_rate_hz) * latency_ms * 1e-3f)) {
+    //
+    output_sample_rate_hz_ = output_sample_rate_hz;
+    resampler_ = nullptr;
+    frames_ = std::make_shared<const std::vector<Frame>>();
+    next_frame_ = 0;
+    is_running_ = false;
+    is_produced_ = true;
+}
+
+SynthesisStream::~SynthesisStream() {
+    stop();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Control ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SynthesisStream::start(std::shared_ptr<const std::vector<Frame>> frames) {
+    stop();
+
+    // The resampler carries filter state across blocks, so each stream needs
+    // a fresh one
+    resampler_ = nullptr;
+
+    if (output_sample_rate_hz_ != kSynthesisRateHz) {
+        resampler_ = std::make_unique<Resampler>(kSynthesisRateHz,
+            output_sample_rate_hz_, AudioBuffer::RESAMPLEQUALITY_SINC_FASTEST);
+    }
+
+    setFrames(std::move(frames));
+    synthesizer_.restart();
+    next_frame_ = 0;
+    is_produced_ = false;
+    is_running_ = true;
+
+    producer_ = std::thread(&SynthesisStream::produce, this);
+}
+
+void SynthesisStream::setFrames(
+    std::shared_ptr<const std::vector<Frame>> frames) {
+    //
+    if (frames == nullptr) {
+        frames = std::make_shared<const std::vector<Frame>>();
+    }
+
+    std::lock_guard<std::mutex> lock(frames_mutex_);
+    frames_ = std::move(frames);
+}
+
+void SynthesisStream::stop() {
+    is_running_ = false;
+
+    if (producer_.joinable()) {
+        producer_.join();
+    }
+
+    // With the producer halted, the consumer side may be drained from here
+    auto discarded = std::array<float, 256>();
+    while (ring_buffer_.read(discarded.data(),
+        static_cast<int>(discarded.size())) > 0) {}
+
+    is_produced_ = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Consumer Interface /////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int SynthesisStream::read(float *samples, int n_samples) {
+    return ring_buffer_.read(samples, n_samples);
+}
+
+bool SynthesisStream::isFinished() const {
+    return is_produced_ && ring_buffer_.getNReadable() == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int SynthesisStream::getSampleRateHz() const {
+    return output_sample_rate_hz_;
+}
+
+int SynthesisStream::getNextFrame() const {
+    return next_frame_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SynthesisStream::produce() {
+    auto n_samples_per_frame = synthesizer_.getNSamplesPerFrame();
+
+    // When the buffer is full, the producer sleeps for a quarter of a Frame,
+    // which keeps it well ahead of the device without spinning
+    auto poll_interval = std::chrono::microseconds(
+        250000LL * n_samples_per_frame / kSynthesisRateHz);
+
+    auto block = std::vector<float>();
+    auto pending = std::vector<float>();
+    auto n_pending_written = 0;
+    auto is_ended = false;
+
+    block.reserve(n_samples_per_frame);
+
+    while (is_running_) {
+        // Synthesize the next Frame once the previous one is fully buffered
+        if (n_pending_written == static_cast<int>(pending.size())) {
+            if (is_ended) {
+                break;
+            }
+
+            std::shared_ptr<const std::vector<Frame>> frames;
+            {
+                std::lock_guard<std::mutex> lock(frames_mutex_);
+                frames = frames_;
+            }
+
+            auto i = next_frame_.load();
+            block.clear();
+
+            if (i >= static_cast<int>(frames->size()) ||
+                !synthesizer_.synthesizeFrame(frames->at(i), block)) {
+                //
+                is_ended = true;
+            }
+
+            if (!is_ended) {
+                next_frame_ = i + 1;
+            }
+
+            pending.clear();
+            n_pending_written = 0;
+
+            if (resampler_ == nullptr) {
+                pending.swap(block);
+                continue;
+            }
+
+            // A resampling error cannot be reported from this thread, so it
+            // ends the stream early instead
+            try {
+                resampler_->process(block.data(),
+                    static_cast<int>(block.size()), pending);
+
+                if (is_ended) {
+                    resampler_->flush(pending);
+                }
+
+            } catch (const std::exception &) {
+                pending.clear();
+                is_ended = true;
+            }
+
+            continue;
+        }
+
+        n_pending_written += ring_buffer_.write(
+            pending.data() + n_pending_written,
+            static_cast<int>(pending.size()) - n_pending_written);
+
+        if (n_pending_written < static_cast<int>(pending.size())) {
+            std::this_thread::sleep_for(poll_interval);
+        }
+    }
+
+    is_produced_ = true;
+}
+
+};  // namespace tms_express
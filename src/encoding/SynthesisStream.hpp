@@ -0,0 +1,145 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_FRAME_ENCODING_SYNTHESISSTREAM_HPP_
+#define TMS_EXPRESS_FRAME_ENCODING_SYNTHESISSTREAM_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "audio/Resampler.hpp"
+#include "audio/RingBuffer.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/Synthesizer.hpp"
+
+namespace tms_express {
+
+/// @brief Synthesizes a Frame table on a background thread, one Frame at a
+///         time, for real-time playback
+/// @details A producer thread keeps a short Ring Buffer topped up with
+///             synthesized (and, if needed, resampled) audio, which the audio
+///             device drains through read() without locking. The Frame table
+///             may be replaced at any time, in which case the Frames which
+///             have not yet been synthesized are taken from the new table,
+///             such that edits are heard within the buffer's latency rather
+///             than after the whole table is resynthesized
+class SynthesisStream {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new, idle Synthesis Stream
+    /// @param output_sample_rate_hz Sample rate of the audio device, in Hertz,
+    ///                                 to which synthesized audio is resampled
+    ///                                 if necessary
+    /// @param latency_ms Duration of audio buffered ahead of the device, in
+    ///                     milliseconds
+    explicit SynthesisStream(int output_sample_rate_hz = 8000,
+        float latency_ms = 100.0f);
+
+    ~SynthesisStream();
+
+    SynthesisStream(const SynthesisStream &) = delete;
+    SynthesisStream &operator=(const SynthesisStream &) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Control ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Begins streaming a Frame table from its first Frame, stopping
+    ///         any stream already in progress
+    /// @param frames Frame table to synthesize
+    /// @throws std::runtime_error if a resampler cannot be initialized
+    void start(std::shared_ptr<const std::vector<Frame>> frames);
+
+    /// @brief Replaces the Frame table of the stream in progress, from the
+    ///         next Frame to be synthesized onward
+    /// @param frames New Frame table
+    void setFrames(std::shared_ptr<const std::vector<Frame>> frames);
+
+    /// @brief Stops the stream and discards buffered audio
+    void stop();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Consumer Interface /////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Removes buffered samples, without blocking
+    /// @param samples Destination of samples
+    /// @param n_samples Max number of samples to remove
+    /// @return Number of samples removed, which is less than n_samples if the
+    ///         producer has fallen behind or the stream has finished
+    /// @note This function is intended to be called from the audio device's
+    ///         thread, and is safe to call concurrently with every other
+    ///         function except start() and stop()
+    int read(float *samples, int n_samples);
+
+    /// @brief Reports whether every synthesized sample has been read
+    /// @return true if the stream has ended and been drained, false otherwise
+    bool isFinished() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the sample rate of the stream
+    /// @return Output sample rate, in Hertz
+    int getSampleRateHz() const;
+
+    /// @brief Accesses the index of the next Frame to be synthesized
+    /// @return Frame index
+    int getNextFrame() const;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Synthesizes Frames into the Ring Buffer until the stream ends
+    ///         or is stopped
+    void produce();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Sample rate of the audio device, in Hertz
+    int output_sample_rate_hz_;
+
+    /// @brief Synthesizer, which is accessed only by the producer thread while
+    ///         a stream is in progress
+    Synthesizer synthesizer_;
+
+    /// @brief Converts synthesized audio to the output sample rate, or
+    ///         nullptr if the rates match
+    std::unique_ptr<Resampler> resampler_;
+
+    /// @brief Synthesized audio awaiting playback
+    RingBuffer ring_buffer_;
+
+    /// @brief Frame table being streamed, guarded by frames_mutex_
+    std::shared_ptr<const std::vector<Frame>> frames_;
+
+    /// @brief Guards frames_ between the UI thread and the producer thread.
+    ///         The audio device never takes this lock
+    std::mutex frames_mutex_;
+
+    /// @brief Index of the next Frame to be synthesized
+    std::atomic<int> next_frame_;
+
+    /// @brief true while the producer thread should continue
+    std::atomic<bool> is_running_;
+
+    /// @brief true once the producer has written its final sample
+    std::atomic<bool> is_produced_;
+
+    /// @brief Producer thread
+    std::thread producer_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_FRAME_ENCODING_SYNTHESISSTREAM_HPP_
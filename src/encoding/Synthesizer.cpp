@@ -41,19 +41,35 @@ Synthesizer::Synthesizer(int sample_rate_hz, float frame_rate_ms) {
 
 std::vector<float> Synthesizer::synthesize(const std::vector<Frame>& frames) {
     reset();
+    samples_.reserve(frames.size() * n_samples_per_frame_);
 
     for (const auto &frame : frames) {
-        if (updateSynthTable(frame)) {
+        if (!synthesizeFrame(frame, samples_)) {
             break;
         }
-
-        for (int i = 0; i < n_samples_per_frame_; i++)
-            samples_.push_back(updateLatticeFilter());
     }
 
     return samples_;
 }
 
+bool Synthesizer::synthesizeFrame(const Frame &frame,
+    std::vector<float> &output) {
+    //
+    if (updateSynthTable(frame)) {
+        return false;
+    }
+
+    for (int i = 0; i < n_samples_per_frame_; i++) {
+        output.push_back(updateLatticeFilter());
+    }
+
+    return true;
+}
+
+void Synthesizer::restart() {
+    reset();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Accessors //////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -62,6 +78,10 @@ std::vector<float> Synthesizer::getSamples() const {
     return samples_;
 }
 
+int Synthesizer::getNSamplesPerFrame() const {
+    return n_samples_per_frame_;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Static Utilities ///////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
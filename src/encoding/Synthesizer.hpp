@@ -32,6 +32,20 @@ class Synthesizer {
     /// @return Synthesized PCM samples
     std::vector<float> synthesize(const std::vector<Frame>& frames);
 
+    /// @brief Synthesizes a single Frame, continuing from the state left by
+    ///         the previous Frame, such that a Frame table may be rendered
+    ///         block by block as it is consumed
+    /// @param frame Frame to synthesize
+    /// @param output Vector to which one Frame's worth of samples is appended
+    /// @return true if the Frame was synthesized, false if it is a stop Frame,
+    ///         in which case the synthesizer is reset and nothing is appended
+    /// @note Call restart() before the first Frame of a stream
+    bool synthesizeFrame(const Frame &frame, std::vector<float> &output);
+
+    /// @brief Returns the synthesizer to its initial state, ahead of a new
+    ///         stream of Frames
+    void restart();
+
     ///////////////////////////////////////////////////////////////////////////
     // Accessors //////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -40,6 +54,10 @@ class Synthesizer {
     /// @return Synthesized PCM samples
     std::vector<float> getSamples() const;
 
+    /// @brief Accesses the number of samples synthesized from each Frame
+    /// @return Number of samples per Frame
+    int getNSamplesPerFrame() const;
+
     ///////////////////////////////////////////////////////////////////////////
     // Static Utilities ///////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
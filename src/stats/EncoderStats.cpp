@@ -0,0 +1,244 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "stats/EncoderStats.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "stats/Tracer.hpp"
+
+namespace tms_express {
+
+/// @brief Encoder Stats active on each thread, or nullptr if inactive
+static thread_local EncoderStats *active_stats = nullptr;
+
+///////////////////////////////////////////////////////////////////////////////
+// Scoped Helpers /////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+EncoderStats::Collector::Collector(EncoderStats *stats) {
+    previous_ = active_stats;
+    active_stats = stats;
+}
+
+EncoderStats::Collector::~Collector() {
+    active_stats = previous_;
+}
+
+EncoderStats::ScopedTimer::ScopedTimer(Stage stage) {
+    stats_ = active_stats;
+    stage_ = stage;
+    is_tracing_ = Tracer::isEnabled();
+
+    if (stats_ != nullptr || is_tracing_) {
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+EncoderStats::ScopedTimer::~ScopedTimer() {
+    if (stats_ == nullptr && !is_tracing_) {
+        return;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    if (stats_ != nullptr) {
+        stats_->addTime(stage_, std::chrono::duration_cast<
+            std::chrono::nanoseconds>(end - start_).count());
+    }
+
+    if (is_tracing_) {
+        Tracer::record(stageName(stage_), "stage", start_, end);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+EncoderStats::EncoderStats() {
+    times_ns_.fill(0);
+    n_calls_.fill(0);
+    counts_.fill(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Collection /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+EncoderStats *EncoderStats::active() {
+    return active_stats;
+}
+
+void EncoderStats::count(Counter counter, int64_t n) {
+    if (active_stats != nullptr) {
+        active_stats->addCount(counter, n);
+    }
+}
+
+void EncoderStats::addTime(Stage stage, int64_t duration_ns) {
+    times_ns_[stage] += duration_ns;
+    n_calls_[stage]++;
+}
+
+void EncoderStats::addCount(Counter counter, int64_t n) {
+    counts_[counter] += n;
+}
+
+void EncoderStats::merge(const EncoderStats &other) {
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        times_ns_[i] += other.times_ns_[i];
+        n_calls_[i] += other.n_calls_[i];
+    }
+
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        counts_[i] += other.counts_[i];
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accessors //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int64_t EncoderStats::getTimeNs(Stage stage) const {
+    return times_ns_[stage];
+}
+
+int64_t EncoderStats::getNCalls(Stage stage) const {
+    return n_calls_[stage];
+}
+
+int64_t EncoderStats::getCount(Counter counter) const {
+    return counts_[counter];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reporting //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::string EncoderStats::toString() const {
+    int64_t total_ns = 0;
+    for (auto time_ns : times_ns_) {
+        total_ns += time_ns;
+    }
+
+    char line[128];
+    snprintf(line, sizeof(line), "%-16s%10s%14s%9s\n", "Stage", "Calls",
+        "Time (ms)", "Share");
+
+    auto summary = std::string(line);
+
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        auto share = (total_ns > 0) ?
+            100.0 * static_cast<double>(times_ns_[i]) /
+                static_cast<double>(total_ns) : 0.0;
+
+        snprintf(line, sizeof(line), "%-16s%10lld%14.3f%8.1f%%\n",
+            stageName(static_cast<Stage>(i)),
+            static_cast<long long>(n_calls_[i]),
+            static_cast<double>(times_ns_[i]) * 1e-6, share);
+
+        summary += line;
+    }
+
+    snprintf(line, sizeof(line), "%-16s%10s%14.3f\n\n", "total", "",
+        static_cast<double>(total_ns) * 1e-6);
+    summary += line;
+
+    snprintf(line, sizeof(line), "%-16s%10s\n", "Counter", "Value");
+    summary += line;
+
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        snprintf(line, sizeof(line), "%-16s%10lld\n",
+            counterName(static_cast<Counter>(i)),
+            static_cast<long long>(counts_[i]));
+
+        summary += line;
+    }
+
+    return summary;
+}
+
+std::string EncoderStats::toJSON() const {
+    nlohmann::json json;
+
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        auto &stage = json["stages"][stageName(static_cast<Stage>(i))];
+        stage["calls"] = n_calls_[i];
+        stage["time_ms"] = static_cast<double>(times_ns_[i]) * 1e-6;
+    }
+
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        json["counters"][counterName(static_cast<Counter>(i))] = counts_[i];
+    }
+
+    return json.dump(4);
+}
+
+const char *EncoderStats::stageName(Stage stage) {
+    switch (stage) {
+        case STAGE_DECODE:
+            return "decode";
+
+        case STAGE_RESAMPLE:
+            return "resample";
+
+        case STAGE_FILTER:
+            return "filter";
+
+        case STAGE_ANALYSIS:
+            return "analysis";
+
+        case STAGE_POSTPROCESS:
+            return "postprocess";
+
+        case STAGE_SERIALIZE:
+            return "serialize";
+
+        case STAGE_WRITE:
+            return "write";
+
+        case STAGE_METRICS:
+            return "metrics";
+
+        default:
+            return "unknown";
+    }
+}
+
+const char *EncoderStats::counterName(Counter counter) {
+    switch (counter) {
+        case COUNTER_FILES:
+            return "files";
+
+        case COUNTER_SAMPLES:
+            return "samples";
+
+        case COUNTER_FRAMES:
+            return "frames";
+
+        case COUNTER_VOICED_FRAMES:
+            return "voiced_frames";
+
+        case COUNTER_UNVOICED_FRAMES:
+            return "unvoiced_frames";
+
+        case COUNTER_SILENT_FRAMES:
+            return "silent_frames";
+
+        case COUNTER_REPEAT_FRAMES:
+            return "repeat_frames";
+
+        case COUNTER_BYTES:
+            return "bytes";
+
+        default:
+            return "unknown";
+    }
+}
+
+};  // namespace tms_express
@@ -0,0 +1,234 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_STATS_ENCODERSTATS_HPP_
+#define TMS_EXPRESS_STATS_ENCODERSTATS_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace tms_express {
+
+/// @brief Accumulates the time spent in, and the output of, each stage of
+///         bitstream generation
+/// @details Stages report to whichever Encoder Stats are active on the
+///             calling thread, as installed by a Collector. If none are
+///             active, timers never read the clock and counts are discarded,
+///             such that instrumentation costs a thread-local load and a
+///             branch. Because every thread collects into its own Encoder
+///             Stats, collection requires no synchronization, and the stats
+///             of several threads or files are combined afterwards via
+///             merge(). Timed stages are also recorded by the Tracer, if
+///             enabled
+class EncoderStats {
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Enums //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Timed stages of bitstream generation
+    enum Stage {
+        /// @brief Reading and mixing audio files to mono
+        STAGE_DECODE,
+
+        /// @brief Resampling decoded audio to 8 kHz
+        STAGE_RESAMPLE,
+
+        /// @brief Pre-emphasis, highpass, and lowpass filtering
+        STAGE_FILTER,
+
+        /// @brief Pitch, voicing, and LPC analysis of each segment
+        STAGE_ANALYSIS,
+
+        /// @brief Gain adjustment, quantization, and repeat or rate control
+        STAGE_POSTPROCESS,
+
+        /// @brief Conversion of Frames to bitstreams
+        STAGE_SERIALIZE,
+
+        /// @brief Output of bitstreams to disk
+        STAGE_WRITE,
+
+        /// @brief Objective quality metrics, if requested
+        STAGE_METRICS,
+
+        /// @brief Number of stages
+        STAGE_COUNT
+    };
+
+    /// @brief Counted quantities of bitstream generation
+    enum Counter {
+        /// @brief Audio files encoded
+        COUNTER_FILES,
+
+        /// @brief Samples analyzed, at 8 kHz
+        COUNTER_SAMPLES,
+
+        /// @brief Frames produced
+        COUNTER_FRAMES,
+
+        /// @brief Voiced Frames, including voiced repeats
+        COUNTER_VOICED_FRAMES,
+
+        /// @brief Unvoiced Frames, including unvoiced repeats
+        COUNTER_UNVOICED_FRAMES,
+
+        /// @brief Silent Frames
+        COUNTER_SILENT_FRAMES,
+
+        /// @brief Repeat Frames
+        COUNTER_REPEAT_FRAMES,
+
+        /// @brief Bitstream bytes
+        COUNTER_BYTES,
+
+        /// @brief Number of counters
+        COUNTER_COUNT
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Scoped Helpers /////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Activates Encoder Stats on the calling thread for the lifetime
+    ///         of the Collector, restoring the previously active stats, if
+    ///         any, upon destruction
+    class Collector {
+     public:
+        /// @brief Activates Encoder Stats on the calling thread
+        /// @param stats Encoder Stats, or nullptr to deactivate collection
+        explicit Collector(EncoderStats *stats);
+
+        ~Collector();
+
+        Collector(const Collector &) = delete;
+        Collector &operator=(const Collector &) = delete;
+
+     private:
+        /// @brief Encoder Stats which were active before the Collector
+        EncoderStats *previous_;
+    };
+
+    /// @brief Adds the duration of its scope to a stage of the active
+    ///         Encoder Stats, if any, and records it with the Tracer, if
+    ///         enabled
+    class ScopedTimer {
+     public:
+        /// @brief Starts timing a stage
+        /// @param stage Stage to which the time is attributed
+        explicit ScopedTimer(Stage stage);
+
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+     private:
+        /// @brief Encoder Stats active at construction, or nullptr
+        EncoderStats *stats_;
+
+        /// @brief Timed stage
+        Stage stage_;
+
+        /// @brief true if tracing was enabled at construction
+        bool is_tracing_;
+
+        /// @brief Time at construction, which is only read if stats_ is set
+        ///         or tracing is enabled
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates new, zeroed Encoder Stats
+    EncoderStats();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collection /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the Encoder Stats active on the calling thread
+    /// @return Active Encoder Stats, or nullptr if collection is inactive
+    static EncoderStats *active();
+
+    /// @brief Adds to a counter of the active Encoder Stats, if any
+    /// @param counter Counter to increment
+    /// @param n Amount by which to increment counter
+    static void count(Counter counter, int64_t n = 1);
+
+    /// @brief Adds time to a stage
+    /// @param stage Stage to which the time is attributed
+    /// @param duration_ns Duration, in nanoseconds
+    void addTime(Stage stage, int64_t duration_ns);
+
+    /// @brief Adds to a counter
+    /// @param counter Counter to increment
+    /// @param n Amount by which to increment counter
+    void addCount(Counter counter, int64_t n);
+
+    /// @brief Accumulates the times and counts of other Encoder Stats
+    /// @param other Encoder Stats to accumulate
+    void merge(const EncoderStats &other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accessors //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Accesses the total time spent in a stage
+    /// @param stage Stage
+    /// @return Duration, in nanoseconds
+    int64_t getTimeNs(Stage stage) const;
+
+    /// @brief Accesses the number of times a stage was entered
+    /// @param stage Stage
+    /// @return Number of timed scopes
+    int64_t getNCalls(Stage stage) const;
+
+    /// @brief Accesses a counter
+    /// @param counter Counter
+    /// @return Value of counter
+    int64_t getCount(Counter counter) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reporting //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Summarizes the stats as a table, one stage or counter per line
+    /// @return Human-readable summary
+    std::string toString() const;
+
+    /// @brief Summarizes the stats as a JSON object
+    /// @return JSON object, with "stages" and "counters" members
+    std::string toJSON() const;
+
+    /// @brief Names a stage
+    /// @param stage Stage
+    /// @return Lowercase name of stage
+    static const char *stageName(Stage stage);
+
+    /// @brief Names a counter
+    /// @param counter Counter
+    /// @return Lowercase name of counter
+    static const char *counterName(Counter counter);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Total time spent in each stage, in nanoseconds
+    std::array<int64_t, STAGE_COUNT> times_ns_;
+
+    /// @brief Number of timed scopes of each stage
+    std::array<int64_t, STAGE_COUNT> n_calls_;
+
+    /// @brief Value of each counter
+    std::array<int64_t, COUNTER_COUNT> counts_;
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_STATS_ENCODERSTATS_HPP_
@@ -0,0 +1,201 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "stats/Tracer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace tms_express {
+
+/// @brief Event which spans a scope
+struct TraceEvent {
+    /// @brief Name of event
+    std::string name;
+
+    /// @brief Category of event
+    const char *category;
+
+    /// @brief Start time, in nanoseconds since the clock epoch
+    int64_t start_ns;
+
+    /// @brief Duration, in nanoseconds
+    int64_t duration_ns;
+};
+
+/// @brief Events recorded by a single thread
+struct TraceBuffer {
+    /// @brief Sequential ID of thread, in order of its first event
+    int thread_id;
+
+    /// @brief Events recorded by thread
+    std::vector<TraceEvent> events;
+};
+
+/// @brief Capacity reserved by each new buffer, to avoid reallocation during
+///         short traces
+static constexpr int kInitialCapacity = 1024;
+
+/// @brief true if events are being recorded
+static std::atomic<bool> is_tracing_enabled(false);
+
+/// @brief Time of the first call to enable(), in nanoseconds since the clock
+///         epoch, or -1 if never enabled
+static int64_t trace_origin_ns = -1;
+
+/// @brief Guards registration of thread buffers and the trace origin
+static std::mutex trace_mutex;
+
+/// @brief Every registered buffer, which outlive their threads
+static std::vector<std::unique_ptr<TraceBuffer>> trace_buffers;
+
+/// @brief Buffer of the calling thread, or nullptr if not yet registered
+static thread_local TraceBuffer *thread_buffer = nullptr;
+
+/// @brief Converts a time point to nanoseconds since the clock epoch
+/// @param time Time point
+/// @return Nanoseconds since epoch
+static int64_t toNanoseconds(Tracer::Clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        time.time_since_epoch()).count();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Scoped Helpers /////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+Tracer::Scope::Scope(const std::string &name, const char *category) {
+    is_enabled_ = isEnabled();
+    category_ = category;
+
+    if (is_enabled_) {
+        name_ = name;
+        start_ = Clock::now();
+    }
+}
+
+Tracer::Scope::~Scope() {
+    if (is_enabled_) {
+        record(name_, category_, start_, Clock::now());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Control ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Tracer::enable() {
+    auto lock = std::lock_guard<std::mutex>(trace_mutex);
+
+    if (trace_origin_ns < 0) {
+        trace_origin_ns = toNanoseconds(Clock::now());
+    }
+
+    is_tracing_enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::disable() {
+    is_tracing_enabled.store(false, std::memory_order_release);
+}
+
+bool Tracer::isEnabled() {
+    return is_tracing_enabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::reset() {
+    auto lock = std::lock_guard<std::mutex>(trace_mutex);
+
+    for (auto &buffer : trace_buffers) {
+        buffer->events.clear();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Recording //////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Tracer::record(const std::string &name, const char *category,
+    Clock::time_point start, Clock::time_point end) {
+    //
+    if (!isEnabled()) {
+        return;
+    }
+
+    // Registration is the only synchronized step, and occurs once per thread
+    if (thread_buffer == nullptr) {
+        auto lock = std::lock_guard<std::mutex>(trace_mutex);
+
+        auto buffer = std::make_unique<TraceBuffer>();
+        buffer->thread_id = static_cast<int>(trace_buffers.size());
+        buffer->events.reserve(kInitialCapacity);
+
+        thread_buffer = buffer.get();
+        trace_buffers.push_back(std::move(buffer));
+    }
+
+    auto start_ns = toNanoseconds(start);
+    thread_buffer->events.push_back(
+        {name, category, start_ns, toNanoseconds(end) - start_ns});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Export /////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+std::string Tracer::toJSON() {
+    auto lock = std::lock_guard<std::mutex>(trace_mutex);
+
+    auto events = nlohmann::json::array();
+    auto origin_ns = (trace_origin_ns < 0) ? 0 : trace_origin_ns;
+
+    for (const auto &buffer : trace_buffers) {
+        // Name each thread, such that viewers label its track
+        events.push_back({
+            {"name", "thread_name"},
+            {"ph", "M"},
+            {"pid", 1},
+            {"tid", buffer->thread_id},
+            {"args", {{"name", "thread " +
+                std::to_string(buffer->thread_id)}}}
+        });
+
+        // Chrome trace timestamps are in microseconds
+        for (const auto &event : buffer->events) {
+            events.push_back({
+                {"name", event.name},
+                {"cat", event.category},
+                {"ph", "X"},
+                {"pid", 1},
+                {"tid", buffer->thread_id},
+                {"ts", static_cast<double>(event.start_ns - origin_ns) * 1e-3},
+                {"dur", static_cast<double>(event.duration_ns) * 1e-3}
+            });
+        }
+    }
+
+    nlohmann::json json;
+    json["traceEvents"] = events;
+    json["displayTimeUnit"] = "ms";
+
+    return json.dump();
+}
+
+bool Tracer::write(const std::string &path) {
+    auto file = std::ofstream(path);
+
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << toJSON() << std::endl;
+    return file.good();
+}
+
+};  // namespace tms_express
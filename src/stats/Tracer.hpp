@@ -0,0 +1,107 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_STATS_TRACER_HPP_
+#define TMS_EXPRESS_STATS_TRACER_HPP_
+
+#include <chrono>
+#include <string>
+
+namespace tms_express {
+
+/// @brief Records a timeline of the files and stages of bitstream generation,
+///         for export as Chrome trace-event JSON
+/// @details Each thread appends events to its own buffer, which it registers
+///             upon its first event. Only registration takes a lock, so
+///             threads never contend while tracing. Buffers outlive their
+///             threads, such that the timeline of a parallel batch may be
+///             exported once its workers have exited. While tracing is
+///             disabled, instrumentation costs a single relaxed atomic load
+/// @note The resulting file may be opened in chrome://tracing or Perfetto
+class Tracer {
+ public:
+    /// @brief Clock by which events are timed
+    using Clock = std::chrono::steady_clock;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Scoped Helpers /////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Records the duration of its scope as an event, if tracing is
+    ///         enabled at construction
+    class Scope {
+     public:
+        /// @brief Begins an event
+        /// @param name Name of event
+        /// @param category Category of event, which must be a string literal
+        Scope(const std::string &name, const char *category);
+
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+     private:
+        /// @brief true if tracing was enabled at construction
+        bool is_enabled_;
+
+        /// @brief Name of event
+        std::string name_;
+
+        /// @brief Category of event
+        const char *category_;
+
+        /// @brief Time at construction, which is only read if enabled
+        Clock::time_point start_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Control ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Starts recording events, whose timestamps are relative to the
+    ///         first call
+    static void enable();
+
+    /// @brief Stops recording events, retaining those already recorded
+    static void disable();
+
+    /// @brief Checks whether events are being recorded
+    /// @return true if tracing is enabled, false otherwise
+    static bool isEnabled();
+
+    /// @brief Discards every recorded event
+    /// @warning Must not be called while other threads are tracing
+    static void reset();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recording //////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Records an event on the calling thread, if tracing is enabled
+    /// @param name Name of event
+    /// @param category Category of event, which must be a string literal
+    /// @param start Time at which event began
+    /// @param end Time at which event ended
+    static void record(const std::string &name, const char *category,
+        Clock::time_point start, Clock::time_point end);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Export /////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Formats every recorded event as Chrome trace-event JSON
+    /// @return JSON object, whose "traceEvents" member holds one complete
+    ///         ("X") event per scope and one name per thread
+    /// @warning Must not be called while other threads are tracing
+    static std::string toJSON();
+
+    /// @brief Writes every recorded event to a Chrome trace-event JSON file
+    /// @param path Path to JSON file
+    /// @return true if write successful, false otherwise
+    /// @warning Must not be called while other threads are tracing
+    static bool write(const std::string &path);
+};
+
+};  // namespace tms_express
+
+#endif  // TMS_EXPRESS_STATS_TRACER_HPP_
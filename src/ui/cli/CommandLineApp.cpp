@@ -2,13 +2,29 @@
 
 #include "ui/cli/CommandLineApp.hpp"
 
+#include <exception>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <CLI/CLI.hpp>
 
 #include "bitstream/BitstreamGenerator.hpp"
+#include "bitstream/ParameterSweep.hpp"
 #include "bitstream/PathUtils.hpp"
+#include "stats/EncoderStats.hpp"
+#include "stats/Tracer.hpp"
 
 namespace tms_express::ui {
 
+const std::map<std::string, CommandLineApp::Quantizer>
+    CommandLineApp::kQuantizerNames = {
+        {"nearest", QUANTIZER_NEAREST},
+        {"closed-loop", QUANTIZER_CLOSED_LOOP}
+    };
+
 ///////////////////////////////////////////////////////////////////////////////
 // Initializers ///////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -17,8 +33,12 @@ CommandLineApp::CommandLineApp() {
     encoder = add_subcommand("encode",
         "Converts audio file(s) to TMS5220 bitstream(s)");
 
+    sweeper = add_subcommand("sweep",
+        "Ranks combinations of analysis parameters by resynthesis error");
+
     require_subcommand(1);
     setupEncoder();
+    setupSweep();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -32,6 +52,10 @@ int CommandLineApp::run(int argc, char** argv) {
         return this->exit(e);
     }
 
+    if (got_subcommand(sweeper)) {
+        return runSweep();
+    }
+
     if (got_subcommand(encoder)) {
         // Open input and output files for inspection
         auto input = PathUtils(input_path_);
@@ -58,28 +82,75 @@ int CommandLineApp::run(int argc, char** argv) {
         }
 
         // Extract IO paths and encode
-        auto bitstream_generator = BitstreamGenerator(analysis_window_ms_,
-            hpf_cutoff_, lpf_cutoff_, preemphasis_alpha_, bitstream_format_,
-            !no_stop_frame_, gain_shift_, max_voiced_gain_, max_unvoiced_gain_,
-            repeat_frames_, max_pitch_frq_, min_pitch_frq_);
+        auto bitstream_generator = makeGenerator();
 
         auto input_paths = input.getPaths();
         auto input_filenames = input.getFilenames();
         auto output_path_directory = output.getPaths().at(0);
 
+        // Budgeted encodes always report the size and quality they achieved
+        auto is_budgeted = max_bytes_ > 0 || max_bitrate_ > 0.0f;
+        auto print_metrics = print_metrics_ || is_budgeted;
+
+        auto reports = std::vector<QualityMetrics::Report>(1);
+        auto rates = std::vector<RateController::Result>(1);
+        auto reports_ptr = print_metrics ? &reports : nullptr;
+        auto rates_ptr = is_budgeted ? &rates : nullptr;
+
+        // Stats are only collected while a Collector is active, such that
+        // instrumentation is effectively free unless requested
+        auto stats = EncoderStats();
+        auto collector = EncoderStats::Collector(print_stats_ ? &stats :
+            nullptr);
+
+        if (!trace_path_.empty()) {
+            Tracer::enable();
+        }
+
         try {
             if (input.isDirectory()) {
-                bitstream_generator.encodeBatch(input_paths, input_filenames,
-                    output_path_directory);
+                bitstream_generator->encodeBatch(input_paths, input_filenames,
+                    output_path_directory, reports_ptr, rates_ptr);
 
             } else {
-                bitstream_generator.encode(input_paths.at(0),
-                    input_filenames.at(0), output_path_directory);
+                bitstream_generator->encode(input_paths.at(0),
+                    input_filenames.at(0), output_path_directory,
+                    print_metrics ? &reports.at(0) : nullptr,
+                    is_budgeted ? &rates.at(0) : nullptr);
             }
         } catch (const std::exception &e) {
             std::cerr << "Error: " << e.what() << std::endl;
+            writeTrace();
             return 1;
         }
+
+        writeTrace();
+
+        if (print_metrics) {
+            for (int i = 0; i < static_cast<int>(reports.size()); i++) {
+                std::cout << input_filenames.at(i) << ":" << std::endl;
+
+                if (is_budgeted) {
+                    std::cout << rates[i].toString();
+                }
+
+                std::cout << reports[i].toString() << std::endl;
+            }
+        }
+
+        if (print_stats_) {
+            std::cout << ((stats_format_ == 1) ? stats.toJSON() + "\n" :
+                stats.toString());
+        }
+
+        // Report cache effectiveness on stderr, as a diagnostic rather than
+        // a result
+        if (!cache_directory_.empty()) {
+            std::cerr << "Analysis cache: "
+                << bitstream_generator->getAnalysisCacheHits() << " hit(s), "
+                << bitstream_generator->getAnalysisCacheMisses() << " miss(es)"
+                << std::endl;
+        }
     }
 
     return 0;
@@ -124,14 +195,259 @@ void CommandLineApp::setupEncoder() {
     encoder->add_flag("-r,--use-repeat-frames", repeat_frames_,
         "Compress bitstream by detecting and repeating similar frames");
 
+    encoder->add_option("--max-distortion", max_distortion_db_,
+        "Choose repeat and silent frames which minimize bitstream size within "
+        "a mean spectral distortion (dB, 0 = off)")->
+        check(CLI::NonNegativeNumber);
+
+    encoder->add_option("--max-repeat-chain", max_repeat_chain_,
+        "Max consecutive repeat frames of rate-distortion optimization")->
+        check(CLI::Range(1, 16));
+
+    encoder->add_option("--variable-rate", variable_rate_db_,
+        "Repeat frames within spectrally steady regions, up to a spectral "
+        "change (dB, 0 = off)")->
+        check(CLI::NonNegativeNumber);
+
+    encoder->add_option("--max-bytes", max_bytes_,
+        "Max size of each bitstream (bytes, 0 = unlimited)")->
+        check(CLI::NonNegativeNumber);
+
+    encoder->add_option("--bitrate", max_bitrate_,
+        "Max bitrate of each bitstream (bits/s, 0 = unlimited)")->
+        check(CLI::NonNegativeNumber);
+
     encoder->add_option("-M,--max-pitch", max_pitch_frq_,
         "Max pitch frequency (Hz)");
 
     encoder->add_option("-m,--min-pitch", min_pitch_frq_,
         "Min pitch frequency (Hz)");
 
+    encoder->add_option("-p,--pitch-algorithm", pitch_algorithm_,
+        "Pitch estimator: autocorrelation (0), YIN (1)")->
+        check(CLI::Range(0, 1));
+
+    encoder->add_option("--yin-threshold", yin_threshold_,
+        "YIN pitch estimator absolute threshold")->
+        check(CLI::Range(0.0, 1.0));
+
+    encoder->add_option("--pitch-decimation", pitch_decimation_,
+        "Decimate autocorrelation pitch search (1 = off, 2-4)")->
+        check(CLI::Range(1, 4));
+
+    encoder->add_option("--voicing-hysteresis", voicing_hysteresis_,
+        "Voicing decision hysteresis (0 = off)")->
+        check(CLI::Range(0.0, 0.5));
+
+    encoder->add_option("--filter-order", filter_order_,
+        "Highpass and lowpass Butterworth filter order")->
+        check(CLI::Range(1, 8));
+
+    encoder->add_option("--resampler", resample_quality_,
+        "Resampler: best sinc (0), medium sinc (1), fastest sinc (2), "
+        "polyphase decimator (3)")->check(CLI::Range(0, 3));
+
+    encoder->add_option("--cache-dir", cache_directory_,
+        "Directory in which to cache decoded audio and raw LPC analysis");
+
+    encoder->add_flag("--metrics", print_metrics_,
+        "Print objective quality metrics of the resynthesized bitstream");
+
+    encoder->add_flag("--stats", print_stats_,
+        "Print time spent in each encoding stage, and frame counts");
+
+    encoder->add_option("--stats-format", stats_format_,
+        "Statistics format: table (0), JSON (1)")->check(CLI::Range(0, 1));
+
+    encoder->add_option("--trace", trace_path_,
+        "Path to which to write a Chrome trace of each file and stage");
+
+    encoder->add_option("-j,--jobs", encode_threads_,
+        "Files encoded concurrently in batch mode (0 = all hardware "
+        "threads)")->check(CLI::NonNegativeNumber);
+
+    encoder->add_option("--quantizer", quantizer_,
+        "Coefficient quantizer: nearest, closed-loop")->
+        transform(CLI::CheckedTransformer(kQuantizerNames, CLI::ignore_case));
+
     encoder->add_option("-o,--output,output", output_path_,
         "Path to output file")->required();
 }
 
+std::shared_ptr<BitstreamGenerator> CommandLineApp::makeGenerator() const {
+    auto bitstream_generator = std::make_shared<BitstreamGenerator>(
+        analysis_window_ms_, hpf_cutoff_, lpf_cutoff_, preemphasis_alpha_,
+        bitstream_format_, !no_stop_frame_, gain_shift_, max_voiced_gain_,
+        max_unvoiced_gain_, repeat_frames_, max_pitch_frq_, min_pitch_frq_);
+
+    bitstream_generator->setPitchAlgorithm(pitch_algorithm_, yin_threshold_);
+    bitstream_generator->setPitchDecimation(pitch_decimation_);
+    bitstream_generator->setVoicingHysteresis(voicing_hysteresis_);
+    bitstream_generator->setFilterOrder(filter_order_);
+    bitstream_generator->setResampleQuality(resample_quality_);
+    bitstream_generator->setCacheDirectory(cache_directory_);
+    bitstream_generator->setClosedLoopQuantization(
+        quantizer_ == QUANTIZER_CLOSED_LOOP);
+    bitstream_generator->setRepeatDistortion(max_distortion_db_,
+        max_repeat_chain_);
+    bitstream_generator->setVariableFrameRate(variable_rate_db_);
+    bitstream_generator->setBudget(max_bytes_, max_bitrate_);
+    bitstream_generator->setThreads(encode_threads_);
+
+    return bitstream_generator;
+}
+
+void CommandLineApp::setupSweep() {
+    sweeper->add_option("-i,--input,input", sweep_input_path_,
+        "Path to audio file or directory")->required();
+
+    sweeper->add_option("-w,--window", sweep_window_ms_,
+        "Window widths (ms), as start:stop:step");
+
+    sweeper->add_option("-b,--highpass", sweep_hpf_cutoff_,
+        "Highpass filter cutoffs (Hz), as start:stop:step");
+
+    sweeper->add_option("-l,--lowpass", sweep_lpf_cutoff_,
+        "Lowpass filter cutoffs (Hz), as start:stop:step");
+
+    sweeper->add_option("-a,--alpha", sweep_preemphasis_alpha_,
+        "Pre-emphasis filter coefficients, as start:stop:step");
+
+    sweeper->add_option("-M,--max-pitch", sweep_max_pitch_frq_,
+        "Max pitch frequencies (Hz), as start:stop:step");
+
+    sweeper->add_option("-m,--min-pitch", sweep_min_pitch_frq_,
+        "Min pitch frequencies (Hz), as start:stop:step");
+
+    sweeper->add_option("-j,--jobs", sweep_threads_,
+        "Worker threads (0 = all hardware threads)")->
+        check(CLI::NonNegativeNumber);
+
+    // The remaining settings are shared with the encode command, such that
+    // each combination is scored exactly as it would be encoded
+    sweeper->add_option("-p,--pitch-algorithm", pitch_algorithm_,
+        "Pitch estimator: autocorrelation (0), YIN (1)")->
+        check(CLI::Range(0, 1));
+
+    sweeper->add_option("--yin-threshold", yin_threshold_,
+        "YIN pitch estimator absolute threshold")->
+        check(CLI::Range(0.0, 1.0));
+
+    sweeper->add_option("--pitch-decimation", pitch_decimation_,
+        "Decimate autocorrelation pitch search (1 = off, 2-4)")->
+        check(CLI::Range(1, 4));
+
+    sweeper->add_option("--voicing-hysteresis", voicing_hysteresis_,
+        "Voicing decision hysteresis (0 = off)")->
+        check(CLI::Range(0.0, 0.5));
+
+    sweeper->add_option("--filter-order", filter_order_,
+        "Highpass and lowpass Butterworth filter order")->
+        check(CLI::Range(1, 8));
+
+    sweeper->add_option("--resampler", resample_quality_,
+        "Resampler: best sinc (0), medium sinc (1), fastest sinc (2), "
+        "polyphase decimator (3)")->check(CLI::Range(0, 3));
+
+    sweeper->add_option("-g,--gain-shift", gain_shift_,
+        "Quantized gain shift");
+
+    sweeper->add_option("-v,--max-voiced-gain", max_voiced_gain_,
+        "Max voiced/vowel gain (dB)");
+
+    sweeper->add_option("-u,--max-unvoiced-gain", max_unvoiced_gain_,
+        "Max unvoiced/consonant gain (dB)");
+
+    sweeper->add_flag("-r,--use-repeat-frames", repeat_frames_,
+        "Compress bitstream by detecting and repeating similar frames");
+
+    sweeper->add_option("--max-distortion", max_distortion_db_,
+        "Choose repeat and silent frames which minimize bitstream size within "
+        "a mean spectral distortion (dB, 0 = off)")->
+        check(CLI::NonNegativeNumber);
+
+    sweeper->add_option("--max-repeat-chain", max_repeat_chain_,
+        "Max consecutive repeat frames of rate-distortion optimization")->
+        check(CLI::Range(1, 16));
+
+    sweeper->add_option("--variable-rate", variable_rate_db_,
+        "Repeat frames within spectrally steady regions, up to a spectral "
+        "change (dB, 0 = off)")->
+        check(CLI::NonNegativeNumber);
+
+    sweeper->add_option("--quantizer", quantizer_,
+        "Coefficient quantizer: nearest, closed-loop")->
+        transform(CLI::CheckedTransformer(kQuantizerNames, CLI::ignore_case));
+
+    sweeper->add_option("-t,--top", sweep_n_rows_,
+        "Number of ranked combinations to print")->
+        check(CLI::PositiveNumber);
+}
+
+void CommandLineApp::writeTrace() const {
+    if (trace_path_.empty()) {
+        return;
+    }
+
+    Tracer::disable();
+
+    if (!Tracer::write(trace_path_)) {
+        std::cerr << "Could not write trace: " << trace_path_ << std::endl;
+    }
+}
+
+int CommandLineApp::runSweep() {
+    auto input = PathUtils(sweep_input_path_);
+
+    if (!input.exists()) {
+        std::cerr << "Input file does not exist or is empty" << std::endl;
+        return 1;
+    }
+
+    // Parse each range, reporting the first which is malformed
+    const std::string *range_strings[] = {&sweep_window_ms_,
+        &sweep_hpf_cutoff_, &sweep_lpf_cutoff_, &sweep_preemphasis_alpha_,
+        &sweep_min_pitch_frq_, &sweep_max_pitch_frq_};
+
+    ParameterSweep::Range ranges[6];
+
+    for (int i = 0; i < 6; i++) {
+        if (!ParameterSweep::Range::parse(*range_strings[i], ranges[i])) {
+            std::cerr << "Invalid range: " << *range_strings[i] << std::endl;
+            return 1;
+        }
+    }
+
+    auto sweep = ParameterSweep(ranges[0], ranges[1], ranges[2], ranges[3],
+        ranges[4], ranges[5]);
+
+    // A pitch floor at or above the pitch ceiling leaves nothing to search
+    auto n_skipped = sweep.getNSkippedCombinations();
+
+    if (n_skipped > 0) {
+        std::cerr << "Skipped " << n_skipped << " combination(s) whose min "
+            "pitch is not below their max pitch" << std::endl;
+    }
+
+    if (sweep.getCombinations().empty()) {
+        std::cerr << "No combination has a min pitch below its max pitch"
+            << std::endl;
+        return 1;
+    }
+
+    sweep.setThreads(sweep_threads_);
+    sweep.setEncoder(makeGenerator());
+
+    try {
+        auto results = sweep.run(input.getPaths());
+        std::cout << ParameterSweep::formatTable(results, sweep_n_rows_);
+
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
 };  // namespace tms_express::ui
@@ -3,11 +3,14 @@
 #ifndef TMS_EXPRESS_USER_INTERFACES_COMMANDLINEAPP_HPP_
 #define TMS_EXPRESS_USER_INTERFACES_COMMANDLINEAPP_HPP_
 
+#include <map>
+#include <memory>
 #include <string>
 
 #include <CLI/CLI.hpp>
 
 #include "bitstream/BitstreamGenerator.hpp"
+#include "bitstream/FrameAnalyzer.hpp"
 
 namespace tms_express::ui {
 
@@ -32,6 +35,23 @@ class CommandLineApp: public CLI::App {
     int run(int argc, char** argv);
 
  private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Enums //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Defines how reflector coefficients are quantized
+    enum Quantizer {
+        /// @brief Rounds each coefficient to its nearest Coding Table entry
+        QUANTIZER_NEAREST,
+
+        /// @brief Searches the neighboring Coding Table entries of the
+        ///         low-order coefficients for the closest spectral envelope
+        QUANTIZER_CLOSED_LOOP
+    };
+
+    /// @brief Command-line name of each Quantizer
+    static const std::map<std::string, Quantizer> kQuantizerNames;
+
     ///////////////////////////////////////////////////////////////////////////
     // Helper Methods /////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -39,6 +59,21 @@ class CommandLineApp: public CLI::App {
     /// @brief Attaches command-line arguments to Encoder application
     void setupEncoder();
 
+    /// @brief Attaches command-line arguments to Sweep application
+    void setupSweep();
+
+    /// @brief Creates a Bitstream Generator from the encoder settings
+    /// @return Bitstream Generator
+    std::shared_ptr<BitstreamGenerator> makeGenerator() const;
+
+    /// @brief Runs Sweep application
+    /// @return Zero if exitted successfully, non-zero otherwise
+    int runSweep();
+
+    /// @brief Writes the events recorded during an encode to the trace file,
+    ///         if requested
+    void writeTrace() const;
+
     ///////////////////////////////////////////////////////////////////////////
     // Command-Line Applications //////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -47,6 +82,10 @@ class CommandLineApp: public CLI::App {
     ///         audio files to LPC bitstreams
     CLI::App* encoder;
 
+    /// @brief Sweep application, exposed as "sweep" command, which ranks
+    ///         combinations of analysis parameters by resynthesis error
+    CLI::App* sweeper;
+
     ///////////////////////////////////////////////////////////////////////////
     // Encoder Application Members ////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -93,6 +132,98 @@ class CommandLineApp: public CLI::App {
 
     /// @brief Pitch analysis floor frequency, in Hertz
     int min_pitch_frq_ = 50;
+
+    /// @brief Pitch estimation algorithm
+    BitstreamGenerator::PitchAlgorithm pitch_algorithm_ =
+        FrameAnalyzer::PITCHALGORITHM_ACF;
+
+    /// @brief YIN pitch estimator absolute threshold
+    float yin_threshold_ = 0.1f;
+
+    /// @brief Decimation factor of the autocorrelation pitch search
+    int pitch_decimation_ = 1;
+
+    /// @brief Voicing decision hysteresis
+    float voicing_hysteresis_ = 0.0f;
+
+    /// @brief Highpass and lowpass Butterworth filter order
+    int filter_order_ = 2;
+
+    /// @brief Resampling algorithm
+    AudioBuffer::ResampleQuality resample_quality_ =
+        AudioBuffer::ResampleQuality::RESAMPLEQUALITY_SINC_BEST;
+
+    /// @brief Directory of the decoded-audio cache, or empty if disabled
+    std::string cache_directory_;
+
+    /// @brief true to print objective quality metrics, false otherwise
+    bool print_metrics_ = false;
+
+    /// @brief true to print per-stage timings and frame counts, false
+    ///         otherwise
+    bool print_stats_ = false;
+
+    /// @brief Format of per-stage timings and frame counts: table (0) or
+    ///         JSON (1)
+    int stats_format_ = 0;
+
+    /// @brief Path to Chrome trace-event JSON file, or empty if disabled
+    std::string trace_path_;
+
+    /// @brief Number of files encoded concurrently in batch mode, or zero to
+    ///         use every hardware thread
+    int encode_threads_ = 0;
+
+    /// @brief Reflector coefficient quantizer
+    Quantizer quantizer_ = QUANTIZER_CLOSED_LOOP;
+
+    /// @brief Max mean spectral distortion of rate-distortion optimized repeat
+    ///         frames, in decibels, or zero to disable optimization
+    float max_distortion_db_ = 0.0f;
+
+    /// @brief Max number of consecutive repeat frames
+    int max_repeat_chain_ = 4;
+
+    /// @brief Max spectral change within a variable frame rate repeat chain,
+    ///         in decibels, or zero to disable variable frame rate encoding
+    float variable_rate_db_ = 0.0f;
+
+    /// @brief Max size of each bitstream, in bytes, or zero if unlimited
+    int max_bytes_ = 0;
+
+    /// @brief Max bitrate of each bitstream, or zero if unlimited
+    float max_bitrate_ = 0.0f;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sweep Application Members //////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Path to existing input audio file or directory
+    std::string sweep_input_path_;
+
+    /// @brief Range of analysis window widths, in milliseconds
+    std::string sweep_window_ms_ = "25";
+
+    /// @brief Range of highpass filter cutoffs, in Hertz
+    std::string sweep_hpf_cutoff_ = "1000";
+
+    /// @brief Range of lowpass filter cutoffs, in Hertz
+    std::string sweep_lpf_cutoff_ = "800";
+
+    /// @brief Range of pre-emphasis filter coefficients
+    std::string sweep_preemphasis_alpha_ = "-0.9375";
+
+    /// @brief Range of pitch analysis ceiling frequencies, in Hertz
+    std::string sweep_max_pitch_frq_ = "500";
+
+    /// @brief Range of pitch analysis floor frequencies, in Hertz
+    std::string sweep_min_pitch_frq_ = "50";
+
+    /// @brief Number of worker threads, or zero for all hardware threads
+    int sweep_threads_ = 0;
+
+    /// @brief Number of ranked combinations to print
+    int sweep_n_rows_ = 10;
 };
 
 };  // namespace tms_express::ui
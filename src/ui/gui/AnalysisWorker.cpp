@@ -0,0 +1,104 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "ui/gui/AnalysisWorker.hpp"
+
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "bitstream/AnalysisPipeline.hpp"
+
+namespace tms_express::ui {
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+AnalysisWorker::AnalysisWorker(QObject *parent): QObject(parent) {
+    latest_generation_ = 0;
+    accepted_generation_ = 0;
+    n_published_inputs_ = 0;
+    published_generation_ = 0;
+    n_accepted_inputs_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Cancellation ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void AnalysisWorker::supersede(int generation) {
+    latest_generation_.store(generation, std::memory_order_release);
+}
+
+void AnalysisWorker::accept(int generation) {
+    accepted_generation_.store(generation, std::memory_order_release);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Qt Slots ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void AnalysisWorker::analyze(AnalysisJob job) {
+    // Input is taken even from superseded jobs, as the jobs which supersede
+    // them carry input only when the input changes
+    if (job.source != nullptr) {
+        pipeline_.setSource(*job.source);
+
+    } else if (job.imported_frames != nullptr) {
+        pipeline_.setFrames(*job.imported_frames);
+    }
+
+    // Otherwise, jobs queued behind a newer edit are discarded without any
+    // work, which coalesces a burst of edits into the last of them
+    if (isSuperseded(job)) {
+        return;
+    }
+
+    // Stages completed before the job is superseded remain cached, such that
+    // the next job resumes from the stage which was abandoned
+    auto is_cancelled = [this, &job]() { return isSuperseded(job); };
+
+    if (!pipeline_.run(job.parameters, is_cancelled)) {
+        return;
+    }
+
+    auto result = std::make_shared<AnalysisResult>();
+    result->generation = job.generation;
+    result->max_pitch_hz = pipeline_.getMaxPitchHz();
+    result->frames = pipeline_.getFrames();
+    result->synthesized_samples = pipeline_.getSynthesizedSamples();
+
+    // The UI thread discards results which were superseded after they were
+    // posted, so the input is posted with every result until one which
+    // carries it has been accepted
+    if (accepted_generation_.load(std::memory_order_acquire) >=
+        published_generation_) {
+        //
+        n_accepted_inputs_ = n_published_inputs_;
+    }
+
+    auto n_inputs = pipeline_.getNComputations(
+        AnalysisPipeline::STAGE_PITCH_FILTER);
+
+    if (n_inputs != n_accepted_inputs_) {
+        result->input_changed = true;
+        result->input_samples = pipeline_.getFilteredSamples();
+        n_published_inputs_ = n_inputs;
+        published_generation_ = job.generation;
+    }
+
+    emit analysisFinished(std::move(result));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool AnalysisWorker::isSuperseded(const AnalysisJob &job) const {
+    return latest_generation_.load(std::memory_order_acquire) !=
+        job.generation;
+}
+
+};  // namespace tms_express::ui
@@ -0,0 +1,163 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_USER_INTERFACES_ANALYSISWORKER_HPP_
+#define TMS_EXPRESS_USER_INTERFACES_ANALYSISWORKER_HPP_
+
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "encoding/Frame.hpp"
+#include "bitstream/AnalysisPipeline.hpp"
+
+namespace tms_express::ui {
+
+///////////////////////////////////////////////////////////////////////////////
+// Structures /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+/// @brief Request for the Analysis Worker to bring its results up to date
+struct AnalysisJob {
+    /// @brief Position of the job in the sequence of requests, such that a
+    ///         job is superseded by any job with a greater generation
+    int generation = 0;
+
+    /// @brief Settings with which to analyze
+    AnalysisParameters parameters;
+
+    /// @brief New input audio, or nullptr to keep the previous input
+    std::shared_ptr<const AudioBuffer> source;
+
+    /// @brief Imported Frame table, which replaces the input audio and skips
+    ///         directly to post-processing, or nullptr if not applicable
+    std::shared_ptr<const std::vector<Frame>> imported_frames;
+};
+
+/// @brief Outcome of a completed Analysis Job
+struct AnalysisResult {
+    /// @brief Generation of the job which produced the result
+    int generation = 0;
+
+    /// @brief true if the input samples were re-filtered, in which case
+    ///         input_samples holds the new samples
+    bool input_changed = false;
+
+    /// @brief Input audio, as filtered for pitch analysis
+    std::vector<float> input_samples;
+
+    /// @brief Post-processed Frame table
+    std::vector<Frame> frames;
+
+    /// @brief Audio synthesized from the Frame table
+    std::vector<float> synthesized_samples;
+
+    /// @brief Highest pitch representable by the pitch estimator, in Hertz,
+    ///         which normalizes the plotted pitch curve
+    int max_pitch_hz = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Analysis Worker ////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+/// @brief Runs the Analysis Pipeline on a background thread
+/// @details The UI thread announces each job via supersede() before posting
+///             it to the worker's thread. Jobs which have been superseded
+///             contribute only their input, and are otherwise discarded on
+///             arrival. A running job abandons its work between segments once
+///             superseded, such that a burst of edits costs at most one
+///             segment of latency. Only the results of the newest job are
+///             posted back, via a queued signal
+class AnalysisWorker : public QObject {
+    Q_OBJECT
+
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Analysis Worker
+    /// @param parent Parent Qt object, which must be nullptr if the worker is
+    ///                 to be moved to another thread
+    explicit AnalysisWorker(QObject *parent = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Cancellation ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Marks every job older than the given generation as superseded
+    /// @param generation Generation of the newest job
+    /// @note This function is thread-safe, and is intended to be called from
+    ///         the UI thread
+    void supersede(int generation);
+
+    /// @brief Records that the UI thread has accepted the result of a job,
+    ///         rather than discarding it as stale
+    /// @param generation Generation of the accepted result
+    /// @note This function is thread-safe, and is intended to be called from
+    ///         the UI thread
+    void accept(int generation);
+
+ public slots:
+    ///////////////////////////////////////////////////////////////////////////
+    // Qt Slots ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Performs a job, unless it has been superseded
+    /// @param job Job to perform
+    void analyze(tms_express::ui::AnalysisJob job);
+
+ signals:
+    ///////////////////////////////////////////////////////////////////////////
+    // Qt Signals /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Qt signal which delivers the results of a completed job
+    void analysisFinished(
+        std::shared_ptr<const tms_express::ui::AnalysisResult> result);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Checks whether a job has been superseded
+    /// @param job Job being performed
+    /// @return true if a newer job has been announced, false otherwise
+    bool isSuperseded(const AnalysisJob &job) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Generation of the newest job announced by the UI thread
+    std::atomic<int> latest_generation_;
+
+    /// @brief Cached analysis, which recomputes only the stages affected by
+    ///         each job
+    AnalysisPipeline pipeline_;
+
+    /// @brief Generation of the newest result accepted by the UI thread
+    std::atomic<int> accepted_generation_;
+
+    /// @brief Number of times the input audio had been filtered when it was
+    ///         last posted to the UI thread
+    int n_published_inputs_;
+
+    /// @brief Generation of the result which last posted the input audio
+    int published_generation_;
+
+    /// @brief Number of times the input audio had been filtered when it was
+    ///         last accepted by the UI thread
+    int n_accepted_inputs_;
+};
+
+};  // namespace tms_express::ui
+
+Q_DECLARE_METATYPE(tms_express::ui::AnalysisJob)
+Q_DECLARE_METATYPE(std::shared_ptr<const tms_express::ui::AnalysisResult>)
+
+#endif  // TMS_EXPRESS_USER_INTERFACES_ANALYSISWORKER_HPP_
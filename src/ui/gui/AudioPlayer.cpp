@@ -0,0 +1,289 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "ui/gui/AudioPlayer.hpp"
+
+#include <QAudioDevice>
+#include <QAudioFormat>
+#include <QAudioSink>
+#include <QByteArray>
+#include <QDebug>
+#include <QIODevice>
+#include <QMediaDevices>
+#include <QObject>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/Resampler.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/SynthesisStream.hpp"
+
+namespace tms_express::ui {
+
+/// @brief Sample rate of synthesized audio, in Hertz
+static constexpr int kSynthesisRateHz = 8000;
+
+/// @brief Converts a floating-point sample to 16-bit PCM
+/// @param sample Floating-point sample
+/// @return PCM sample
+static inline int16_t toPcm(float sample) {
+    return static_cast<int16_t>(std::clamp(sample, -1.0f, 1.0f) * 32767.0f);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Synthesis Stream Device ////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+SynthesisStreamDevice::SynthesisStreamDevice(QObject *parent):
+    QIODevice(parent) {
+    //
+    stream_ = nullptr;
+    n_channels_ = 1;
+    scratch_.fill(0.0f);
+}
+
+void SynthesisStreamDevice::setStream(SynthesisStream *stream,
+    int n_channels) {
+    //
+    stream_ = stream;
+    n_channels_ = n_channels;
+}
+
+bool SynthesisStreamDevice::isSequential() const {
+    return true;
+}
+
+qint64 SynthesisStreamDevice::readData(char *data, qint64 max_size) {
+    if (stream_ == nullptr || stream_->isFinished()) {
+        return 0;
+    }
+
+    auto n_frame_bytes = static_cast<qint64>(sizeof(int16_t)) * n_channels_;
+    auto n_samples = static_cast<int>(max_size / n_frame_bytes);
+    auto pcm = reinterpret_cast<int16_t *>(data);
+    auto n_read = 0;
+
+    // This function runs on the audio thread, and so only ever touches the
+    // stream's lock-free buffer and preallocated scratch space
+    while (n_read < n_samples) {
+        auto n_wanted = std::min(n_samples - n_read,
+            static_cast<int>(scratch_.size()));
+        auto n_chunk = stream_->read(scratch_.data(), n_wanted);
+
+        if (n_chunk == 0) {
+            break;
+        }
+
+        for (int i = 0; i < n_chunk; i++) {
+            auto value = toPcm(scratch_[i]);
+
+            for (int channel = 0; channel < n_channels_; channel++) {
+                *pcm++ = value;
+            }
+        }
+
+        n_read += n_chunk;
+    }
+
+    // An underrun is padded with silence, which is less disruptive than the
+    // sink pausing and restarting
+    if (!stream_->isFinished()) {
+        std::memset(pcm, 0, (n_samples - n_read) * n_frame_bytes);
+        n_read = n_samples;
+    }
+
+    return n_read * n_frame_bytes;
+}
+
+qint64 SynthesisStreamDevice::writeData(const char *data, qint64 max_size) {
+    static_cast<void>(data);
+    static_cast<void>(max_size);
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+AudioPlayer::AudioPlayer(QObject *parent): QObject(parent) {
+    sink_ = nullptr;
+    format_ = QAudioFormat();
+    pcm_ = QByteArray();
+    stream_ = nullptr;
+    is_streaming_ = false;
+}
+
+AudioPlayer::~AudioPlayer() {
+    stop();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Playback ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void AudioPlayer::play(const std::vector<float> &samples,
+    int sample_rate_hz) {
+    //
+    stop();
+
+    if (samples.empty()) {
+        return;
+    }
+
+    prepareSink(sample_rate_hz);
+
+    if (format_.sampleRate() == sample_rate_hz) {
+        pcm_ = encode(samples, format_.channelCount());
+
+    } else {
+        auto resampled = std::vector<float>();
+
+        try {
+            auto resampler = Resampler(sample_rate_hz, format_.sampleRate(),
+                AudioBuffer::RESAMPLEQUALITY_SINC_FASTEST);
+
+            resampler.process(samples.data(),
+                static_cast<int>(samples.size()), resampled);
+            resampler.flush(resampled);
+
+        } catch (const std::exception &e) {
+            qDebug() << "Could not resample audio for playback:" << e.what();
+            return;
+        }
+
+        pcm_ = encode(resampled, format_.channelCount());
+    }
+
+    pcm_buffer_.setBuffer(&pcm_);
+    pcm_buffer_.open(QIODevice::ReadOnly);
+    sink_->start(&pcm_buffer_);
+}
+
+void AudioPlayer::stream(std::shared_ptr<const std::vector<Frame>> frames) {
+    stop();
+
+    if (frames == nullptr || frames->empty()) {
+        return;
+    }
+
+    prepareSink(kSynthesisRateHz);
+
+    if (stream_ == nullptr ||
+        stream_->getSampleRateHz() != format_.sampleRate()) {
+        //
+        stream_ = std::make_unique<SynthesisStream>(format_.sampleRate());
+    }
+
+    try {
+        stream_->start(std::move(frames));
+
+    } catch (const std::exception &e) {
+        qDebug() << "Could not start synthesis stream:" << e.what();
+        return;
+    }
+
+    stream_device_.setStream(stream_.get(), format_.channelCount());
+    stream_device_.open(QIODevice::ReadOnly);
+    sink_->start(&stream_device_);
+    is_streaming_ = true;
+}
+
+void AudioPlayer::updateStream(
+    std::shared_ptr<const std::vector<Frame>> frames) {
+    //
+    if (isStreaming()) {
+        stream_->setFrames(std::move(frames));
+    }
+}
+
+bool AudioPlayer::isStreaming() const {
+    return is_streaming_ && !stream_->isFinished();
+}
+
+void AudioPlayer::stop() {
+    // The sink is stopped first, such that neither source is read while it
+    // is being torn down
+    if (sink_ != nullptr) {
+        sink_->stop();
+    }
+
+    if (pcm_buffer_.isOpen()) {
+        pcm_buffer_.close();
+    }
+
+    if (stream_ != nullptr) {
+        stream_->stop();
+    }
+
+    if (stream_device_.isOpen()) {
+        stream_device_.close();
+    }
+
+    is_streaming_ = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+QAudioFormat AudioPlayer::selectFormat(int sample_rate_hz) {
+    auto device = QMediaDevices::defaultAudioOutput();
+
+    auto format = QAudioFormat();
+    format.setSampleRate(sample_rate_hz);
+    format.setChannelCount(1);
+    format.setSampleFormat(QAudioFormat::Int16);
+
+    if (device.isFormatSupported(format)) {
+        return format;
+    }
+
+    auto preferred = device.preferredFormat();
+    format.setSampleRate(preferred.sampleRate());
+    format.setChannelCount(preferred.channelCount());
+
+    return format;
+}
+
+QByteArray AudioPlayer::encode(const std::vector<float> &samples,
+    int n_channels) {
+    //
+    auto n_bytes = static_cast<qsizetype>(samples.size()) * n_channels *
+        static_cast<qsizetype>(sizeof(int16_t));
+    auto pcm = QByteArray(n_bytes, Qt::Uninitialized);
+
+    auto data = reinterpret_cast<int16_t *>(pcm.data());
+
+    for (const auto &sample : samples) {
+        auto value = toPcm(sample);
+
+        for (int channel = 0; channel < n_channels; channel++) {
+            *data++ = value;
+        }
+    }
+
+    return pcm;
+}
+
+void AudioPlayer::prepareSink(int sample_rate_hz) {
+    auto format = selectFormat(sample_rate_hz);
+
+    // Re-creating the sink is only necessary when the format changes, which
+    // in practice happens only when the default output device changes
+    if (sink_ == nullptr || format != format_) {
+        delete sink_;
+        sink_ = new QAudioSink(QMediaDevices::defaultAudioOutput(), format,
+            this);
+        format_ = format;
+    }
+
+    sink_->setVolume(1.0);
+}
+
+};  // namespace tms_express::ui
@@ -0,0 +1,165 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_USER_INTERFACES_AUDIOPLAYER_HPP_
+#define TMS_EXPRESS_USER_INTERFACES_AUDIOPLAYER_HPP_
+
+#include <QAudioFormat>
+#include <QAudioSink>
+#include <QBuffer>
+#include <QByteArray>
+#include <QIODevice>
+#include <QObject>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "encoding/Frame.hpp"
+#include "encoding/SynthesisStream.hpp"
+
+namespace tms_express::ui {
+
+/// @brief Read-only device through which an audio sink pulls samples from a
+///         Synthesis Stream
+/// @details Reads are served from the stream's lock-free buffer, without
+///             blocking or allocating. If the synthesizer falls behind, the
+///             shortfall is padded with silence rather than stalling the sink
+class SynthesisStreamDevice : public QIODevice {
+ public:
+    /// @brief Creates a new Synthesis Stream Device
+    /// @param parent Parent Qt object
+    explicit SynthesisStreamDevice(QObject *parent = nullptr);
+
+    /// @brief Attaches the device to a stream
+    /// @param stream Synthesis Stream, which must outlive any reads
+    /// @param n_channels Number of output channels, to each of which every
+    ///                     sample is copied
+    void setStream(SynthesisStream *stream, int n_channels);
+
+    /// @brief Reports that samples are sequential, rather than seekable
+    /// @return true
+    bool isSequential() const override;
+
+ protected:
+    /// @brief Converts buffered samples to interleaved 16-bit PCM
+    /// @param data Destination of PCM bytes
+    /// @param max_size Max number of bytes to produce
+    /// @return Number of bytes produced, or zero once the stream has finished
+    qint64 readData(char *data, qint64 max_size) override;
+
+    /// @brief Rejects writes, as the device is read-only
+    /// @return -1
+    qint64 writeData(const char *data, qint64 max_size) override;
+
+ private:
+    /// @brief Stream from which samples are read
+    SynthesisStream *stream_;
+
+    /// @brief Number of output channels
+    int n_channels_;
+
+    /// @brief Scratch space for samples awaiting conversion
+    std::array<float, 256> scratch_;
+};
+
+/// @brief Plays floating-point samples directly from memory, or synthesizes a
+///         Frame table as it plays
+/// @details Samples are converted to 16-bit PCM and streamed to the default
+///             audio output by a Qt audio sink, without touching the disk. If
+///             the output cannot accept mono audio at the samples' rate, the
+///             samples are first resampled to the output's preferred rate
+class AudioPlayer : public QObject {
+    Q_OBJECT
+
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Audio Player
+    /// @param parent Parent Qt object
+    explicit AudioPlayer(QObject *parent = nullptr);
+
+    /// @brief Stops playback, such that the sink never outlives its source
+    ~AudioPlayer() override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Playback ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Plays samples, interrupting any audio already playing
+    /// @param samples Floating-point samples, in the range [-1, 1]
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    void play(const std::vector<float> &samples, int sample_rate_hz);
+
+    /// @brief Synthesizes and plays a Frame table, interrupting any audio
+    ///         already playing
+    /// @param frames Frame table
+    void stream(std::shared_ptr<const std::vector<Frame>> frames);
+
+    /// @brief Replaces the Frame table being streamed, such that edits are
+    ///         heard from the next Frame onward
+    /// @param frames New Frame table
+    /// @note Has no effect unless a Frame table is being streamed
+    void updateStream(std::shared_ptr<const std::vector<Frame>> frames);
+
+    /// @brief Reports whether a Frame table is being streamed
+    /// @return true if streaming and not yet finished, false otherwise
+    bool isStreaming() const;
+
+    /// @brief Stops playback
+    void stop();
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Selects the format in which samples are sent to the output
+    /// @param sample_rate_hz Sample rate of samples, in Hertz
+    /// @return Mono 16-bit format at the given rate if supported, otherwise
+    ///         16-bit format at the output's preferred rate and channel count
+    static QAudioFormat selectFormat(int sample_rate_hz);
+
+    /// @brief Converts floating-point samples to interleaved 16-bit PCM
+    /// @param samples Floating-point samples
+    /// @param n_channels Number of channels, to each of which every sample is
+    ///                     copied
+    /// @return PCM bytes
+    static QByteArray encode(const std::vector<float> &samples,
+        int n_channels);
+
+    /// @brief Prepares the audio sink for the given sample rate
+    /// @param sample_rate_hz Sample rate of audio, in Hertz
+    void prepareSink(int sample_rate_hz);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Audio sink, which is re-created whenever the format changes
+    QAudioSink *sink_;
+
+    /// @brief Format of the audio sink
+    QAudioFormat format_;
+
+    /// @brief PCM bytes being played, read by the sink through pcm_buffer_
+    QByteArray pcm_;
+
+    /// @brief In-memory device through which the sink reads pcm_
+    QBuffer pcm_buffer_;
+
+    /// @brief Synthesizer of streamed Frame tables, which is re-created
+    ///         whenever the output sample rate changes
+    std::unique_ptr<SynthesisStream> stream_;
+
+    /// @brief Device through which the sink reads stream_
+    SynthesisStreamDevice stream_device_;
+
+    /// @brief true if the sink is reading stream_ rather than pcm_
+    bool is_streaming_;
+};
+
+};  // namespace tms_express::ui
+
+#endif  // TMS_EXPRESS_USER_INTERFACES_AUDIOPLAYER_HPP_
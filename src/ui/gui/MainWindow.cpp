@@ -8,25 +8,26 @@
 #include <QGroupBox>
 #include <QHBoxLayout>
 #include <QMainWindow>
-#include <QMediaPlayer>
 #include <QMenuBar>
+#include <QThread>
 #include <QVBoxLayout>
 
-#include <QtMultimedia/QAudioOutput>
-
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <utility>
 #include <vector>
 
-#include "lib/CRC.h"
-
 #include "audio/AudioBuffer.hpp"
-#include "encoding/FramePostprocessor.hpp"
-#include "analysis/Autocorrelation.hpp"
+#include "ui/gui/AnalysisWorker.hpp"
+#include "ui/gui/AudioPlayer.hpp"
+#include "ui/gui/SpectrogramWorker.hpp"
 #include "ui/gui/audiowaveform/AudioWaveformView.hpp"
 #include "ui/gui/controlpanels/ControlPanelPitchView.hpp"
 #include "ui/gui/controlpanels/ControlPanelLpcView.hpp"
 #include "ui/gui/controlpanels/ControlPanelPostView.hpp"
+#include "ui/gui/spectrogram/SpectrogramView.hpp"
 
 namespace tms_express::ui {
 
@@ -85,8 +86,21 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
     lpc_waveform_->setSizePolicy(QSizePolicy::Expanding,
         QSizePolicy::Expanding);
 
+    // Each waveform is followed by its spectrogram
+    input_spectrogram_ = new SpectrogramView(this);
+    input_spectrogram_->setMinimumSize(750, 100);
+    input_spectrogram_->setSizePolicy(QSizePolicy::Expanding,
+        QSizePolicy::Expanding);
+
+    lpc_spectrogram_ = new SpectrogramView(this);
+    lpc_spectrogram_->setMinimumSize(750, 100);
+    lpc_spectrogram_->setSizePolicy(QSizePolicy::Expanding,
+        QSizePolicy::Expanding);
+
     main_layout_->addWidget(input_waveform_);
+    main_layout_->addWidget(input_spectrogram_);
     main_layout_->addWidget(lpc_waveform_);
+    main_layout_->addWidget(lpc_spectrogram_);
 
     // Menu Bar
     action_export_ = new QAction(this);
@@ -111,20 +125,67 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
     menu_file->addAction(action_save_);
     menu_file->addAction(action_export_);
 
-    player = new QMediaPlayer(this);
-    audio_output_ = new QAudioOutput(this);
+    audio_player_ = new AudioPlayer(this);
 
     input_buffer_ = AudioBuffer();
-    lpc_buffer_ = AudioBuffer();
-
+    lpc_samples_ = {};
     frame_table_ = {};
-    pitch_period_table_ = {};
-    pitch_curve_table_ = {};
+    max_pitch_hz_ = 0;
+
+    // Analysis runs on a dedicated thread, which owns the worker. Jobs and
+    // results cross threads via queued signals, so their types are registered
+    qRegisterMetaType<AnalysisJob>();
+    qRegisterMetaType<std::shared_ptr<const AnalysisResult>>();
+
+    analysis_generation_ = 0;
+    analysis_worker_ = new AnalysisWorker();
+    analysis_worker_->moveToThread(&analysis_thread_);
+
+    connect(&analysis_thread_, &QThread::finished, analysis_worker_,
+        &QObject::deleteLater);
+
+    analysis_thread_.start();
+
+    // Spectrograms are computed on a thread of their own, such that a long
+    // input does not delay the results of analysis
+    qRegisterMetaType<SpectrogramJob>();
+    qRegisterMetaType<std::shared_ptr<const SpectrogramOverlay>>();
+
+    spectrogram_generation_ = 0;
+    input_spectrogram_worker_ = new SpectrogramWorker();
+    input_spectrogram_worker_->moveToThread(&spectrogram_thread_);
+
+    lpc_spectrogram_worker_ = new SpectrogramWorker();
+    lpc_spectrogram_worker_->moveToThread(&spectrogram_thread_);
+
+    connect(&spectrogram_thread_, &QThread::finished,
+        input_spectrogram_worker_, &QObject::deleteLater);
+
+    connect(&spectrogram_thread_, &QThread::finished,
+        lpc_spectrogram_worker_, &QObject::deleteLater);
+
+    spectrogram_thread_.start();
 
     configureUiSlots();
     configureUiState();
 }
 
+MainWindow::~MainWindow() {
+    // Abandon the job in progress, if any, at its next segment
+    analysis_worker_->supersede(++analysis_generation_);
+
+    analysis_thread_.quit();
+    analysis_thread_.wait();
+
+    // Likewise, abandon the spectrograms in progress at their next tile
+    ++spectrogram_generation_;
+    input_spectrogram_worker_->supersede(spectrogram_generation_);
+    lpc_spectrogram_worker_->supersede(spectrogram_generation_);
+
+    spectrogram_thread_.quit();
+    spectrogram_thread_.wait();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Qt Slots ///////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -147,35 +208,36 @@ void MainWindow::onOpenFile() {
         input_buffer_ = AudioBuffer();
     }
 
-    if (!lpc_buffer_.empty()) {
-        lpc_buffer_ = AudioBuffer();
-    }
-
     frame_table_.clear();
-    pitch_period_table_.clear();
-    pitch_curve_table_.clear();
+    lpc_samples_.clear();
 
     // Import audio file
     if (filepath.endsWith(".wav", Qt::CaseInsensitive)) {
         // Enable gain normalization by default
         // ui->postGainNormalizeEnable->setChecked(true);
 
-        auto input_buffer_ptr = AudioBuffer::Create(
-            filepath.toStdString(), 8000,
-            lpc_control_->getAnalysisWindowWidth());
+        std::shared_ptr<AudioBuffer> input_buffer_ptr;
+
+        try {
+            input_buffer_ptr = AudioBuffer::Create(filepath.toStdString(),
+                8000, lpc_control_->getAnalysisWindowWidth());
+
+        } catch (const std::exception &e) {
+            QMessageBox::critical(this, "Error", e.what());
+            return;
+        }
 
         if (input_buffer_ptr == nullptr) {
             QMessageBox::critical(this, "Error", "Could not read audio file");
             return;
         }
 
+        // The unfiltered input is shown until the worker delivers the
+        // filtered input along with the first analysis
         input_buffer_ = input_buffer_ptr->copy();
-        lpc_buffer_ = input_buffer_ptr->copy();
-
-        performPitchAnalysis();
-        performLpcAnalysis();
-        frame_postprocessor_ = FramePostprocessor(&frame_table_);
-        performPostProc();
+        input_waveform_->setSamples(input_buffer_.getSamples());
+        requestAnalysis(input_buffer_ptr);
+        requestSpectrograms(true);
 
         configureUiState();
         drawPlots();
@@ -188,8 +250,13 @@ void MainWindow::onOpenFile() {
         // ui->postGainNormalizeEnable->setChecked(false);
 
         importBitstream(filepath.toStdString());
-        frame_postprocessor_ = FramePostprocessor(&frame_table_);
-        performPostProc();
+        input_waveform_->setSamples({});
+        requestSpectrograms(true);
+
+        if (!frame_table_.empty()) {
+            requestAnalysis(nullptr,
+                std::make_shared<const std::vector<Frame>>(frame_table_));
+        }
 
         configureUiState();
         drawPlots();
@@ -238,9 +305,8 @@ void MainWindow::onExportAudio() {
         return;
     }
 
-    synthesizer_.render(synthesizer_.getSamples(),
-        filepath.toStdString(), lpc_buffer_.getSampleRateHz(),
-        lpc_buffer_.getWindowWidthMs());
+    Synthesizer::render(lpc_samples_, filepath.toStdString(),
+        TE_AUDIO_SAMPLE_RATE, lpc_control_->getAnalysisWindowWidth());
 }
 
 void MainWindow::onInputAudioPlay() {
@@ -249,26 +315,8 @@ void MainWindow::onInputAudioPlay() {
         return;
     }
 
-    // Generate checksum of buffer to produce unique temporary filename
-    //
-    // The pre-emphasis alpha coefficient will be included in this computation,
-    // as its impact on the buffer may not be significant enough to modify the
-    // buffer checksum alone
-    char filename[31];
-    auto checksum = samplesChecksum(input_buffer_.getSamples());
-    snprintf(filename, sizeof(filename), "tmsexpress_render_%x.wav", checksum);
-
-    // Only render audio if this particular buffer does not exist
-    auto temp_dir = std::filesystem::temp_directory_path();
-    temp_dir.append(filename);
-    qDebug() << "Playing " << temp_dir.c_str();
-    input_buffer_.render(temp_dir);
-
-    // Setup player and play
-    player->setAudioOutput(audio_output_);
-    player->setSource(QUrl::fromLocalFile(temp_dir.c_str()));
-    audio_output_->setVolume(100);
-    player->play();
+    audio_player_->play(input_buffer_.getSamples(),
+        input_buffer_.getSampleRateHz());
 }
 
 /// Play synthesized bitstream audio
@@ -277,58 +325,25 @@ void MainWindow::onLpcAudioPlay() {
         return;
     }
 
-    synthesizer_.synthesize(frame_table_);
-
-    // Generate checksum of buffer to produce unique temporary filename
-    //
-    // The pre-emphasis alpha coefficient will be included in this computation,
-    // as its impact on the buffer may not be significant enough to modify the
-    // buffer checksum alone
-    char filename[35];
-
-    uint checksum = (!lpc_buffer_.empty()) ?
-        samplesChecksum(lpc_buffer_.getSamples()) :
-        samplesChecksum(synthesizer_.getSamples());
-
-    snprintf(filename, sizeof(filename), "tmsexpress_lpc_render_%x.wav",
-        checksum);
-
-    // Only render audio if this particular buffer does not exist
-    auto temp_dir = std::filesystem::temp_directory_path();
-    temp_dir.append(filename);
-
-    qDebug() << "Playing " << temp_dir.c_str();
-
-    synthesizer_.render(synthesizer_.getSamples(),
-        temp_dir, lpc_buffer_.getSampleRateHz(),
-        lpc_buffer_.getWindowWidthMs());
-
-    // Setup player and play
-    player->setAudioOutput(audio_output_);
-    player->setSource(QUrl::fromLocalFile(temp_dir.c_str()));
-    audio_output_->setVolume(100);
-    player->play();
+    // The Frame table is synthesized as it plays, such that edits made during
+    // playback are heard as soon as analysis delivers them
+    audio_player_->stream(
+        std::make_shared<const std::vector<Frame>>(frame_table_));
 }
 
 void MainWindow::onPitchParamEdit() {
     configureUiState();
 
     if (!input_buffer_.empty()) {
-        performPitchAnalysis();
-        performLpcAnalysis();
-
-        drawPlots();
+        requestAnalysis();
     }
 }
 
 void MainWindow::onLpcParamEdit() {
     configureUiState();
 
-    if (!lpc_buffer_.empty()) {
-        performLpcAnalysis();
-        performPostProc();
-
-        drawPlots();
+    if (!input_buffer_.empty()) {
+        requestAnalysis();
     }
 }
 
@@ -336,10 +351,39 @@ void MainWindow::onPostProcEdit() {
     configureUiState();
 
     if (!frame_table_.empty()) {
-        performPostProc();
+        requestAnalysis();
+    }
+}
 
-        drawPlots();
+void MainWindow::onAnalysisFinished(
+    std::shared_ptr<const AnalysisResult> result) {
+    //
+    // A result may have been queued before a newer job was requested
+    if (result->generation != analysis_generation_) {
+        return;
+    }
+
+    analysis_worker_->accept(result->generation);
+
+    if (result->input_changed) {
+        input_buffer_.setSamples(result->input_samples);
+        input_waveform_->setSamples(result->input_samples);
+    }
+
+    frame_table_ = result->frames;
+    lpc_samples_ = result->synthesized_samples;
+    max_pitch_hz_ = result->max_pitch_hz;
+
+    requestSpectrograms(result->input_changed);
+
+    // Frames which have not yet been streamed are taken from the new table
+    if (audio_player_->isStreaming()) {
+        audio_player_->updateStream(
+            std::make_shared<const std::vector<Frame>>(frame_table_));
     }
+
+    configureUiState();
+    drawPlots();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -373,6 +417,38 @@ void MainWindow::configureUiSlots() {
 
     connect(lpc_waveform_, &AudioWaveformView::signalPlayButtonPressed, this,
         &MainWindow::onLpcAudioPlay);
+
+    // Analysis worker, whose slots run on its own thread
+    connect(this, &MainWindow::analysisRequested, analysis_worker_,
+        &AnalysisWorker::analyze);
+
+    connect(analysis_worker_, &AnalysisWorker::analysisFinished, this,
+        &MainWindow::onAnalysisFinished);
+
+    // Spectrogram workers, whose tiles are delivered directly to their views
+    connect(this, &MainWindow::inputSpectrogramRequested,
+        input_spectrogram_worker_, &SpectrogramWorker::compute);
+
+    connect(this, &MainWindow::lpcSpectrogramRequested,
+        lpc_spectrogram_worker_, &SpectrogramWorker::compute);
+
+    connect(input_spectrogram_worker_, &SpectrogramWorker::spectrogramResized,
+        input_spectrogram_, &SpectrogramView::onSpectrogramResized);
+
+    connect(input_spectrogram_worker_, &SpectrogramWorker::tileReady,
+        input_spectrogram_, &SpectrogramView::onTileReady);
+
+    connect(input_spectrogram_worker_, &SpectrogramWorker::overlayReady,
+        input_spectrogram_, &SpectrogramView::onOverlayReady);
+
+    connect(lpc_spectrogram_worker_, &SpectrogramWorker::spectrogramResized,
+        lpc_spectrogram_, &SpectrogramView::onSpectrogramResized);
+
+    connect(lpc_spectrogram_worker_, &SpectrogramWorker::tileReady,
+        lpc_spectrogram_, &SpectrogramView::onTileReady);
+
+    connect(lpc_spectrogram_worker_, &SpectrogramWorker::overlayReady,
+        lpc_spectrogram_, &SpectrogramView::onOverlayReady);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -396,14 +472,11 @@ void MainWindow::configureUiState() {
 }
 
 void MainWindow::drawPlots() {
-    input_waveform_->setSamples(input_buffer_.getSamples());
-
     if (!frame_table_.empty()) {
-        auto samples = synthesizer_.synthesize(frame_table_);
-        lpc_waveform_->setSamples(samples);
+        lpc_waveform_->setSamples(lpc_samples_);
 
         auto tmp_pitch_curve_table = std::vector<float>(frame_table_.size());
-        const auto max_pitch = static_cast<float>(pitch_estimator_.getMaxFrq());
+        const auto max_pitch = static_cast<float>(max_pitch_hz_);
 
         for (int i = 0; i < static_cast<int>(frame_table_.size()); i++) {
             auto quantized_pitch = static_cast<float>(
@@ -424,123 +497,90 @@ void MainWindow::drawPlots() {
 // LPC Routines ///////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////
 
-void MainWindow::performPitchAnalysis() {
-    // Clear tables
-    input_buffer_.reset();
-    pitch_period_table_.clear();
-    pitch_curve_table_.clear();
-
-    // Pre-process
-    if (pitch_control_->getHpfEnabled()) {
-        filter_.applyHighpass(input_buffer_, pitch_control_->getHpfCutoff());
-    }
-
-    if (pitch_control_->getLpfEnabled()) {
-        filter_.applyLowpass(input_buffer_, pitch_control_->getLpfCutoff());
-    }
-
-    if (pitch_control_->getPreEmphasisEnabled()) {
-        filter_.applyPreEmphasis(input_buffer_,
-            pitch_control_->getPreEmphasisAlpha());
-    }
-
-    pitch_estimator_.setMaxPeriod(pitch_control_->getMinPitchFrq());
-    pitch_estimator_.setMinPeriod(pitch_control_->getMaxPitchFrq());
-
-    const auto max_pitch = static_cast<float>(pitch_estimator_.getMaxFrq());
-
-    for (const auto &segment : input_buffer_.getAllSegments()) {
-        auto acf = tms_express::Autocorrelation(segment);
-        auto period = pitch_estimator_.estimatePeriod(acf);
-        auto frq = pitch_estimator_.estimateFrequency(acf) / max_pitch;
-
-        pitch_period_table_.push_back(period);
-        pitch_curve_table_.push_back(frq);
-    }
+AnalysisParameters MainWindow::snapshotParameters() const {
+    auto parameters = AnalysisParameters();
+
+    parameters.pitch_hpf_enabled = pitch_control_->getHpfEnabled();
+    parameters.pitch_hpf_cutoff_hz = pitch_control_->getHpfCutoff();
+    parameters.pitch_lpf_enabled = pitch_control_->getLpfEnabled();
+    parameters.pitch_lpf_cutoff_hz = pitch_control_->getLpfCutoff();
+    parameters.pitch_pre_emphasis_enabled =
+        pitch_control_->getPreEmphasisEnabled();
+    parameters.pitch_pre_emphasis_alpha =
+        pitch_control_->getPreEmphasisAlpha();
+    parameters.min_pitch_hz = pitch_control_->getMinPitchFrq();
+    parameters.max_pitch_hz = pitch_control_->getMaxPitchFrq();
+    parameters.yin_enabled = pitch_control_->getYinEnabled();
+    parameters.yin_threshold = pitch_control_->getYinThreshold();
+
+    parameters.window_width_ms = lpc_control_->getAnalysisWindowWidth();
+    parameters.lpc_hpf_enabled = lpc_control_->getHpfEnabled();
+    parameters.lpc_hpf_cutoff_hz = lpc_control_->getHpfCutoff();
+    parameters.lpc_lpf_enabled = lpc_control_->getLpfEnabled();
+    parameters.lpc_lpf_cutoff_hz = lpc_control_->getLpfCutoff();
+    parameters.lpc_pre_emphasis_enabled =
+        lpc_control_->getPreEmphasisEnabled();
+    parameters.lpc_pre_emphasis_alpha = lpc_control_->getPreEmphasisAlpha();
+
+    parameters.max_unvoiced_gain_db = post_control_->getMaxUnvoicedGain();
+    parameters.max_voiced_gain_db = post_control_->getMaxVoicedGain();
+    parameters.gain_normalization_enabled =
+        post_control_->getGainNormalizationEnabled();
+    parameters.pitch_shift_enabled = post_control_->getPitchShiftEnabled();
+    parameters.pitch_shift = post_control_->getPitchShift();
+    parameters.pitch_override_enabled =
+        post_control_->getPitchOverrideEnabled();
+    parameters.pitch_override = post_control_->getPitchOverride();
+    parameters.repeat_frames_enabled = post_control_->getRepeatFramesEnabled();
+    parameters.gain_shift_enabled = post_control_->getGainShiftEnabled();
+    parameters.gain_shift = post_control_->getGainShift();
+
+    return parameters;
 }
 
-void MainWindow::performLpcAnalysis() {
-    // Clear tables
-    lpc_buffer_.reset();
-    frame_table_.clear();
-
-    // Re-trigger pitch analysis if window width has changed
-    if (lpc_control_->getAnalysisWindowWidth() !=
-        input_buffer_.getWindowWidthMs()) {
-        //
-        input_buffer_.setWindowWidthMs(lpc_control_->getAnalysisWindowWidth());
-        lpc_buffer_.setWindowWidthMs(lpc_control_->getAnalysisWindowWidth());
-
-        qDebug() << "Adjusting window width for pitch and LPC buffers";
-        performPitchAnalysis();
-    }
-
-    // Pre-process
-    if (lpc_control_->getHpfEnabled()) {
-        qDebug() << "HPF";
-        filter_.applyHighpass(lpc_buffer_, lpc_control_->getHpfCutoff());
-    }
-
-    if (lpc_control_->getLpfEnabled()) {
-        qDebug() << "LPF";
-        filter_.applyLowpass(lpc_buffer_, lpc_control_->getLpfCutoff());
-    }
-
-    if (lpc_control_->getPreEmphasisEnabled()) {
-        qDebug() << "PEF";
-        qDebug() << (lpc_buffer_.empty());
-        filter_.applyPreEmphasis(lpc_buffer_,
-            lpc_control_->getPreEmphasisAlpha());
-    }
-
-    for (int i = 0; i < lpc_buffer_.getNSegments(); i++) {
-        auto segment = lpc_buffer_.getSegment(i);
-        auto acf = tms_express::Autocorrelation(segment);
-
-        auto coeffs = linear_predictor_.computeCoeffs(acf);
-        auto gain = linear_predictor_.gain();
-
-        auto period = pitch_period_table_[i];
-        auto is_voiced = coeffs[0] < 0;
-
-        frame_table_.emplace_back(period, is_voiced, gain, coeffs);
-    }
-
-    frame_postprocessor_ = FramePostprocessor(&frame_table_);
+void MainWindow::requestAnalysis(
+    std::shared_ptr<const AudioBuffer> source,
+    std::shared_ptr<const std::vector<Frame>> imported_frames) {
+    //
+    auto job = AnalysisJob();
+    job.generation = ++analysis_generation_;
+    job.parameters = snapshotParameters();
+    job.source = std::move(source);
+    job.imported_frames = std::move(imported_frames);
+
+    // Announce the job before posting it, such that the worker abandons its
+    // current job immediately rather than upon reaching this one
+    analysis_worker_->supersede(job.generation);
+    emit analysisRequested(job);
 }
 
-void MainWindow::performPostProc() {
-    // Clear tables
-    frame_postprocessor_.reset();
-
-    // Re-configure post-processor
-    frame_postprocessor_.setMaxUnvoicedGainDB(
-        post_control_->getMaxUnvoicedGain());
+void MainWindow::requestSpectrograms(bool input_changed) {
+    auto frames = std::make_shared<const std::vector<Frame>>(frame_table_);
 
-    frame_postprocessor_.setMaxVoicedGainDB(post_control_->getMaxVoicedGain());
+    // Each Frame of the input spans one analysis window, whereas each Frame
+    // of the synthesized audio spans one synthesis frame
+    auto input_job = SpectrogramJob();
+    input_job.generation = ++spectrogram_generation_;
+    input_job.frames = frames;
+    input_job.n_samples_per_frame = static_cast<int>(
+        lpc_control_->getAnalysisWindowWidth() * TE_AUDIO_SAMPLE_RATE / 1000);
 
-    if (post_control_->getGainNormalizationEnabled()) {
-        frame_postprocessor_.normalizeGain();
+    if (input_changed) {
+        input_job.samples = std::make_shared<const std::vector<float>>(
+            input_buffer_.getSamples());
     }
 
-    // Perform either a pitch shift or a fixed-pitch offset
-    if (post_control_->getPitchShiftEnabled()) {
-        frame_postprocessor_.shiftPitch(post_control_->getPitchShift());
+    auto lpc_job = SpectrogramJob();
+    lpc_job.generation = spectrogram_generation_;
+    lpc_job.frames = frames;
+    lpc_job.samples = std::make_shared<const std::vector<float>>(lpc_samples_);
+    lpc_job.n_samples_per_frame = Synthesizer().getNSamplesPerFrame();
 
-    } else if (post_control_->getPitchOverrideEnabled()) {
-        frame_postprocessor_.overridePitch(post_control_->getPitchOverride());
-    }
-
-    if (post_control_->getRepeatFramesEnabled()) {
-        auto nRepeatFrames = frame_postprocessor_.detectRepeatFrames();
-        qDebug() << "Detected " << nRepeatFrames << " repeat frames";
-    }
+    input_spectrogram_worker_->supersede(spectrogram_generation_);
+    lpc_spectrogram_worker_->supersede(spectrogram_generation_);
 
-    if (post_control_->getGainShiftEnabled()) {
-        frame_postprocessor_.shiftGain(post_control_->getGainShift());
-    }
-
-    synthesizer_.synthesize(frame_table_);
+    emit inputSpectrogramRequested(input_job);
+    emit lpcSpectrogramRequested(lpc_job);
 }
 
 void MainWindow::importBitstream(const std::string &path) {
@@ -587,25 +627,4 @@ void MainWindow::exportBitstream(const std::string& path) {
     }
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// Helper Methods /////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-
-int MainWindow::samplesChecksum(std::vector<float> samples) {
-    auto buffer_size = samples.size();
-
-    auto checksum_buffer = new float[buffer_size + 1];
-    memccpy(checksum_buffer, samples.data(), buffer_size, sizeof(float));
-
-    checksum_buffer[buffer_size] =
-        static_cast<char>(lpc_control_->getPreEmphasisAlpha() +
-        pitch_control_->getPreEmphasisAlpha());
-
-    auto checksum = CRC::Calculate(checksum_buffer, sizeof(float),
-        CRC::CRC_32());
-
-    delete[] checksum_buffer;
-    return checksum;
-}
-
 };  // namespace tms_express::ui
@@ -7,28 +7,27 @@
 #include <QGroupBox>
 #include <QHBoxLayout>
 #include <QMainWindow>
-#include <QMediaPlayer>
 #include <QMenuBar>
+#include <QThread>
 #include <QVBoxLayout>
 
-#include <QtMultimedia/QAudioOutput>
-
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "audio/AudioBuffer.hpp"
-#include "audio/AudioFilter.hpp"
 #include "bitstream/BitstreamGenerator.hpp"
 #include "encoding/Frame.hpp"
 #include "encoding/FrameEncoder.hpp"
-#include "encoding/FramePostprocessor.hpp"
 #include "encoding/Synthesizer.hpp"
-#include "analysis/PitchEstimator.hpp"
-#include "analysis/LinearPredictor.hpp"
+#include "ui/gui/AnalysisWorker.hpp"
+#include "ui/gui/AudioPlayer.hpp"
+#include "ui/gui/SpectrogramWorker.hpp"
 #include "ui/gui/audiowaveform/AudioWaveformView.hpp"
 #include "ui/gui/controlpanels/ControlPanelPitchView.hpp"
 #include "ui/gui/controlpanels/ControlPanelLpcView.hpp"
 #include "ui/gui/controlpanels/ControlPanelPostView.hpp"
+#include "ui/gui/spectrogram/SpectrogramView.hpp"
 
 #define TE_WINDOW_MIN_WIDTH    1000
 #define TE_WINDOW_MIN_HEIGHT   800
@@ -50,6 +49,9 @@ class MainWindow : public QMainWindow {
     /// @param parent Parent Qt widget
     explicit MainWindow(QWidget *parent = nullptr);
 
+    /// @brief Abandons any analysis in progress and stops the worker thread
+    ~MainWindow() override;
+
  public slots:
     ///////////////////////////////////////////////////////////////////////////
     // Qt Slots ///////////////////////////////////////////////////////////////
@@ -80,6 +82,27 @@ class MainWindow : public QMainWindow {
     /// @brief Triggers post-processing
     void onPostProcEdit();
 
+    /// @brief Displays the results of the latest analysis job
+    /// @param result Results, which are ignored if a newer job was requested
+    ///                 after the job which produced them
+    void onAnalysisFinished(
+        std::shared_ptr<const tms_express::ui::AnalysisResult> result);
+
+ signals:
+    ///////////////////////////////////////////////////////////////////////////
+    // Qt Signals /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Qt signal which posts a job to the Analysis Worker's thread
+    void analysisRequested(tms_express::ui::AnalysisJob job);
+
+    /// @brief Qt signal which posts a job to the input Spectrogram Worker
+    void inputSpectrogramRequested(tms_express::ui::SpectrogramJob job);
+
+    /// @brief Qt signal which posts a job to the synthesized Spectrogram
+    ///         Worker
+    void lpcSpectrogramRequested(tms_express::ui::SpectrogramJob job);
+
  private:
     ///////////////////////////////////////////////////////////////////////////
     // UI Helper Methods //////////////////////////////////////////////////////
@@ -93,27 +116,30 @@ class MainWindow : public QMainWindow {
     ///         and Waveform Views
     void configureUiState();
 
-    /// @brief Re-draws Waveform View plots
+    /// @brief Re-draws synthesized Waveform View plot
     void drawPlots();
 
     ///////////////////////////////////////////////////////////////////////////
     // LPC Routines ///////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
 
-    /// @brief Applies pre-processing to audio buffer and perform pitch analysis
-    ///         to populate pitch curve table
-    void performPitchAnalysis();
+    /// @brief Captures the Control Panel settings which affect analysis
+    /// @return Snapshot of settings
+    AnalysisParameters snapshotParameters() const;
 
-    /// @brief Applies pre-processing to LPC buffer and perform LPC analysis
-    ///         to populate Frame table
-    /// @note This function may trigger a call to
-    ///         MainWindow::performPitchAnalysis() if the analysis/segmentation
-    ///         window width has been changed since pitch analysis was last
-    ///         performed
-    void performLpcAnalysis();
+    /// @brief Posts an analysis job to the worker thread, superseding any job
+    ///         which is queued or in progress
+    /// @param source New input audio, or nullptr to keep the previous input
+    /// @param imported_frames Imported Frame table, or nullptr if not
+    ///                         applicable
+    void requestAnalysis(std::shared_ptr<const AudioBuffer> source = nullptr,
+        std::shared_ptr<const std::vector<Frame>> imported_frames = nullptr);
 
-    /// @brief Applies post-processing to Frame table
-    void performPostProc();
+    /// @brief Posts spectrogram jobs for the input and synthesized audio,
+    ///         superseding any which are queued or in progress
+    /// @param input_changed true if the input samples have changed since the
+    ///                         last request
+    void requestSpectrograms(bool input_changed);
 
     ///////////////////////////////////////////////////////////////////////////
     // Bitstream I/O //////////////////////////////////////////////////////////
@@ -127,21 +153,6 @@ class MainWindow : public QMainWindow {
     /// @param path Path to new bitstream file
     void exportBitstream(const std::string& path);
 
-    ///////////////////////////////////////////////////////////////////////////
-    // Helper Methods /////////////////////////////////////////////////////////
-    ///////////////////////////////////////////////////////////////////////////
-
-    /// @brief Computes checksum of vector of floating-point samples
-    /// @param samples Samples to uniquely identify via checksum
-    /// @return Checksum of vector
-    /// @details The checksum is used to generate a unique filename, which is
-    ///             stored temporarily to facilitate playback of audio. In
-    ///             addition to the samples from the vector, this checksum also
-    ///             incorporates the pre-emphasis filter_ coefficients of both
-    ///             the audio and LPC buffers, as applying the pre-emphasis
-    ///             filter_ to floating point samples may not impact the checksum
-    int samplesChecksum(std::vector<float> samples);
-
     ///////////////////////////////////////////////////////////////////////////
     // Qt Layout Members //////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
@@ -164,8 +175,7 @@ class MainWindow : public QMainWindow {
     // Qt Multimedia Members //////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
 
-    QMediaPlayer *player;
-    QAudioOutput *audio_output_;
+    AudioPlayer *audio_player_;
 
     ///////////////////////////////////////////////////////////////////////////
     // Control Panel View Members /////////////////////////////////////////////
@@ -181,29 +191,62 @@ class MainWindow : public QMainWindow {
     AudioWaveformView *input_waveform_;
     AudioWaveformView *lpc_waveform_;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Spectrogram View Members ///////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    SpectrogramView *input_spectrogram_;
+    SpectrogramView *lpc_spectrogram_;
+
     ///////////////////////////////////////////////////////////////////////////
     // Audio Buffer Members ///////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Input audio, as filtered for pitch analysis once analyzed
     AudioBuffer input_buffer_;
-    AudioBuffer lpc_buffer_;
+
+    /// @brief Audio synthesized from the Frame table
+    std::vector<float> lpc_samples_;
 
     ///////////////////////////////////////////////////////////////////////////
     // Data Tables ////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
 
     std::vector<Frame> frame_table_;
-    std::vector<int> pitch_period_table_;
-    std::vector<float> pitch_curve_table_;
+
+    /// @brief Highest pitch representable by the pitch estimator, in Hertz
+    int max_pitch_hz_;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Analysis Worker Members ////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Thread on which the Analysis Worker runs
+    QThread analysis_thread_;
+
+    /// @brief Analysis Worker, which is owned by its thread
+    AnalysisWorker *analysis_worker_;
+
+    /// @brief Generation of the latest analysis job
+    int analysis_generation_;
 
     ///////////////////////////////////////////////////////////////////////////
-    // LPC Analysis Object Members ////////////////////////////////////////////
+    // Spectrogram Worker Members /////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
 
-    Synthesizer synthesizer_ = Synthesizer();
-    AudioFilter filter_ = AudioFilter();
-    PitchEstimator pitch_estimator_ = PitchEstimator(TE_AUDIO_SAMPLE_RATE);
-    LinearPredictor linear_predictor_ = LinearPredictor();
-    FramePostprocessor frame_postprocessor_ = FramePostprocessor(&frame_table_);
+    /// @brief Thread on which both Spectrogram Workers run, apart from
+    ///         analysis such that neither delays the other
+    QThread spectrogram_thread_;
+
+    /// @brief Spectrogram Worker of the input audio, owned by its thread
+    SpectrogramWorker *input_spectrogram_worker_;
+
+    /// @brief Spectrogram Worker of the synthesized audio, owned by its
+    ///         thread
+    SpectrogramWorker *lpc_spectrogram_worker_;
+
+    /// @brief Generation of the latest spectrogram jobs
+    int spectrogram_generation_;
 };
 
 };  // namespace tms_express::ui
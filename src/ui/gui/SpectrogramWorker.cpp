@@ -0,0 +1,218 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "ui/gui/SpectrogramWorker.hpp"
+
+#include <QColor>
+#include <QImage>
+#include <QObject>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "analysis/Spectrogram.hpp"
+#include "analysis/Spectrum.hpp"
+
+namespace tms_express::ui {
+
+/// @brief Number of samples in each analyzed segment, which resolves
+///         31.25 Hz at 8 kHz
+static constexpr int kSegmentSize = 256;
+
+/// @brief Number of samples between columns (8 ms at 8 kHz)
+static constexpr int kHopSize = 64;
+
+/// @brief Number of columns in each tile, and hence in each posted image
+static constexpr int kTileWidth = 256;
+
+/// @brief Level mapped to the darkest color, in decibels relative to a
+///         full-scale sinusoid
+static constexpr float kFloorDb = -90.0f;
+
+///////////////////////////////////////////////////////////////////////////////
+// Static Helpers /////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+/// @brief Accesses the colormap which maps levels to colors, from dark purple
+///         through orange to pale yellow
+/// @return 256 colors, from quietest to loudest
+static const std::array<QRgb, 256> &colormap() {
+    static const auto colors = []() {
+        // Stops of a piecewise-linear gradient, as (position, r, g, b)
+        constexpr float kStops[][4] = {
+            {0.00f, 0.0f, 0.0f, 4.0f},
+            {0.35f, 84.0f, 18.0f, 123.0f},
+            {0.70f, 229.0f, 80.0f, 57.0f},
+            {1.00f, 252.0f, 253.0f, 191.0f}
+        };
+
+        auto table = std::array<QRgb, 256>();
+
+        for (int i = 0; i < 256; i++) {
+            auto position = static_cast<float>(i) / 255.0f;
+
+            auto stop = 1;
+            while (stop < 3 && kStops[stop][0] < position) {
+                stop++;
+            }
+
+            auto &lower = kStops[stop - 1];
+            auto &upper = kStops[stop];
+            auto t = (position - lower[0]) / (upper[0] - lower[0]);
+
+            auto channel = [&lower, &upper, t](int j) {
+                return static_cast<int>(lower[j] + t * (upper[j] - lower[j]));
+            };
+
+            table[i] = qRgb(channel(1), channel(2), channel(3));
+        }
+
+        return table;
+    }();
+
+    return colors;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+SpectrogramWorker::SpectrogramWorker(QObject *parent): QObject(parent),
+    spectrogram_(kSegmentSize, kHopSize, kTileWidth),
+    envelope_spectrum_(kSegmentSize) {
+    //
+    latest_generation_ = 0;
+    is_posted_ = {};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Cancellation ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SpectrogramWorker::supersede(int generation) {
+    latest_generation_.store(generation, std::memory_order_release);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Qt Slots ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SpectrogramWorker::compute(SpectrogramJob job) {
+    // Samples are taken even from superseded jobs, as the jobs which
+    // supersede them carry samples only when the samples change. Comparing
+    // them against the cached tiles is cheap relative to rendering
+    if (job.samples != nullptr) {
+        auto n_columns = spectrogram_.getNColumns();
+        spectrogram_.setSamples(*job.samples);
+
+        // If the dimensions are unchanged, the UI thread keeps its image, and
+        // only those tiles which were invalidated are posted
+        if (spectrogram_.getNColumns() != n_columns || is_posted_.empty()) {
+            is_posted_.assign(spectrogram_.getNTiles(), false);
+
+            emit spectrogramResized(job.generation,
+                spectrogram_.getNColumns(), spectrogram_.getNBins());
+
+        } else {
+            for (int t = 0; t < spectrogram_.getNTiles(); t++) {
+                is_posted_[t] = is_posted_[t] && spectrogram_.isTileCached(t);
+            }
+        }
+    }
+
+    if (isSuperseded(job)) {
+        return;
+    }
+
+    // The overlay is cheap relative to the spectrogram, so it is posted first
+    emit overlayReady(computeOverlay(job));
+
+    for (int t = 0; t < spectrogram_.getNTiles(); t++) {
+        if (is_posted_[t]) {
+            continue;
+        }
+
+        if (isSuperseded(job)) {
+            return;
+        }
+
+        emit tileReady(job.generation, t * spectrogram_.getTileWidth(),
+            renderTile(t));
+
+        is_posted_[t] = true;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers ////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+bool SpectrogramWorker::isSuperseded(const SpectrogramJob &job) const {
+    return latest_generation_.load(std::memory_order_acquire) !=
+        job.generation;
+}
+
+std::shared_ptr<SpectrogramOverlay> SpectrogramWorker::computeOverlay(
+    const SpectrogramJob &job) const {
+    //
+    auto overlay = std::make_shared<SpectrogramOverlay>();
+    overlay->generation = job.generation;
+    overlay->columns_per_frame = static_cast<float>(job.n_samples_per_frame) /
+        static_cast<float>(spectrogram_.getHopSize());
+
+    if (job.frames == nullptr) {
+        return overlay;
+    }
+
+    auto n_bins = envelope_spectrum_.getNBins();
+    auto envelope_db = std::vector<float>(n_bins);
+
+    overlay->formants.resize(job.frames->size());
+
+    for (int i = 0; i < static_cast<int>(job.frames->size()); i++) {
+        auto &frame = job.frames->at(i);
+
+        if (frame.isSilent()) {
+            continue;
+        }
+
+        envelope_spectrum_.lpcEnvelope(frame.getCoeffs(), envelope_db.data());
+
+        for (auto bin : Spectrogram::findPeaks(envelope_db.data(), n_bins)) {
+            overlay->formants[i].push_back(static_cast<float>(bin) /
+                static_cast<float>(n_bins - 1));
+        }
+    }
+
+    return overlay;
+}
+
+QImage SpectrogramWorker::renderTile(int tile) {
+    auto &levels = spectrogram_.getTile(tile);
+    auto &colors = colormap();
+
+    auto n_bins = spectrogram_.getNBins();
+    auto n_columns = static_cast<int>(levels.size()) / n_bins;
+
+    auto image = QImage(n_columns, n_bins, QImage::Format_RGB32);
+
+    for (int y = 0; y < n_bins; y++) {
+        auto row = reinterpret_cast<QRgb *>(image.scanLine(y));
+        auto bin = n_bins - 1 - y;
+
+        for (int x = 0; x < n_columns; x++) {
+            auto level = levels[x * n_bins + bin];
+            auto index = static_cast<int>(255.0f * (level - kFloorDb) /
+                -kFloorDb);
+
+            row[x] = colors[std::clamp(index, 0, 255)];
+        }
+    }
+
+    return image;
+}
+
+};  // namespace tms_express::ui
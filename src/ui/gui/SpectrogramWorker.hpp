@@ -0,0 +1,167 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_USER_INTERFACES_SPECTROGRAMWORKER_HPP_
+#define TMS_EXPRESS_USER_INTERFACES_SPECTROGRAMWORKER_HPP_
+
+#include <QImage>
+#include <QObject>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "analysis/Spectrogram.hpp"
+#include "analysis/Spectrum.hpp"
+#include "encoding/Frame.hpp"
+
+namespace tms_express::ui {
+
+///////////////////////////////////////////////////////////////////////////////
+// Structures /////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+/// @brief Request for the Spectrogram Worker to bring its images up to date
+struct SpectrogramJob {
+    /// @brief Position of the job in the sequence of requests, such that a
+    ///         job is superseded by any job with a greater generation
+    int generation = 0;
+
+    /// @brief New samples, or nullptr to keep the previous samples
+    std::shared_ptr<const std::vector<float>> samples;
+
+    /// @brief Frame table whose LPC envelopes are overlaid, or nullptr if
+    ///         there is none
+    std::shared_ptr<const std::vector<Frame>> frames;
+
+    /// @brief Number of samples spanned by each Frame
+    int n_samples_per_frame = 200;
+};
+
+/// @brief Formants of each Frame's LPC envelope, positioned in spectrogram
+///         coordinates
+struct SpectrogramOverlay {
+    /// @brief Generation of the job which produced the overlay
+    int generation = 0;
+
+    /// @brief Number of spectrogram columns spanned by each Frame
+    float columns_per_frame = 0.0f;
+
+    /// @brief Peak frequencies of each Frame's envelope, as fractions of the
+    ///         Nyquist frequency. Silent Frames have no peaks
+    std::vector<std::vector<float>> formants;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Spectrogram Worker /////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+/// @brief Computes and renders a spectrogram on a background thread
+/// @details The spectrogram is computed one tile at a time, and each tile is
+///             posted to the UI thread as an image as soon as it is rendered,
+///             such that long signals appear progressively rather than after
+///             a stall. Tiles whose samples are unchanged since they were last
+///             posted are neither recomputed nor re-posted. Jobs are
+///             superseded in the same manner as those of the Analysis Worker,
+///             in which case the job in progress is abandoned between tiles
+class SpectrogramWorker : public QObject {
+    Q_OBJECT
+
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new Spectrogram Worker
+    /// @param parent Parent Qt object, which must be nullptr if the worker is
+    ///                 to be moved to another thread
+    explicit SpectrogramWorker(QObject *parent = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Cancellation ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Marks every job older than the given generation as superseded
+    /// @param generation Generation of the newest job
+    /// @note This function is thread-safe, and is intended to be called from
+    ///         the UI thread
+    void supersede(int generation);
+
+ public slots:
+    ///////////////////////////////////////////////////////////////////////////
+    // Qt Slots ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Performs a job, unless it has been superseded
+    /// @param job Job to perform
+    void compute(tms_express::ui::SpectrogramJob job);
+
+ signals:
+    ///////////////////////////////////////////////////////////////////////////
+    // Qt Signals /////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Qt signal which announces that the spectrogram's dimensions
+    ///         have changed, such that every tile will be posted anew
+    /// @param generation Generation of the job which changed the dimensions
+    /// @param n_columns Number of columns
+    /// @param n_bins Number of frequency bins in each column
+    void spectrogramResized(int generation, int n_columns, int n_bins);
+
+    /// @brief Qt signal which delivers a rendered tile
+    /// @param generation Generation of the job which rendered the tile
+    /// @param first_column Index of the tile's first column
+    /// @param tile Image of the tile, one pixel per column and bin, with
+    ///             the Nyquist frequency at the top
+    void tileReady(int generation, int first_column, QImage tile);
+
+    /// @brief Qt signal which delivers the LPC envelope overlay
+    void overlayReady(
+        std::shared_ptr<const tms_express::ui::SpectrogramOverlay> overlay);
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Checks whether a job has been superseded
+    /// @param job Job being performed
+    /// @return true if a newer job has been announced, false otherwise
+    bool isSuperseded(const SpectrogramJob &job) const;
+
+    /// @brief Finds the formants of each Frame's LPC envelope
+    /// @param job Job being performed
+    /// @return Overlay
+    std::shared_ptr<SpectrogramOverlay> computeOverlay(
+        const SpectrogramJob &job) const;
+
+    /// @brief Renders a tile as an image
+    /// @param tile Tile index
+    /// @return Image of the tile
+    QImage renderTile(int tile);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Generation of the newest job announced by the UI thread
+    std::atomic<int> latest_generation_;
+
+    /// @brief Cached, tiled short-time Fourier transform
+    Spectrogram spectrogram_;
+
+    /// @brief Transform of LPC envelopes, which matches the resolution of
+    ///         the spectrogram
+    Spectrum envelope_spectrum_;
+
+    /// @brief true for each tile which has been posted to the UI thread since
+    ///         it was last computed
+    std::vector<bool> is_posted_;
+};
+
+};  // namespace tms_express::ui
+
+Q_DECLARE_METATYPE(tms_express::ui::SpectrogramJob)
+Q_DECLARE_METATYPE(
+    std::shared_ptr<const tms_express::ui::SpectrogramOverlay>)
+
+#endif  // TMS_EXPRESS_USER_INTERFACES_SPECTROGRAMWORKER_HPP_
@@ -4,10 +4,16 @@
 
 #include <QWidget>
 #include <QPainter>
+#include <QPainterPath>
+#include <QPolygonF>
 
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "audio/PeakPyramid.hpp"
+
 namespace tms_express::ui {
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21,7 +27,7 @@ AudioWaveform::AudioWaveform(QWidget *parent) : QWidget(parent) {
     setAutoFillBackground(true);
     setPalette(pal);
 
-    samples_ = {};
+    peaks_ = PeakPyramid();
     pitch_curve_ = {};
 }
 
@@ -29,15 +35,15 @@ AudioWaveform::AudioWaveform(QWidget *parent) : QWidget(parent) {
 // Accessors //////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
-void AudioWaveform::setSamples(const std::vector<float>& samples) {
-    samples_ = samples;
-    repaint();
+void AudioWaveform::setSamples(std::vector<float> samples) {
+    peaks_.setSamples(std::move(samples));
+    update();
 }
 
 /// Plot pitch table corresponding to audio samples
 void AudioWaveform::setPitchCurve(const std::vector<float>& pitch_curve) {
     pitch_curve_ = pitch_curve;
-    repaint();
+    update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -56,20 +62,48 @@ void AudioWaveform::paintEvent([[maybe_unused]] QPaintEvent * event) {
     painter.setPen(Qt::darkGray);
     painter.drawLine(0, origin, width, origin);
 
+    const auto n_samples = peaks_.getNSamples();
+
     // Plot samples
-    if (!samples_.empty()) {
+    //
+    // Once there are more samples than pixel columns, each column is drawn as
+    // a single vertical span from the least to the greatest of its samples,
+    // as read from the peak pyramid. Either way, the plot is drawn with a
+    // single call, with at most one line or span per column
+    if (n_samples > 0 && width > 0) {
         painter.setPen(QColor(255, 128, 0));
-        const float spacing = static_cast<float>(width) /
-            static_cast<float>(samples_.size());
 
-        for (int i = 0; i < static_cast<int>(samples_.size()) - 1; i++) {
-            float x_1 = static_cast<float>(i) * spacing;
-            float y_1 = origin + (samples_[i] * origin);
+        if (n_samples <= width) {
+            const auto &samples = peaks_.getSamples();
+            const float spacing = static_cast<float>(width) /
+                static_cast<float>(n_samples);
+
+            auto polyline = QPolygonF();
+            polyline.reserve(n_samples);
+
+            for (int i = 0; i < n_samples; i++) {
+                polyline.append(QPointF(static_cast<float>(i) * spacing,
+                    origin + (samples[i] * origin)));
+            }
+
+            painter.drawPolyline(polyline);
 
-            float x_2 = static_cast<float>(i + 1) * spacing;
-            float y_2 = origin + (samples_[i + 1] * origin);
+        } else {
+            auto path = QPainterPath();
+            auto peaks = peaks_.query(width);
 
-            painter.drawLine(x_1, y_1, x_2, y_2);
+            for (int x = 0; x < width; x++) {
+                const auto &peak = peaks[x];
+                auto y_1 = origin + (peak.min * origin);
+                auto y_2 = origin + (peak.max * origin);
+
+                // Flat columns are stretched to a single pixel, lest they
+                // vanish
+                path.moveTo(x + 0.5f, y_1);
+                path.lineTo(x + 0.5f, std::max(y_2, y_1 + 1.0f));
+            }
+
+            painter.drawPath(path);
         }
     }
 
@@ -79,15 +113,15 @@ void AudioWaveform::paintEvent([[maybe_unused]] QPaintEvent * event) {
         const float spacing = static_cast<float>(width) /
             static_cast<float>(pitch_curve_.size());
 
-        for (int i = 0; i < static_cast<int>(pitch_curve_.size()); i++) {
-            float x_1 = static_cast<float>(i) * spacing;
-            float y_1 = height - (pitch_curve_[i] * origin);
-
-            float x_2 = static_cast<float>(i + 1) * spacing;
-            float y_2 = height - (pitch_curve_[i + 1] * origin);
+        auto polyline = QPolygonF();
+        polyline.reserve(static_cast<int>(pitch_curve_.size()));
 
-            painter.drawLine(x_1, y_1, x_2, y_2);
+        for (int i = 0; i < static_cast<int>(pitch_curve_.size()); i++) {
+            polyline.append(QPointF(static_cast<float>(i) * spacing,
+                height - (pitch_curve_[i] * origin)));
         }
+
+        painter.drawPolyline(polyline);
     }
 }
 
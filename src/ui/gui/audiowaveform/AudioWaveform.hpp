@@ -7,6 +7,8 @@
 
 #include <vector>
 
+#include "audio/PeakPyramid.hpp"
+
 namespace tms_express::ui {
 
 /// @brief Time-domain plot of audio samples and pitch
@@ -26,11 +28,15 @@ class AudioWaveform : public QWidget {
     // Accessors //////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
 
-     /// @brief Replaces existing samples and repaints plot
-    /// @param _samples New samples
-    void setSamples(const std::vector<float>& samples);
+    /// @brief Replaces existing samples and schedules a repaint of the plot
+    /// @param samples New samples, which are moved into the plot
+    /// @note The peak pyramid is rebuilt here, once, such that repaints take
+    ///         time proportional to the width of the plot rather than the
+    ///         number of samples
+    void setSamples(std::vector<float> samples);
 
-    /// @brief Replaces existing pitch curve and re-paints plot
+    /// @brief Replaces existing pitch curve and schedules a repaint of the
+    ///         plot
     /// @param pitch_curve New pitch table
     void setPitchCurve(const std::vector<float>& pitch_curve);
 
@@ -52,8 +58,8 @@ class AudioWaveform : public QWidget {
     /// @brief Time-domain pitch curve, corresponding to frequency, in Hertz
     std::vector<float> pitch_curve_;
 
-    /// @brief Time-domain audio samples
-    std::vector<float> samples_;
+    /// @brief Time-domain audio samples, summarized at every resolution
+    PeakPyramid peaks_;
 };
 
 };  // namespace tms_express::ui
@@ -7,6 +7,9 @@
 #include <QLayout>
 #include <QPushButton>
 
+#include <utility>
+#include <vector>
+
 #include "ui/gui/audiowaveform/AudioWaveform.hpp"
 
 namespace tms_express::ui {
@@ -50,8 +53,8 @@ AudioWaveformView::AudioWaveformView(std::string title, int base_width,
 // Accessors //////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-void AudioWaveformView::setSamples(const std::vector<float> &samples) {
-    waveform->setSamples(samples);
+void AudioWaveformView::setSamples(std::vector<float> samples) {
+    waveform->setSamples(std::move(samples));
 }
 
 void AudioWaveformView::setPitchCurve(const std::vector<float> &pitch_curve) {
@@ -36,8 +36,8 @@ class AudioWaveformView: public QWidget {
     // Accessors //////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
 
-    /// @copydoc AudioWaveform::setSamples(const std::vector<float>&)
-    void setSamples(const std::vector<float> &samples);
+    /// @copydoc AudioWaveform::setSamples(std::vector<float>)
+    void setSamples(std::vector<float> samples);
 
     /// @copydoc  AudioWaveform::setPitchCurve(const std::vector<float>&);
     void setPitchCurve(const std::vector<float> &pitchTable);
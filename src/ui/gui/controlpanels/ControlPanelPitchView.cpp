@@ -38,6 +38,9 @@ ControlPanelPitchView::ControlPanelPitchView(QWidget *parent):
     auto minPitchLabel = new QLabel("Min pitch (Hz)", this);
     min_pitch_frq_line_ = new QLineEdit("50", this);
 
+    yin_checkbox_ = new QCheckBox("YIN estimator (threshold)", this);
+    yin_threshold_line_ = new QLineEdit("0.1", this);
+
     // Construct layout
     auto row = grid->rowCount();
 
@@ -58,7 +61,10 @@ ControlPanelPitchView::ControlPanelPitchView(QWidget *parent):
     grid->addWidget(max_pitch_frq_line_, row++, 1);
 
     grid->addWidget(minPitchLabel, row, 0);
-    grid->addWidget(min_pitch_frq_line_, row, 1);
+    grid->addWidget(min_pitch_frq_line_, row++, 1);
+
+    grid->addWidget(yin_checkbox_, row, 0);
+    grid->addWidget(yin_threshold_line_, row, 1);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -77,6 +83,9 @@ void ControlPanelPitchView::reset() {
 
     max_pitch_frq_line_->setText("500");
     min_pitch_frq_line_->setText("50");
+
+    yin_checkbox_->setChecked(false);
+    yin_threshold_line_->setText("0.1");
 }
 
 void ControlPanelPitchView::configureSlots() {
@@ -103,6 +112,12 @@ void ControlPanelPitchView::configureSlots() {
 
     connect(min_pitch_frq_line_, &QLineEdit::editingFinished, this,
         &ControlPanelView::stateChanged);
+
+    connect(yin_checkbox_, &QCheckBox::released, this,
+        &ControlPanelView::stateChanged);
+
+    connect(yin_threshold_line_, &QLineEdit::editingFinished, this,
+        &ControlPanelView::stateChanged);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -141,4 +156,12 @@ int ControlPanelPitchView::getMinPitchFrq() {
     return min_pitch_frq_line_->text().toInt();
 }
 
+bool ControlPanelPitchView::getYinEnabled() {
+    return yin_checkbox_->isChecked();
+}
+
+float ControlPanelPitchView::getYinThreshold() {
+    return yin_threshold_line_->text().toFloat();
+}
+
 };  // namespace tms_express::ui
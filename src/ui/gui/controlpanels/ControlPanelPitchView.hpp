@@ -75,6 +75,15 @@ class ControlPanelPitchView: public ControlPanelView {
     /// @return Min pitch frequency, in Hertz
     int getMinPitchFrq();
 
+    /// @brief Checks if the YIN estimator should be used for pitch analysis
+    /// @return true if YIN estimator should be used, false for the
+    ///         autocorrelation-based estimator
+    bool getYinEnabled();
+
+    /// @brief Accesses YIN estimator absolute threshold
+    /// @return YIN normalized difference threshold
+    float getYinThreshold();
+
  private:
     ///////////////////////////////////////////////////////////////////////////
     // Members ////////////////////////////////////////////////////////////////
@@ -91,6 +100,9 @@ class ControlPanelPitchView: public ControlPanelView {
 
     QLineEdit *max_pitch_frq_line_;
     QLineEdit *min_pitch_frq_line_;
+
+    QCheckBox *yin_checkbox_;
+    QLineEdit *yin_threshold_line_;
 };
 
 };  // namespace tms_express::ui
@@ -0,0 +1,144 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include "ui/gui/spectrogram/SpectrogramView.hpp"
+
+#include <QImage>
+#include <QPainter>
+#include <QPolygonF>
+#include <QWidget>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "ui/gui/SpectrogramWorker.hpp"
+
+namespace tms_express::ui {
+
+///////////////////////////////////////////////////////////////////////////////
+// Initializers ///////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+SpectrogramView::SpectrogramView(QWidget *parent) : QWidget(parent) {
+    // Set the plot background to true black, which is also the color of
+    // silence in the spectrogram
+    QPalette pal = QPalette();
+    pal.setColor(QPalette::Window, Qt::black);
+    setAutoFillBackground(true);
+    setPalette(pal);
+
+    canvas_ = QImage();
+    display_ = QImage();
+    canvas_generation_ = 0;
+    overlay_ = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Qt Slots ///////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SpectrogramView::onSpectrogramResized(int generation, int n_columns,
+    int n_bins) {
+    //
+    canvas_generation_ = generation;
+    display_ = QImage();
+
+    if (n_columns == 0) {
+        canvas_ = QImage();
+
+    } else {
+        canvas_ = QImage(n_columns, n_bins, QImage::Format_RGB32);
+        canvas_.fill(Qt::black);
+    }
+
+    update();
+}
+
+void SpectrogramView::onTileReady(int generation, int first_column,
+    QImage tile) {
+    //
+    // Tiles rendered before the canvas was resized belong to a signal of
+    // different length, whereas later tiles are valid even if superseded, as
+    // any tile which has since changed is re-posted after them
+    if (generation < canvas_generation_ || canvas_.isNull()) {
+        return;
+    }
+
+    QPainter canvas_painter(&canvas_);
+    canvas_painter.drawImage(first_column, 0, tile);
+
+    // The scaled copy is patched in place, rather than rebuilt, such that
+    // each tile costs time proportional to its own size
+    if (!display_.isNull()) {
+        auto scale = static_cast<qreal>(display_.width()) /
+            static_cast<qreal>(canvas_.width());
+
+        auto target = QRectF(first_column * scale, 0.0, tile.width() * scale,
+            display_.height());
+
+        QPainter display_painter(&display_);
+        display_painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        display_painter.drawImage(target, tile);
+    }
+
+    update();
+}
+
+void SpectrogramView::onOverlayReady(
+    std::shared_ptr<const SpectrogramOverlay> overlay) {
+    //
+    overlay_ = std::move(overlay);
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Qt Widget Helpers //////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void SpectrogramView::paintEvent([[maybe_unused]] QPaintEvent *event) {
+    const auto width = QWidget::width();
+    const auto height = QWidget::height();
+
+    if (canvas_.isNull() || width <= 0 || height <= 0) {
+        return;
+    }
+
+    if (display_.size() != size()) {
+        display_ = canvas_.scaled(size(), Qt::IgnoreAspectRatio,
+            Qt::SmoothTransformation);
+    }
+
+    QPainter painter(this);
+    painter.drawImage(0, 0, display_);
+
+    if (overlay_ == nullptr || overlay_->formants.empty()) {
+        return;
+    }
+
+    // Plot the formants of each Frame's LPC envelope atop the spectrogram.
+    // Once there are more Frames than pixel columns, Frames are skipped such
+    // that at most one is plotted per column
+    const auto &formants = overlay_->formants;
+    const auto n_frames = static_cast<int>(formants.size());
+    const auto stride = std::max(1, n_frames / width);
+
+    const auto column_width = static_cast<float>(width) /
+        static_cast<float>(canvas_.width());
+
+    auto points = QPolygonF();
+
+    for (int i = 0; i < n_frames; i += stride) {
+        auto x = (static_cast<float>(i) + 0.5f) * overlay_->columns_per_frame *
+            column_width;
+
+        for (auto formant : formants[i]) {
+            points.append(QPointF(x, (1.0f - formant) *
+                static_cast<float>(height)));
+        }
+    }
+
+    painter.setPen(QPen(QColor(0, 255, 160), 2.0));
+    painter.drawPoints(points);
+}
+
+};  // namespace tms_express::ui
@@ -0,0 +1,88 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_USER_INTERFACES_SPECTROGRAM_SPECTROGRAMVIEW_HPP_
+#define TMS_EXPRESS_USER_INTERFACES_SPECTROGRAM_SPECTROGRAMVIEW_HPP_
+
+#include <QImage>
+#include <QWidget>
+
+#include <memory>
+
+#include "ui/gui/SpectrogramWorker.hpp"
+
+namespace tms_express::ui {
+
+/// @brief Time-frequency plot of audio, with the formants of each Frame's
+///         LPC envelope overlaid
+/// @details Tiles rendered by a Spectrogram Worker are copied into a
+///             full-resolution canvas, and into a copy of the canvas scaled
+///             to the widget, as they arrive. Repaints merely draw the scaled
+///             copy, which is rebuilt from the canvas only when the widget is
+///             resized, such that painting never depends on the length of
+///             the audio
+class SpectrogramView : public QWidget {
+    Q_OBJECT
+
+ public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initializers ///////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Creates a new, empty Spectrogram view
+    /// @param parent Parent Qt widget
+    explicit SpectrogramView(QWidget *parent = nullptr);
+
+ public slots:
+    ///////////////////////////////////////////////////////////////////////////
+    // Qt Slots ///////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Clears the plot and prepares a canvas of new dimensions
+    /// @param generation Generation of the job which changed the dimensions,
+    ///                     before which tiles are discarded
+    /// @param n_columns Number of columns
+    /// @param n_bins Number of frequency bins in each column
+    void onSpectrogramResized(int generation, int n_columns, int n_bins);
+
+    /// @brief Copies a tile into the plot and schedules a repaint
+    /// @param generation Generation of the job which rendered the tile
+    /// @param first_column Index of the tile's first column
+    /// @param tile Image of the tile
+    void onTileReady(int generation, int first_column, QImage tile);
+
+    /// @brief Replaces the LPC envelope overlay and schedules a repaint
+    /// @param overlay New overlay
+    void onOverlayReady(
+        std::shared_ptr<const tms_express::ui::SpectrogramOverlay> overlay);
+
+ protected:
+    ///////////////////////////////////////////////////////////////////////////
+    // Qt Widget Helpers //////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Re-paints widget
+    /// @note This function is invoked by Qt and should be called in
+    ///         application code
+    void paintEvent(QPaintEvent *event) override;
+
+ private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Members ////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// @brief Full-resolution image, one pixel per column and bin
+    QImage canvas_;
+
+    /// @brief Canvas, scaled to the size of the widget
+    QImage display_;
+
+    /// @brief Generation at which the canvas was last resized
+    int canvas_generation_;
+
+    /// @brief Formants of each Frame, or nullptr if there are none
+    std::shared_ptr<const SpectrogramOverlay> overlay_;
+};
+
+};  // namespace tms_express::ui
+
+#endif  // TMS_EXPRESS_USER_INTERFACES_SPECTROGRAM_SPECTROGRAMVIEW_HPP_
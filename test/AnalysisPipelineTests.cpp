@@ -0,0 +1,155 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "bitstream/AnalysisPipeline.hpp"
+
+namespace tms_express {
+
+/// @brief Produces test subject, which is one second of a vowel-like pulse
+///         train followed by one second of noise-like chirps
+/// @return Test subject
+AudioBuffer analysisPipelineTestSubject() {
+    auto samples = std::vector<float>(16000);
+
+    for (int i = 0; i < 8000; i++) {
+        auto t = static_cast<float>(i) / 8000.0f;
+        samples[i] = 0.5f * sinf(2.0f * M_PI * 120.0f * t) +
+            0.25f * sinf(2.0f * M_PI * 720.0f * t);
+    }
+
+    for (int i = 8000; i < 16000; i++) {
+        samples[i] = 0.1f * sinf(2.3f * static_cast<float>(i * i % 97));
+    }
+
+    return AudioBuffer(samples, 8000, 25.0f);
+}
+
+/// @brief Counts the computations of every stage
+/// @param pipeline Analysis Pipeline
+/// @return Number of computations of each stage
+std::vector<int> countComputations(const AnalysisPipeline &pipeline) {
+    auto counts = std::vector<int>();
+
+    for (int i = 0; i < AnalysisPipeline::STAGE_COUNT; i++) {
+        counts.push_back(pipeline.getNComputations(
+            static_cast<AnalysisPipeline::Stage>(i)));
+    }
+
+    return counts;
+}
+
+TEST(AnalysisPipelineTests, FirstRunComputesEveryStageOnce) {
+    auto pipeline = AnalysisPipeline();
+    pipeline.setSource(analysisPipelineTestSubject());
+
+    EXPECT_TRUE(pipeline.run(AnalysisParameters()));
+    EXPECT_EQ(countComputations(pipeline),
+        std::vector<int>(AnalysisPipeline::STAGE_COUNT, 1));
+
+    // 16000 samples are split into 80 windows of 25 ms
+    EXPECT_EQ(pipeline.getFrames().size(), 80);
+    EXPECT_FALSE(pipeline.getSynthesizedSamples().empty());
+
+    // A repeated run has nothing to do
+    EXPECT_TRUE(pipeline.run(AnalysisParameters()));
+    EXPECT_EQ(countComputations(pipeline),
+        std::vector<int>(AnalysisPipeline::STAGE_COUNT, 1));
+}
+
+TEST(AnalysisPipelineTests, PostProcessingEditSkipsAnalysis) {
+    auto pipeline = AnalysisPipeline();
+    pipeline.setSource(analysisPipelineTestSubject());
+
+    auto parameters = AnalysisParameters();
+    pipeline.run(parameters);
+    auto samples = pipeline.getSynthesizedSamples();
+
+    parameters.gain_shift_enabled = true;
+    parameters.gain_shift = 2;
+    EXPECT_TRUE(pipeline.run(parameters));
+
+    EXPECT_EQ(countComputations(pipeline),
+        std::vector<int>({1, 1, 1, 1, 1, 1, 1, 2, 2}));
+    EXPECT_NE(pipeline.getSynthesizedSamples(), samples);
+}
+
+TEST(AnalysisPipelineTests, WindowEditSkipsFilters) {
+    auto pipeline = AnalysisPipeline();
+    pipeline.setSource(analysisPipelineTestSubject());
+
+    auto parameters = AnalysisParameters();
+    pipeline.run(parameters);
+
+    parameters.window_width_ms = 20.0f;
+    EXPECT_TRUE(pipeline.run(parameters));
+
+    EXPECT_EQ(countComputations(pipeline),
+        std::vector<int>({1, 1, 2, 2, 2, 2, 2, 2, 2}));
+    EXPECT_EQ(pipeline.getFrames().size(), 100);
+}
+
+TEST(AnalysisPipelineTests, PitchFilterEditSkipsLpcAnalysis) {
+    auto pipeline = AnalysisPipeline();
+    pipeline.setSource(analysisPipelineTestSubject());
+
+    auto parameters = AnalysisParameters();
+    pipeline.run(parameters);
+
+    parameters.pitch_lpf_enabled = true;
+    parameters.pitch_lpf_cutoff_hz = 800;
+    EXPECT_TRUE(pipeline.run(parameters));
+
+    auto counts = countComputations(pipeline);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_PITCH_FILTER], 2);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_PITCH_ACF], 2);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_PITCH], 2);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_LPC_FILTER], 1);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_LPC_ACF], 1);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_LPC], 1);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_FRAMES], 2);
+}
+
+TEST(AnalysisPipelineTests, CancelledStageIsResumed) {
+    auto pipeline = AnalysisPipeline();
+    pipeline.setSource(analysisPipelineTestSubject());
+
+    // Cancel partway through the LPC autocorrelation, which begins after the
+    // pitch autocorrelation has polled once for each of its 80 segments
+    auto n_polls = 0;
+    auto is_cancelled = [&n_polls]() { return ++n_polls > 100; };
+
+    EXPECT_FALSE(pipeline.run(AnalysisParameters(), is_cancelled));
+    EXPECT_EQ(pipeline.getNComputations(AnalysisPipeline::STAGE_PITCH_ACF), 1);
+    EXPECT_EQ(pipeline.getNComputations(AnalysisPipeline::STAGE_LPC_ACF), 0);
+
+    // The next run resumes from the abandoned stage
+    EXPECT_TRUE(pipeline.run(AnalysisParameters()));
+    EXPECT_EQ(countComputations(pipeline),
+        std::vector<int>(AnalysisPipeline::STAGE_COUNT, 1));
+}
+
+TEST(AnalysisPipelineTests, ImportedFramesArePostProcessedOnly) {
+    auto analyzed = AnalysisPipeline();
+    analyzed.setSource(analysisPipelineTestSubject());
+    analyzed.run(AnalysisParameters());
+
+    auto pipeline = AnalysisPipeline();
+    pipeline.setFrames(analyzed.getFrames());
+    EXPECT_TRUE(pipeline.run(AnalysisParameters()));
+
+    auto counts = countComputations(pipeline);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_FRAMES], 0);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_POSTPROC], 1);
+    EXPECT_EQ(counts[AnalysisPipeline::STAGE_SYNTHESIS], 1);
+    EXPECT_EQ(pipeline.getFrames().size(), analyzed.getFrames().size());
+    EXPECT_EQ(pipeline.getSynthesizedSamples(),
+        analyzed.getSynthesizedSamples());
+    EXPECT_TRUE(pipeline.getFilteredSamples().empty());
+}
+
+};  // namespace tms_express
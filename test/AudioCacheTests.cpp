@@ -0,0 +1,182 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "analysis/ParallelFor.hpp"
+#include "audio/AudioBuffer.hpp"
+#include "audio/AudioCache.hpp"
+
+namespace tms_express {
+
+/// @brief Creates an empty temporary directory unique to the calling test
+/// @return Path to temporary directory
+std::filesystem::path audioCacheTestDirectory() {
+    auto test_name = std::string(
+        testing::UnitTest::GetInstance()->current_test_info()->name());
+
+    auto directory = std::filesystem::temp_directory_path() /
+        ("tmsexpress-audiocache-" + test_name);
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+/// @brief Renders test subject, which is half a second of a sine wave, to an
+///         audio file
+/// @param path Path to audio file
+/// @param frequency_hz Frequency of sine wave, in Hertz
+void renderAudioCacheTestSubject(const std::string &path,
+    float frequency_hz = 440.0f) {
+    //
+    auto samples = std::vector<float>();
+    for (int i = 0; i < 4000; i++) {
+        samples.push_back(0.5f * sinf(2.0f * static_cast<float>(M_PI) *
+            frequency_hz * static_cast<float>(i) / 8000.0f));
+    }
+
+    AudioBuffer(samples, 8000, 25.0f).render(path);
+}
+
+TEST(AudioCacheTests, SecondLoadIsServedFromCache) {
+    auto directory = audioCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    renderAudioCacheTestSubject(audio_path);
+
+    auto cache = AudioCache((directory / "cache").string());
+    auto first = cache.load(audio_path);
+    auto second = cache.load(audio_path);
+
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(cache.getMisses(), 1);
+    EXPECT_EQ(cache.getHits(), 1);
+    EXPECT_EQ(first->getSamples(), second->getSamples());
+    EXPECT_EQ(first->getNSegments(), second->getNSegments());
+}
+
+TEST(AudioCacheTests, CachedSamplesMatchDecodedSamples) {
+    auto directory = audioCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    renderAudioCacheTestSubject(audio_path);
+
+    auto decoded = AudioBuffer::Create(audio_path);
+
+    // A fresh cache instance must find the entry written by the first
+    auto cache_directory = (directory / "cache").string();
+    AudioCache(cache_directory).load(audio_path);
+
+    auto cache = AudioCache(cache_directory);
+    auto cached = cache.load(audio_path);
+
+    ASSERT_NE(decoded, nullptr);
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cache.getHits(), 1);
+    EXPECT_EQ(decoded->getSamples(), cached->getSamples());
+}
+
+TEST(AudioCacheTests, ModifiedFileMissesCache) {
+    auto directory = audioCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    auto cache = AudioCache((directory / "cache").string());
+
+    renderAudioCacheTestSubject(audio_path, 440.0f);
+    auto first = cache.load(audio_path);
+
+    renderAudioCacheTestSubject(audio_path, 220.0f);
+    auto second = cache.load(audio_path);
+
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(cache.getMisses(), 2);
+    EXPECT_NE(first->getSamples(), second->getSamples());
+}
+
+TEST(AudioCacheTests, DistinctSampleRatesAreCachedSeparately) {
+    auto directory = audioCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    renderAudioCacheTestSubject(audio_path);
+
+    auto cache = AudioCache((directory / "cache").string());
+    cache.load(audio_path, 8000);
+    auto buffer = cache.load(audio_path, 4000, 25.0f,
+        AudioBuffer::RESAMPLEQUALITY_POLYPHASE);
+
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(cache.getMisses(), 2);
+    EXPECT_EQ(buffer->getSampleRateHz(), 4000);
+}
+
+TEST(AudioCacheTests, MissingFileReturnsNullptr) {
+    auto directory = audioCacheTestDirectory();
+    auto cache = AudioCache((directory / "cache").string());
+
+    EXPECT_EQ(cache.load((directory / "missing.wav").string()), nullptr);
+    EXPECT_EQ(cache.getHits(), 0);
+}
+
+TEST(AudioCacheTests, ChecksumDependsOnContents) {
+    auto directory = audioCacheTestDirectory();
+    auto first_path = (directory / "first.wav").string();
+    auto second_path = (directory / "second.wav").string();
+
+    renderAudioCacheTestSubject(first_path, 440.0f);
+    renderAudioCacheTestSubject(second_path, 220.0f);
+
+    uint32_t first_checksum, second_checksum;
+    uint64_t first_size, second_size;
+
+    ASSERT_TRUE(AudioCache::checksumFile(first_path, first_checksum,
+        first_size));
+    ASSERT_TRUE(AudioCache::checksumFile(second_path, second_checksum,
+        second_size));
+
+    EXPECT_EQ(first_size, second_size);
+    EXPECT_NE(first_checksum, second_checksum);
+}
+
+TEST(AudioCacheTests, TempPathsAreUniqueAcrossThreads) {
+    auto paths = std::vector<std::string>(64);
+
+    ParallelFor(64, 8, [&](int i) {
+        paths[i] = AudioCache::makeTempPath("entry.f32");
+    });
+
+    EXPECT_EQ(std::set<std::string>(paths.begin(), paths.end()).size(), 64);
+}
+
+TEST(AudioCacheTests, ConcurrentMissesWriteOneEntry) {
+    auto directory = audioCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    auto cache_directory = directory / "cache";
+    renderAudioCacheTestSubject(audio_path);
+
+    auto n_loaded = std::vector<int>(8, 0);
+
+    ParallelFor(8, 8, [&](int i) {
+        auto buffer = AudioCache(cache_directory.string()).load(audio_path);
+        n_loaded[i] = (buffer != nullptr) ? 1 : 0;
+    });
+
+    EXPECT_EQ(n_loaded, std::vector<int>(8, 1));
+
+    // Every temporary file was renamed into place
+    auto n_entries = 0;
+    for (const auto &entry :
+        std::filesystem::directory_iterator(cache_directory)) {
+        //
+        EXPECT_EQ(entry.path().extension(), ".f32");
+        n_entries++;
+    }
+
+    EXPECT_EQ(n_entries, 1);
+}
+
+};  // namespace tms_express
@@ -45,4 +45,22 @@ TEST(AutocorrelatorTests, AutocorrelationHasLocalMaxAtOriginalSignalPeriod) {
     EXPECT_NEAR(period_idx, 50, 2);
 }
 
+TEST(AutocorrelatorTests, TruncatedAutocorrelationMatchesFullAutocorrelation) {
+    auto signal = std::vector<float>();
+    for (int i = 0; i < 200; i++) {
+        signal.push_back(cosf(2.0f * static_cast<float>(M_PI) *
+            static_cast<float>(i) / 50.0f));
+    }
+
+    auto full_acf = tms_express::Autocorrelation(signal);
+    auto truncated_acf = tms_express::Autocorrelation(signal, 80);
+
+    ASSERT_EQ(truncated_acf.size(), 80);
+    for (int i = 0; i < 80; i++) {
+        EXPECT_FLOAT_EQ(truncated_acf[i], full_acf[i]);
+        EXPECT_FLOAT_EQ(tms_express::AutocorrelationAtLag(signal, i),
+            full_acf[i]);
+    }
+}
+
 };  // namespace tms_express
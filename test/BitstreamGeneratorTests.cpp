@@ -0,0 +1,116 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bitstream/BitstreamGenerator.hpp"
+#include "encoding/Frame.hpp"
+#include "encoding/FrameEncoder.hpp"
+
+namespace tms_express {
+
+/// @brief Produces test subject, which is a vowel-like pulse train followed by
+///         noise, at the given sample rate
+/// @param sample_rate_hz Sample rate, in Hertz
+/// @return Half a second of samples
+std::vector<float> bitstreamGeneratorTestSubject(int sample_rate_hz) {
+    auto samples = std::vector<float>();
+    auto n_samples = sample_rate_hz / 2;
+    uint32_t noise_state = 1;
+
+    for (int i = 0; i < n_samples; i++) {
+        float sample;
+
+        if (i < n_samples * 3 / 5) {
+            auto phase = 2.0f * static_cast<float>(M_PI) * 125.0f *
+                static_cast<float>(i) / static_cast<float>(sample_rate_hz);
+            sample = 0.4f * sinf(phase) + 0.2f * sinf(3.0f * phase) +
+                0.1f * sinf(5.0f * phase);
+
+        } else {
+            noise_state = noise_state * 1664525u + 1013904223u;
+            sample = 0.2f * (static_cast<float>(noise_state >> 8) /
+                static_cast<float>(1 << 24) - 0.5f);
+        }
+
+        samples.push_back(sample);
+    }
+
+    return samples;
+}
+
+/// @brief Produces a Bitstream Generator with the default command-line
+///         settings
+/// @param style Bitstream format
+/// @return Bitstream Generator
+BitstreamGenerator bitstreamGeneratorTestGenerator(
+    BitstreamGenerator::EncoderStyle style) {
+    //
+    return BitstreamGenerator(25.0f, 1000, 800, -0.9375f, style, true, 2,
+        37.5f, 30.0f, false, 500, 50);
+}
+
+TEST(BitstreamGeneratorTests, EncodesSamplesToFrames) {
+    auto generator = bitstreamGeneratorTestGenerator(
+        BitstreamGenerator::ENCODERSTYLE_ASCII);
+
+    auto frames = generator.encodeFrames(bitstreamGeneratorTestSubject(8000),
+        8000);
+
+    // Half a second of 25 ms frames
+    ASSERT_EQ(frames.size(), 20);
+
+    auto n_voiced = 0;
+    for (const auto &frame : frames) {
+        n_voiced += (frame.isVoiced() && !frame.isSilent()) ? 1 : 0;
+    }
+
+    // The pulse train occupies the first 60% of the subject
+    EXPECT_GE(n_voiced, 8);
+    EXPECT_LE(n_voiced, 14);
+}
+
+TEST(BitstreamGeneratorTests, ResamplesSamplesInMemory) {
+    auto generator = bitstreamGeneratorTestGenerator(
+        BitstreamGenerator::ENCODERSTYLE_ASCII);
+
+    auto frames = generator.encodeFrames(
+        bitstreamGeneratorTestSubject(16000), 16000);
+
+    EXPECT_NEAR(static_cast<int>(frames.size()), 20, 1);
+}
+
+TEST(BitstreamGeneratorTests, BytesAndBitstreamsMatchFrames) {
+    auto generator = bitstreamGeneratorTestGenerator(
+        BitstreamGenerator::ENCODERSTYLE_ASCII);
+
+    auto samples = bitstreamGeneratorTestSubject(8000);
+    auto frames = generator.encodeFrames(samples, 8000);
+
+    auto rate = RateController::Result();
+    auto bytes = generator.encodeBytes(samples, 8000, &rate);
+    auto bitstream = generator.encodeBitstream(samples, 8000, "subject");
+
+    EXPECT_EQ(bytes, FrameEncoder(frames).toBytes(true));
+    EXPECT_EQ(bitstream, FrameEncoder(frames).toHex(true));
+    EXPECT_FALSE(bytes.empty());
+    EXPECT_GT(rate.n_bytes, 0);
+}
+
+TEST(BitstreamGeneratorTests, BitstreamFollowsEncoderStyle) {
+    auto generator = bitstreamGeneratorTestGenerator(
+        BitstreamGenerator::ENCODERSTYLE_C);
+
+    auto bitstream = generator.encodeBitstream(
+        bitstreamGeneratorTestSubject(8000), 8000, "subject");
+
+    EXPECT_EQ(bitstream.rfind("const int subject[] = {", 0), 0);
+    EXPECT_EQ(bitstream.substr(bitstream.size() - 3), "};\n");
+}
+
+};  // namespace tms_express
@@ -0,0 +1,128 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "encoding/CodingTable.hpp"
+#include "encoding/CoefficientQuantizer.hpp"
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Draws reflector coefficients uniformly from the span of each
+///         TMS5220 Coding Table
+std::vector<std::vector<float>> randomCoeffs(int n_sets) {
+    auto generator = std::mt19937(5220);
+    auto sets = std::vector<std::vector<float>>(n_sets);
+
+    for (auto &coeffs : sets) {
+        for (int i = 0; i < coding_table::tms5220::kNCoeffs; i++) {
+            auto table = coding_table::tms5220::getCoeffTable(i);
+            auto distribution = std::uniform_real_distribution<float>(
+                table.front(), table.back());
+
+            coeffs.push_back(distribution(generator));
+        }
+    }
+
+    return sets;
+}
+
+std::vector<int> nearestIndices(const std::vector<float> &coeffs) {
+    return Frame(50, true, 60.0f, coeffs).quantizedCoeffs();
+}
+
+TEST(CoefficientQuantizerTests, NeverWorseThanNearestEntries) {
+    auto quantizer = CoefficientQuantizer();
+
+    for (const auto &coeffs : randomCoeffs(200)) {
+        for (int n_coeffs : {4, 10}) {
+            auto nearest = nearestIndices(coeffs);
+            auto closed_loop = quantizer.quantize(coeffs, n_coeffs);
+
+            EXPECT_LE(quantizer.envelopeError(coeffs, closed_loop, n_coeffs),
+                quantizer.envelopeError(coeffs, nearest, n_coeffs) + 1e-4f);
+        }
+    }
+}
+
+TEST(CoefficientQuantizerTests, ReducesMeanEnvelopeError) {
+    auto quantizer = CoefficientQuantizer();
+    float nearest_error = 0.0f;
+    float closed_loop_error = 0.0f;
+
+    for (const auto &coeffs : randomCoeffs(200)) {
+        nearest_error += quantizer.envelopeError(coeffs,
+            nearestIndices(coeffs), 10);
+        closed_loop_error += quantizer.envelopeError(coeffs,
+            quantizer.quantize(coeffs, 10), 10);
+    }
+
+    EXPECT_LT(closed_loop_error, nearest_error);
+}
+
+TEST(CoefficientQuantizerTests, SearchesOnlyAdjacentEntriesOfLowOrderCoeffs) {
+    auto quantizer = CoefficientQuantizer();
+
+    for (const auto &coeffs : randomCoeffs(200)) {
+        auto nearest = nearestIndices(coeffs);
+        auto closed_loop = quantizer.quantize(coeffs, 10);
+
+        for (int i = 0; i < coding_table::tms5220::kNCoeffs; i++) {
+            if (i < 4) {
+                EXPECT_LE(std::abs(closed_loop[i] - nearest[i]), 1);
+            } else {
+                EXPECT_EQ(closed_loop[i], nearest[i]);
+            }
+        }
+    }
+}
+
+TEST(CoefficientQuantizerTests, TableEntriesAreQuantizedToThemselves) {
+    auto quantizer = CoefficientQuantizer();
+    auto indices = std::vector<int>{3, 20, 7, 12, 0, 15, 9, 4, 6, 1};
+    auto coeffs = std::vector<float>();
+
+    for (int i = 0; i < coding_table::tms5220::kNCoeffs; i++) {
+        coeffs.push_back(coding_table::tms5220::getCoeffTable(i)[indices[i]]);
+    }
+
+    EXPECT_EQ(quantizer.quantize(coeffs, 10), indices);
+}
+
+TEST(CoefficientQuantizerTests, MissingCoeffsAreTreatedAsZero) {
+    auto quantizer = CoefficientQuantizer();
+    auto coeffs = randomCoeffs(1).at(0);
+    auto short_coeffs = std::vector<float>(coeffs.begin(), coeffs.begin() + 4);
+
+    auto padded_coeffs = short_coeffs;
+    padded_coeffs.resize(coding_table::tms5220::kNCoeffs, 0.0f);
+
+    auto indices = quantizer.quantize(short_coeffs, 10);
+
+    EXPECT_EQ(indices.size(), coding_table::tms5220::kNCoeffs);
+    EXPECT_EQ(indices, quantizer.quantize(padded_coeffs, 10));
+    EXPECT_EQ(quantizer.envelopeError(short_coeffs, indices, 10),
+        quantizer.envelopeError(padded_coeffs, indices, 10));
+}
+
+TEST(CoefficientQuantizerTests, ApplySnapsFramesToSelectedEntries) {
+    auto quantizer = CoefficientQuantizer();
+    auto sets = randomCoeffs(3);
+
+    auto frames = std::vector<Frame>{Frame(50, true, 60.0f, sets[0]),
+        Frame(0, false, 60.0f, sets[1]), Frame(50, true, 0.0f, sets[2])};
+
+    quantizer.apply(frames);
+
+    EXPECT_EQ(frames[0].quantizedCoeffs(), quantizer.quantize(sets[0], 10));
+    EXPECT_EQ(frames[1].quantizedCoeffs(), quantizer.quantize(sets[1], 4));
+
+    // Silent frames encode no coefficients, and are left untouched
+    EXPECT_EQ(frames[2].getCoeffs(), sets[2]);
+}
+
+};  // namespace tms_express
@@ -0,0 +1,140 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "stats/EncoderStats.hpp"
+
+namespace tms_express {
+
+TEST(EncoderStatsTests, InactiveWithoutCollector) {
+    EXPECT_EQ(EncoderStats::active(), nullptr);
+
+    // Neither timers nor counts may fail when no stats are active
+    {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_ANALYSIS);
+        EncoderStats::count(EncoderStats::COUNTER_FRAMES, 10);
+    }
+
+    EXPECT_EQ(EncoderStats::active(), nullptr);
+}
+
+TEST(EncoderStatsTests, CollectorRecordsTimesAndCounts) {
+    auto stats = EncoderStats();
+
+    {
+        auto collector = EncoderStats::Collector(&stats);
+        EXPECT_EQ(EncoderStats::active(), &stats);
+
+        for (int i = 0; i < 3; i++) {
+            auto timer = EncoderStats::ScopedTimer(
+                EncoderStats::STAGE_FILTER);
+
+            EncoderStats::count(EncoderStats::COUNTER_FRAMES, 2);
+        }
+
+        EncoderStats::count(EncoderStats::COUNTER_FILES);
+    }
+
+    EXPECT_EQ(EncoderStats::active(), nullptr);
+    EXPECT_EQ(stats.getNCalls(EncoderStats::STAGE_FILTER), 3);
+    EXPECT_GE(stats.getTimeNs(EncoderStats::STAGE_FILTER), 0);
+    EXPECT_EQ(stats.getNCalls(EncoderStats::STAGE_ANALYSIS), 0);
+    EXPECT_EQ(stats.getCount(EncoderStats::COUNTER_FRAMES), 6);
+    EXPECT_EQ(stats.getCount(EncoderStats::COUNTER_FILES), 1);
+}
+
+TEST(EncoderStatsTests, NestedCollectorsRestorePreviousStats) {
+    auto outer = EncoderStats();
+    auto inner = EncoderStats();
+
+    auto outer_collector = EncoderStats::Collector(&outer);
+
+    {
+        auto inner_collector = EncoderStats::Collector(&inner);
+        EncoderStats::count(EncoderStats::COUNTER_BYTES, 5);
+    }
+
+    EXPECT_EQ(EncoderStats::active(), &outer);
+    EncoderStats::count(EncoderStats::COUNTER_BYTES, 7);
+
+    {
+        // A null Collector suspends collection
+        auto suspended = EncoderStats::Collector(nullptr);
+        EncoderStats::count(EncoderStats::COUNTER_BYTES, 100);
+    }
+
+    EXPECT_EQ(inner.getCount(EncoderStats::COUNTER_BYTES), 5);
+    EXPECT_EQ(outer.getCount(EncoderStats::COUNTER_BYTES), 7);
+}
+
+TEST(EncoderStatsTests, MergeAccumulates) {
+    auto a = EncoderStats();
+    a.addTime(EncoderStats::STAGE_DECODE, 1000);
+    a.addCount(EncoderStats::COUNTER_VOICED_FRAMES, 4);
+
+    auto b = EncoderStats();
+    b.addTime(EncoderStats::STAGE_DECODE, 500);
+    b.addTime(EncoderStats::STAGE_SERIALIZE, 250);
+    b.addCount(EncoderStats::COUNTER_VOICED_FRAMES, 6);
+
+    a.merge(b);
+
+    EXPECT_EQ(a.getTimeNs(EncoderStats::STAGE_DECODE), 1500);
+    EXPECT_EQ(a.getNCalls(EncoderStats::STAGE_DECODE), 2);
+    EXPECT_EQ(a.getTimeNs(EncoderStats::STAGE_SERIALIZE), 250);
+    EXPECT_EQ(a.getCount(EncoderStats::COUNTER_VOICED_FRAMES), 10);
+}
+
+TEST(EncoderStatsTests, SummariesNameEveryStageAndCounter) {
+    auto stats = EncoderStats();
+    stats.addTime(EncoderStats::STAGE_ANALYSIS, 2000000);
+    stats.addCount(EncoderStats::COUNTER_REPEAT_FRAMES, 3);
+
+    auto table = stats.toString();
+    auto json = stats.toJSON();
+
+    for (int i = 0; i < EncoderStats::STAGE_COUNT; i++) {
+        auto name = std::string(EncoderStats::stageName(
+            static_cast<EncoderStats::Stage>(i)));
+
+        EXPECT_NE(table.find(name), std::string::npos) << name;
+        EXPECT_NE(json.find("\"" + name + "\""), std::string::npos) << name;
+    }
+
+    for (int i = 0; i < EncoderStats::COUNTER_COUNT; i++) {
+        auto name = std::string(EncoderStats::counterName(
+            static_cast<EncoderStats::Counter>(i)));
+
+        EXPECT_NE(table.find(name), std::string::npos) << name;
+        EXPECT_NE(json.find("\"" + name + "\""), std::string::npos) << name;
+    }
+
+    EXPECT_NE(table.find("2.000"), std::string::npos);
+}
+
+TEST(EncoderStatsTests, DecodeTimesDecodingAndResampling) {
+    auto path = (std::filesystem::temp_directory_path() /
+        "tmsexpress-encoderstats.wav").string();
+
+    auto samples = std::vector<float>(16000, 0.25f);
+    AudioBuffer(samples, 16000, 25.0f).render(path);
+
+    auto stats = EncoderStats();
+    {
+        auto collector = EncoderStats::Collector(&stats);
+        auto buffer = AudioBuffer::Create(path, 8000, 25.0f);
+        ASSERT_NE(buffer, nullptr);
+    }
+
+    std::filesystem::remove(path);
+
+    EXPECT_GT(stats.getNCalls(EncoderStats::STAGE_DECODE), 0);
+    EXPECT_GT(stats.getNCalls(EncoderStats::STAGE_RESAMPLE), 0);
+}
+
+};  // namespace tms_express
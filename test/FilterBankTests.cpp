@@ -0,0 +1,159 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/FilterBank.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+/// @brief Measures the steady-state amplitude of a filtered sine wave
+/// @param samples Filtered samples
+/// @return Amplitude, derived from the RMS of the second half of the samples
+float steadyStateAmplitude(const std::vector<float> &samples) {
+    auto half = samples.size() / 2;
+    double sum = 0.0;
+
+    for (auto i = half; i < samples.size(); i++) {
+        sum += samples[i] * samples[i];
+    }
+
+    return static_cast<float>(std::sqrt(2.0 * sum / (samples.size() - half)));
+}
+
+TEST(FilterBankTests, EmptyFilterBankPassesSamplesUnmodified) {
+    auto samples = test::sineWave(440.0f, 8000, 8000);
+    auto original = samples;
+
+    auto filter_bank = FilterBank();
+    filter_bank.apply(samples, 8000);
+
+    EXPECT_EQ(samples, original);
+}
+
+TEST(FilterBankTests, PreEmphasisMatchesDifferenceEquation) {
+    auto samples = test::sineWave(440.0f, 8000, 8000);
+    auto original = samples;
+
+    auto filter_bank = FilterBank();
+    filter_bank.addPreEmphasis(0.9375f);
+    filter_bank.apply(samples, 8000);
+
+    EXPECT_FLOAT_EQ(samples[0], original[0]);
+    for (int i = 1; i < static_cast<int>(samples.size()); i++) {
+        EXPECT_NEAR(samples[i], original[i] - 0.9375f * original[i - 1],
+            1e-6f);
+    }
+}
+
+TEST(FilterBankTests, LowpassAttenuatesStopband) {
+    auto passband = test::sineWave(100.0f, 8000, 8000);
+    auto stopband = test::sineWave(3000.0f, 8000, 8000);
+
+    auto filter_bank = FilterBank();
+    filter_bank.addLowpass(800);
+    filter_bank.apply(passband, 8000);
+    filter_bank.apply(stopband, 8000);
+
+    EXPECT_NEAR(steadyStateAmplitude(passband), 1.0f, 0.01f);
+    EXPECT_LT(steadyStateAmplitude(stopband), 0.1f);
+}
+
+TEST(FilterBankTests, ButterworthIsHalfPowerAtCutoffForAnyOrderAndRate) {
+    for (int sample_rate_hz : {8000, 10000}) {
+        for (int order : {1, 2, 3, 4, 6}) {
+            auto samples = test::sineWave(1000.0f, sample_rate_hz,
+                sample_rate_hz);
+
+            auto filter_bank = FilterBank();
+            filter_bank.addHighpass(1000, order);
+            filter_bank.apply(samples, sample_rate_hz);
+
+            EXPECT_NEAR(steadyStateAmplitude(samples), M_SQRT1_2, 0.01f) <<
+                "order " << order << ", sample rate " << sample_rate_hz;
+        }
+    }
+}
+
+TEST(FilterBankTests, HigherOrderRollsOffFaster) {
+    auto second_order = test::sineWave(2000.0f, 8000, 8000);
+    auto fourth_order = second_order;
+
+    auto second_order_bank = FilterBank();
+    second_order_bank.addLowpass(800, 2);
+    second_order_bank.apply(second_order, 8000);
+
+    auto fourth_order_bank = FilterBank();
+    fourth_order_bank.addLowpass(800, 4);
+    fourth_order_bank.apply(fourth_order, 8000);
+
+    EXPECT_LT(steadyStateAmplitude(fourth_order),
+        0.5f * steadyStateAmplitude(second_order));
+}
+
+TEST(FilterBankTests, ChainMatchesSequentialFilters) {
+    auto chained = test::sineWave(440.0f, 8000, 8000);
+    auto sequential = chained;
+
+    auto filter_bank = FilterBank();
+    filter_bank.addPreEmphasis(0.9375f);
+    filter_bank.addHighpass(100);
+    filter_bank.addLowpass(3000);
+    filter_bank.apply(chained, 8000);
+
+    auto pre_emphasis = FilterBank();
+    pre_emphasis.addPreEmphasis(0.9375f);
+    pre_emphasis.apply(sequential, 8000);
+
+    auto highpass = FilterBank();
+    highpass.addHighpass(100);
+    highpass.apply(sequential, 8000);
+
+    auto lowpass = FilterBank();
+    lowpass.addLowpass(3000);
+    lowpass.apply(sequential, 8000);
+
+    for (int i = 0; i < static_cast<int>(chained.size()); i++) {
+        EXPECT_NEAR(chained[i], sequential[i], 1e-5f);
+    }
+}
+
+TEST(FilterBankTests, SplitMatchesIndependentChains) {
+    auto input = test::sineWave(440.0f, 8000, 8000);
+    auto first_expected = input;
+    auto second_expected = input;
+
+    auto first_bank = FilterBank();
+    first_bank.addPreEmphasis(0.9375f);
+    first_bank.addHighpass(100);
+    first_bank.apply(first_expected, 8000);
+
+    auto second_bank = FilterBank();
+    second_bank.addLowpass(800);
+    second_bank.apply(second_expected, 8000);
+
+    // The first branch overwrites the input in place
+    auto second_output = std::vector<float>(input.size());
+    FilterBank::applySplit(input.data(), static_cast<int>(input.size()), 8000,
+        first_bank, input.data(), second_bank, second_output.data());
+
+    EXPECT_EQ(input, first_expected);
+    EXPECT_EQ(second_output, second_expected);
+}
+
+TEST(FilterBankTests, AppliesToAudioBufferAtItsSampleRate) {
+    auto samples = test::sineWave(1000.0f, 10000, 10000);
+    auto buffer = AudioBuffer(samples, 10000, 25.0f);
+
+    auto filter_bank = FilterBank();
+    filter_bank.addLowpass(1000);
+    filter_bank.apply(buffer);
+
+    EXPECT_NEAR(steadyStateAmplitude(buffer.getSamples()), M_SQRT1_2, 0.01f);
+}
+
+};  // namespace tms_express
@@ -0,0 +1,83 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "bitstream/FrameAnalyzer.hpp"
+#include "encoding/Frame.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+TEST(FrameAnalyzerTests, StagedAnalysisMatchesAnalyze) {
+    auto buffer = AudioBuffer(test::harmonicTone(64.0f, 2000), 8000, 25.0f);
+    auto analyzer = FrameAnalyzer();
+
+    auto frames = analyzer.analyze(buffer, buffer);
+    auto staged = analyzer.assembleFrames(analyzer.analyzeLpc(buffer),
+        analyzer.analyzePitch(buffer));
+
+    ASSERT_EQ(frames.size(), 10);
+    ASSERT_EQ(staged.size(), frames.size());
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        EXPECT_EQ(staged[i].getPitch(), frames[i].getPitch());
+        EXPECT_EQ(staged[i].isVoiced(), frames[i].isVoiced());
+        EXPECT_EQ(staged[i].getGain(), frames[i].getGain());
+        EXPECT_EQ(staged[i].getCoeffs(), frames[i].getCoeffs());
+        EXPECT_EQ(staged[i].getSpectralChange(),
+            frames[i].getSpectralChange());
+    }
+}
+
+TEST(FrameAnalyzerTests, PitchAlgorithmIsApplied) {
+    auto buffer = AudioBuffer(test::harmonicTone(64.5f, 2000), 8000, 25.0f);
+    auto analyzer = FrameAnalyzer();
+
+    auto acf = analyzer.analyzePitch(buffer);
+    analyzer.setPitchAlgorithm(FrameAnalyzer::PITCHALGORITHM_YIN);
+    auto yin = analyzer.analyzePitch(buffer);
+
+    ASSERT_EQ(acf.size(), yin.size());
+
+    // The autocorrelation estimator only finds integer periods, while YIN
+    // interpolates between them
+    for (size_t i = 0; i < acf.size(); i++) {
+        EXPECT_EQ(acf[i].period, std::round(acf[i].period));
+        EXPECT_NEAR(yin[i].period, 64.5f, 0.5f);
+    }
+}
+
+TEST(FrameAnalyzerTests, SteadyToneHasLittleSpectralChange) {
+    auto buffer = AudioBuffer(test::harmonicTone(64.0f, 2000), 8000, 25.0f);
+    auto lpc = FrameAnalyzer().analyzeLpc(buffer);
+
+    ASSERT_EQ(lpc.size(), 10);
+    EXPECT_EQ(lpc[0].spectral_change_db, 0.0f);
+
+    for (size_t i = 1; i < lpc.size(); i++) {
+        EXPECT_LT(lpc[i].spectral_change_db, 3.0f);
+    }
+}
+
+TEST(FrameAnalyzerTests, SpectralChangeIsSkippedWhenDisabled) {
+    auto buffer = AudioBuffer(test::whiteNoise(2000), 8000, 25.0f);
+    auto analyzer = FrameAnalyzer();
+
+    auto enabled = analyzer.analyzeLpc(buffer);
+    analyzer.setSpectralChange(false);
+    auto disabled = analyzer.analyzeLpc(buffer);
+
+    ASSERT_EQ(enabled.size(), disabled.size());
+    EXPECT_GT(enabled[1].spectral_change_db, 0.0f);
+
+    for (size_t i = 0; i < disabled.size(); i++) {
+        EXPECT_EQ(disabled[i].spectral_change_db, 0.0f);
+        EXPECT_EQ(disabled[i].coeffs, enabled[i].coeffs);
+    }
+}
+
+};  // namespace tms_express
@@ -0,0 +1,174 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/AudioCache.hpp"
+#include "bitstream/FrameCache.hpp"
+#include "encoding/Frame.hpp"
+
+namespace tms_express {
+
+/// @brief Creates an empty temporary directory unique to the calling test
+/// @return Path to temporary directory
+std::filesystem::path frameCacheTestDirectory() {
+    auto test_name = std::string(
+        testing::UnitTest::GetInstance()->current_test_info()->name());
+
+    auto directory = std::filesystem::temp_directory_path() /
+        ("tmsexpress-framecache-" + test_name);
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+/// @brief Produces test subject, which is a short table of raw Frames
+/// @return Test subject
+std::vector<Frame> frameCacheTestSubject() {
+    return {
+        Frame(38.25f, true, 56.850773f,
+            {-0.753234f, 0.939525f, -0.342255f, -0.172317f, 0.108887f,
+                0.679660f, 0.056874f, 0.433271f, -0.220355f, 0.17028f}),
+        Frame(0.0f, false, 12.5f,
+            {0.1f, -0.2f, 0.3f, -0.4f, 0.5f, -0.6f, 0.7f, -0.8f, 0.9f, 0.0f}),
+        Frame(80.0f, true, 0.0f,
+            {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f}),
+    };
+}
+
+/// @brief Renders a short audio file, to be used as a cache key source
+/// @param path Path to audio file
+/// @param value Value of every sample
+void renderFrameCacheTestAudio(const std::string &path, float value) {
+    AudioBuffer(std::vector<float>(400, value), 8000, 25.0f).render(path);
+}
+
+TEST(FrameCacheTests, StoredFramesAreLoadedExactly) {
+    auto directory = frameCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    renderFrameCacheTestAudio(audio_path, 0.25f);
+
+    auto cache = FrameCache((directory / "cache").string());
+    auto key = FrameCache::makeKey(audio_path, "window=25");
+    auto frames = frameCacheTestSubject();
+    frames[1].setSpectralChange(7.5f);
+
+    ASSERT_FALSE(key.empty());
+    ASSERT_TRUE(cache.store(key, frames));
+
+    auto cached_frames = std::vector<Frame>();
+    ASSERT_TRUE(cache.load(key, cached_frames));
+    ASSERT_EQ(cached_frames.size(), frames.size());
+
+    for (int i = 0; i < static_cast<int>(frames.size()); i++) {
+        EXPECT_EQ(cached_frames[i].getPitch(), frames[i].getPitch());
+        EXPECT_EQ(cached_frames[i].getGain(), frames[i].getGain());
+        EXPECT_EQ(cached_frames[i].isVoiced(), frames[i].isVoiced());
+        EXPECT_EQ(cached_frames[i].getSpectralChange(),
+            frames[i].getSpectralChange());
+        EXPECT_EQ(cached_frames[i].getCoeffs(), frames[i].getCoeffs());
+        EXPECT_EQ(cached_frames[i].toBinary(), frames[i].toBinary());
+    }
+}
+
+TEST(FrameCacheTests, MissingEntryIsNotLoaded) {
+    auto directory = frameCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    renderFrameCacheTestAudio(audio_path, 0.25f);
+
+    auto cache = FrameCache((directory / "cache").string());
+    auto frames = std::vector<Frame>();
+
+    EXPECT_FALSE(cache.load(FrameCache::makeKey(audio_path, ""), frames));
+}
+
+TEST(FrameCacheTests, TruncatedEntryIsNotLoaded) {
+    auto directory = frameCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    renderFrameCacheTestAudio(audio_path, 0.25f);
+
+    auto cache = FrameCache((directory / "cache").string());
+    auto key = FrameCache::makeKey(audio_path, "");
+    auto entry_path = directory / "cache" / (key + ".frames");
+    ASSERT_TRUE(cache.store(key, frameCacheTestSubject()));
+
+    std::filesystem::resize_file(entry_path,
+        std::filesystem::file_size(entry_path) - 1);
+
+    auto frames = std::vector<Frame>();
+    EXPECT_FALSE(cache.load(key, frames));
+}
+
+TEST(FrameCacheTests, EntryWithUnexpectedModelOrderIsNotLoaded) {
+    auto directory = frameCacheTestDirectory();
+    auto audio_path = (directory / "subject.wav").string();
+    renderFrameCacheTestAudio(audio_path, 0.25f);
+
+    auto cache = FrameCache((directory / "cache").string());
+    auto key = FrameCache::makeKey(audio_path, "");
+    auto entry_path = directory / "cache" / (key + ".frames");
+    ASSERT_TRUE(cache.store(key, frameCacheTestSubject()));
+
+    // Claim one fewer coefficient per record, and drop the bytes of one
+    // coefficient from each of the three records, such that the size of the
+    // entry remains consistent with its header
+    uint32_t n_coeffs = 9;
+
+    {
+        auto file = std::fstream(entry_path,
+            std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(12);
+        file.write(reinterpret_cast<const char *>(&n_coeffs),
+            sizeof(n_coeffs));
+    }
+
+    std::filesystem::resize_file(entry_path,
+        std::filesystem::file_size(entry_path) - 3 * sizeof(float));
+
+    auto frames = std::vector<Frame>();
+    EXPECT_FALSE(cache.load(key, frames));
+}
+
+TEST(FrameCacheTests, KeyDependsOnParametersAndContents) {
+    auto directory = frameCacheTestDirectory();
+    auto first_path = (directory / "first.wav").string();
+    auto second_path = (directory / "second.wav").string();
+
+    renderFrameCacheTestAudio(first_path, 0.25f);
+    renderFrameCacheTestAudio(second_path, 0.5f);
+
+    auto key = FrameCache::makeKey(first_path, "window=25");
+
+    EXPECT_EQ(key, FrameCache::makeKey(first_path, "window=25"));
+    EXPECT_NE(key, FrameCache::makeKey(first_path, "window=22.5"));
+    EXPECT_NE(key, FrameCache::makeKey(second_path, "window=25"));
+}
+
+TEST(FrameCacheTests, KeyOfChecksumMatchesKeyOfPath) {
+    auto directory = frameCacheTestDirectory();
+    auto path = (directory / "subject.wav").string();
+    renderFrameCacheTestAudio(path, 0.25f);
+
+    uint32_t checksum;
+    uint64_t size;
+    ASSERT_TRUE(AudioCache::checksumFile(path, checksum, size));
+
+    EXPECT_EQ(FrameCache::makeKey(checksum, size, "window=25"),
+        FrameCache::makeKey(path, "window=25"));
+}
+
+TEST(FrameCacheTests, UnreadableFileHasNoKey) {
+    auto directory = frameCacheTestDirectory();
+    auto key = FrameCache::makeKey((directory / "missing.wav").string(), "");
+
+    EXPECT_TRUE(key.empty());
+}
+
+};  // namespace tms_express
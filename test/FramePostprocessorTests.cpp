@@ -0,0 +1,167 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "encoding/Frame.hpp"
+#include "encoding/FramePostprocessor.hpp"
+
+namespace tms_express {
+
+/// @brief Creates a loud Frame whose coefficients drift with the given phase
+Frame postprocessorTestFrame(float phase, bool is_voiced = true) {
+    auto coeffs = std::vector<float>();
+
+    for (int i = 0; i < 10; i++) {
+        coeffs.push_back(0.4f * sinf(phase + static_cast<float>(i)));
+    }
+
+    return Frame(is_voiced ? 50.0f : 0.0f, is_voiced, 1385.0f, coeffs);
+}
+
+TEST(FramePostprocessorTests, IdenticalFramesAreRepeatedUpToChainLimit) {
+    auto frames = std::vector<Frame>(7, postprocessorTestFrame(0.0f));
+    auto post_processor = FramePostprocessor(&frames);
+    post_processor.setMaxRepeatChain(3);
+
+    EXPECT_EQ(post_processor.fitRepeatFramesToDistortion(0.5f), 5);
+
+    // No more than three consecutive Frames may be repeats
+    int chain = 0;
+    EXPECT_FALSE(frames[0].isRepeat());
+
+    for (const auto &frame : frames) {
+        chain = frame.isRepeat() ? chain + 1 : 0;
+        EXPECT_LE(chain, 3);
+    }
+}
+
+TEST(FramePostprocessorTests, VoicingChangesBreakRepeatChains) {
+    auto frames = std::vector<Frame>();
+
+    for (int i = 0; i < 6; i++) {
+        frames.push_back(postprocessorTestFrame(0.0f, i % 2 == 0));
+    }
+
+    auto post_processor = FramePostprocessor(&frames);
+    EXPECT_EQ(post_processor.optimizeRepeatFrames(1.0f), 0);
+}
+
+TEST(FramePostprocessorTests, SilentFramesAreNeverRepeats) {
+    auto frames = std::vector<Frame>(4, postprocessorTestFrame(0.0f));
+    frames[2].setGain(0);
+
+    auto post_processor = FramePostprocessor(&frames);
+    post_processor.optimizeRepeatFrames(1.0f);
+
+    EXPECT_FALSE(frames[2].isRepeat());
+    EXPECT_FALSE(frames[3].isRepeat());
+    EXPECT_TRUE(frames[2].isSilent());
+}
+
+TEST(FramePostprocessorTests, SilentFramesBreakRepeatChains) {
+    auto frames = std::vector<Frame>(9, postprocessorTestFrame(0.0f));
+    frames[4].setGain(0);
+
+    for (auto &frame : frames) {
+        frame.setSpectralChange(0.0f);
+    }
+
+    // Even when repeats cost nothing, the Frame after the silent Frame must
+    // begin a new chain rather than repeat the Frame before it
+    for (int mode = 0; mode < 2; mode++) {
+        auto copy = frames;
+        auto post_processor = FramePostprocessor(&copy);
+        post_processor.setMaxRepeatChain(8);
+
+        if (mode == 0) {
+            EXPECT_EQ(post_processor.fitRepeatFramesToDistortion(0.5f), 6);
+        } else {
+            EXPECT_EQ(post_processor.adaptFrameRate(8.0f), 6);
+        }
+
+        EXPECT_FALSE(copy[0].isRepeat());
+        EXPECT_FALSE(copy[4].isRepeat());
+        EXPECT_FALSE(copy[5].isRepeat());
+        EXPECT_TRUE(copy[4].isSilent());
+    }
+}
+
+TEST(FramePostprocessorTests, BitrateFitMeetsBudget) {
+    auto frames = std::vector<Frame>();
+
+    for (int i = 0; i < 100; i++) {
+        frames.push_back(postprocessorTestFrame(0.05f * i, (i / 10) % 3 != 0));
+    }
+
+    auto post_processor = FramePostprocessor(&frames);
+    auto full_size = post_processor.getNBits();
+
+    post_processor.fitRepeatFramesToBitrate(30.0f);
+    auto size = post_processor.getNBits();
+
+    EXPECT_LE(size, 30 * 100);
+    EXPECT_LT(size, full_size);
+}
+
+TEST(FramePostprocessorTests, LooserDistortionBudgetNeverGrowsBitstream) {
+    auto frames = std::vector<Frame>();
+
+    for (int i = 0; i < 100; i++) {
+        frames.push_back(postprocessorTestFrame(0.05f * i));
+    }
+
+    int previous_size = 50 * 100;
+
+    for (float budget : {0.5f, 1.0f, 2.0f, 4.0f}) {
+        auto copy = frames;
+        auto post_processor = FramePostprocessor(&copy);
+        post_processor.fitRepeatFramesToDistortion(budget);
+
+        EXPECT_LE(post_processor.getNBits(), previous_size);
+        previous_size = post_processor.getNBits();
+    }
+}
+
+TEST(FramePostprocessorTests, SteadyFramesRepeatAtReducedFrameRate) {
+    auto frames = std::vector<Frame>(10, postprocessorTestFrame(0.0f));
+
+    for (auto &frame : frames) {
+        frame.setSpectralChange(1.0f);
+    }
+
+    auto post_processor = FramePostprocessor(&frames);
+    post_processor.setMaxRepeatChain(4);
+
+    // Chains of four repeats follow each fully-encoded Frame
+    EXPECT_EQ(post_processor.adaptFrameRate(8.0f), 8);
+    EXPECT_FALSE(frames[0].isRepeat());
+    EXPECT_FALSE(frames[5].isRepeat());
+}
+
+TEST(FramePostprocessorTests, TransientsAreEncodedAtFullFrameRate) {
+    auto frames = std::vector<Frame>(8, postprocessorTestFrame(0.0f));
+
+    for (auto &frame : frames) {
+        frame.setSpectralChange(3.0f);
+    }
+
+    // A large change breaks the chain immediately, and accumulated small
+    // changes break it once they exceed the threshold
+    frames[3].setSpectralChange(20.0f);
+
+    auto post_processor = FramePostprocessor(&frames);
+    post_processor.setMaxRepeatChain(8);
+    post_processor.adaptFrameRate(8.0f);
+
+    auto expected = std::vector<bool>{
+        false, true, true, false, true, true, false, true};
+
+    for (int i = 0; i < static_cast<int>(frames.size()); i++) {
+        EXPECT_EQ(frames[i].isRepeat(), expected[i]) << "Frame " << i;
+    }
+}
+
+};  // namespace tms_express
@@ -120,4 +120,18 @@ TEST(FrameTests, VoicedFrameHasFullParameterSet) {
     EXPECT_EQ(k10_bin, "100");
 }
 
+TEST(FrameTests, BitCountMatchesBinaryRepresentation) {
+    auto frame = frameTestSubject();
+    EXPECT_EQ(frame.getNBits(), frame.toBinary().size());
+
+    frame.setVoicing(false);
+    EXPECT_EQ(frame.getNBits(), frame.toBinary().size());
+
+    frame.setRepeat(true);
+    EXPECT_EQ(frame.getNBits(), frame.toBinary().size());
+
+    frame.setGain(0.0f);
+    EXPECT_EQ(frame.getNBits(), frame.toBinary().size());
+}
+
 };  // namespace tms_express
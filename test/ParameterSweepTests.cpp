@@ -0,0 +1,142 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "bitstream/ParameterSweep.hpp"
+
+namespace tms_express {
+
+/// @brief Renders test subject, which is half a second of a vowel-like pulse
+///         train followed by noise, to an audio file
+/// @param path Path to audio file
+void renderParameterSweepTestSubject(const std::string &path) {
+    auto samples = std::vector<float>();
+    uint32_t noise_state = 1;
+
+    for (int i = 0; i < 4000; i++) {
+        float sample;
+
+        if (i < 2400) {
+            auto phase = 2.0f * static_cast<float>(M_PI) * 125.0f *
+                static_cast<float>(i) / 8000.0f;
+            sample = 0.4f * sinf(phase) + 0.2f * sinf(3.0f * phase) +
+                0.1f * sinf(5.0f * phase);
+
+        } else {
+            noise_state = noise_state * 1664525u + 1013904223u;
+            sample = 0.2f * (static_cast<float>(noise_state >> 8) /
+                static_cast<float>(1 << 24) - 0.5f);
+        }
+
+        samples.push_back(sample);
+    }
+
+    AudioBuffer(samples, 8000, 25.0f).render(path);
+}
+
+TEST(ParameterSweepTests, RangeParsesSingleValuesAndTriples) {
+    auto range = ParameterSweep::Range();
+
+    ASSERT_TRUE(ParameterSweep::Range::parse("25", range));
+    EXPECT_EQ(range.values(), std::vector<float>({25.0f}));
+
+    ASSERT_TRUE(ParameterSweep::Range::parse("20:30:2.5", range));
+    EXPECT_EQ(range.values(),
+        std::vector<float>({20.0f, 22.5f, 25.0f, 27.5f, 30.0f}));
+
+    ASSERT_TRUE(ParameterSweep::Range::parse("-0.9:-0.8:0.05", range));
+    EXPECT_EQ(range.values().size(), 3);
+}
+
+TEST(ParameterSweepTests, RangeRejectsMalformedStrings) {
+    auto range = ParameterSweep::Range();
+
+    EXPECT_FALSE(ParameterSweep::Range::parse("", range));
+    EXPECT_FALSE(ParameterSweep::Range::parse("20:30", range));
+    EXPECT_FALSE(ParameterSweep::Range::parse("20:30:0", range));
+    EXPECT_FALSE(ParameterSweep::Range::parse("30:20:1", range));
+    EXPECT_FALSE(ParameterSweep::Range::parse("20:30:1x", range));
+}
+
+TEST(ParameterSweepTests, CombinationsCoverEveryRange) {
+    auto sweep = ParameterSweep({20.0f, 25.0f, 5.0f}, {800, 1200, 200},
+        {600, 800, 200}, {-0.9375f, -0.9375f, 1.0f}, {50, 50, 1},
+        {400, 500, 100});
+
+    auto combinations = sweep.getCombinations();
+    EXPECT_EQ(combinations.size(), 2 * 3 * 2 * 1 * 1 * 2);
+}
+
+TEST(ParameterSweepTests, ResultsAreRankedAndIndependentOfThreads) {
+    auto path = (std::filesystem::temp_directory_path() /
+        "tmsexpress-parametersweep-subject.wav").string();
+    renderParameterSweepTestSubject(path);
+
+    auto sweep = ParameterSweep({20.0f, 25.0f, 5.0f}, {800, 1200, 400},
+        {600, 800, 200}, {-0.9375f, -0.9375f, 1.0f}, {50, 50, 1},
+        {400, 500, 100});
+
+    sweep.setThreads(1);
+    auto serial_results = sweep.run({path});
+
+    sweep.setThreads(4);
+    auto parallel_results = sweep.run({path});
+
+    ASSERT_EQ(serial_results.size(), sweep.getCombinations().size());
+    ASSERT_EQ(parallel_results.size(), serial_results.size());
+
+    for (int i = 0; i < static_cast<int>(serial_results.size()); i++) {
+        EXPECT_TRUE(std::isfinite(serial_results[i].score_db));
+        EXPECT_EQ(serial_results[i].score_db, parallel_results[i].score_db);
+
+        if (i > 0) {
+            EXPECT_LE(serial_results[i - 1].score_db,
+                serial_results[i].score_db);
+        }
+    }
+}
+
+TEST(ParameterSweepTests, EmptyPitchRangesAreSkipped) {
+    auto path = (std::filesystem::temp_directory_path() /
+        "tmsexpress-parametersweep-overlap.wav").string();
+    renderParameterSweepTestSubject(path);
+
+    // Of the nine pitch ranges, 100-100 and 150-100 Hz are empty
+    auto sweep = ParameterSweep({25.0f, 25.0f, 1.0f}, {1000, 1000, 1},
+        {800, 800, 1}, {-0.9375f, -0.9375f, 1.0f}, {50, 150, 50},
+        {100, 300, 100});
+
+    auto combinations = sweep.getCombinations();
+    ASSERT_EQ(combinations.size(), 7);
+    EXPECT_EQ(sweep.getNSkippedCombinations(), 2);
+
+    for (const auto &settings : combinations) {
+        EXPECT_LT(settings.min_pitch_hz, settings.max_pitch_hz);
+    }
+
+    auto results = sweep.run({path});
+    ASSERT_EQ(results.size(), combinations.size());
+
+    for (const auto &result : results) {
+        EXPECT_LT(result.settings.min_pitch_hz, result.settings.max_pitch_hz);
+        EXPECT_TRUE(std::isfinite(result.score_db));
+    }
+}
+
+TEST(ParameterSweepTests, MissingFileThrows) {
+    auto sweep = ParameterSweep({25.0f, 25.0f, 1.0f}, {1000, 1000, 1},
+        {800, 800, 1}, {-0.9375f, -0.9375f, 1.0f}, {50, 50, 1},
+        {500, 500, 1});
+
+    EXPECT_THROW(sweep.run({"/nonexistent/tmsexpress.wav"}),
+        std::runtime_error);
+}
+
+};  // namespace tms_express
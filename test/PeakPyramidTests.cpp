@@ -0,0 +1,85 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "audio/PeakPyramid.hpp"
+
+namespace tms_express {
+
+/// @brief Produces test subject, which is a noisy sinusoid
+/// @param n_samples Number of samples
+/// @return Test subject
+std::vector<float> peakPyramidTestSubject(int n_samples) {
+    auto samples = std::vector<float>(n_samples);
+
+    for (int i = 0; i < n_samples; i++) {
+        samples[i] = 0.5f * sinf(0.01f * static_cast<float>(i)) +
+            0.25f * sinf(2.3f * static_cast<float>(i * i % 97));
+    }
+
+    return samples;
+}
+
+TEST(PeakPyramidTests, LevelsShrinkByBranchingFactor) {
+    auto pyramid = PeakPyramid(peakPyramidTestSubject(1000));
+
+    // 1000 samples are summarized by 250, 63, 16, 4, and 1 Peaks
+    EXPECT_EQ(pyramid.getNSamples(), 1000);
+    EXPECT_EQ(pyramid.getNLevels(), 5);
+}
+
+TEST(PeakPyramidTests, SpansCoverEverySampleExactlyOnce) {
+    auto samples = peakPyramidTestSubject(48000);
+    auto pyramid = PeakPyramid(samples);
+
+    for (int n_spans : {1, 7, 640, 1920}) {
+        auto peaks = pyramid.query(n_spans);
+        ASSERT_EQ(static_cast<int>(peaks.size()), n_spans);
+
+        // Snapping to blocks moves the bounds of each span, but the spans
+        // still tile the signal, so the extremes of the signal are found
+        auto min = peaks[0].min;
+        auto max = peaks[0].max;
+
+        for (const auto &peak : peaks) {
+            EXPECT_LE(peak.min, peak.max);
+            min = std::min(min, peak.min);
+            max = std::max(max, peak.max);
+        }
+
+        EXPECT_EQ(min, *std::min_element(samples.begin(), samples.end()));
+        EXPECT_EQ(max, *std::max_element(samples.begin(), samples.end()));
+    }
+}
+
+TEST(PeakPyramidTests, QueryMatchesScanOfSnappedSpan) {
+    auto samples = peakPyramidTestSubject(10000);
+    auto pyramid = PeakPyramid(samples);
+
+    // A span of 100 samples is read from blocks of 16, so its bounds move by
+    // at most 8 samples
+    auto peak = pyramid.query(1003, 1103);
+
+    auto inner_min = *std::min_element(samples.begin() + 1011,
+        samples.begin() + 1095);
+    auto outer_min = *std::min_element(samples.begin() + 995,
+        samples.begin() + 1111);
+
+    EXPECT_LE(peak.min, inner_min);
+    EXPECT_GE(peak.min, outer_min);
+}
+
+TEST(PeakPyramidTests, ShortSpansAreReadFromSamples) {
+    auto samples = std::vector<float>{0.0f, 1.0f, -1.0f, 0.5f, 0.25f};
+    auto pyramid = PeakPyramid(samples);
+
+    auto peak = pyramid.query(3, 5);
+    EXPECT_EQ(peak.min, 0.25f);
+    EXPECT_EQ(peak.max, 0.5f);
+}
+
+};  // namespace tms_express
@@ -0,0 +1,52 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/PitchEstimator.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+TEST(PitchEstimatorTests, DecimatedPeriodMatchesFullRatePeriod) {
+    auto estimator = PitchEstimator(8000);
+
+    for (float period : {20.0f, 37.0f, 53.0f, 80.0f, 117.0f}) {
+        auto segment = test::harmonicTone(period);
+        auto full_rate = estimator.estimatePeriod(Autocorrelation(segment));
+
+        for (int factor = 2; factor <= 4; factor++) {
+            EXPECT_EQ(estimator.estimatePeriodDecimated(segment, factor),
+                full_rate) << "period " << period << ", factor " << factor;
+        }
+    }
+}
+
+TEST(PitchEstimatorTests, DecimatedPeriodIsClampedToBounds) {
+    // A 1 kHz tone lies above the max pitch frequency
+    auto estimator = PitchEstimator(8000, 50, 500);
+    auto period = estimator.estimatePeriodDecimated(test::harmonicTone(8.0f),
+        4);
+
+    EXPECT_GE(period, estimator.getMinPeriod());
+    EXPECT_LE(period, estimator.getMaxPeriod());
+}
+
+TEST(PitchEstimatorTests, InvertedRangeStaysWithinAutocorrelation) {
+    // A floor of 150 Hz above a ceiling of 100 Hz places the min period past
+    // the max period, and so past the end of a max_period + 1 lag
+    // autocorrelation
+    auto estimator = PitchEstimator(8000, 150, 100);
+    auto acf = Autocorrelation(test::sineWave(120.0f, 8000, 200),
+        estimator.getMaxPeriod() + 1);
+
+    ASSERT_GT(estimator.getMinPeriod(), estimator.getMaxPeriod());
+
+    auto period = estimator.estimatePeriod(acf);
+    EXPECT_GE(period, 0);
+    EXPECT_LE(period, estimator.getMinPeriod());
+}
+
+};  // namespace tms_express
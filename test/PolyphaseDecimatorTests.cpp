@@ -0,0 +1,90 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "audio/PolyphaseDecimator.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+/// @brief Measures the RMS amplitude of the middle half of a signal, away
+///         from its edges
+/// @param samples Samples
+/// @return RMS amplitude
+float middleRms(const std::vector<float> &samples) {
+    double sum = 0.0;
+    auto start = samples.size() / 4;
+    auto end = 3 * samples.size() / 4;
+
+    for (auto i = start; i < end; i++) {
+        sum += samples[i] * samples[i];
+    }
+
+    return static_cast<float>(std::sqrt(sum / (end - start)));
+}
+
+TEST(PolyphaseDecimatorTests, SupportsOnlyIntegerRatios) {
+    EXPECT_TRUE(PolyphaseDecimator::supports(48000, 8000));
+    EXPECT_TRUE(PolyphaseDecimator::supports(16000, 8000));
+    EXPECT_FALSE(PolyphaseDecimator::supports(44100, 8000));
+    EXPECT_FALSE(PolyphaseDecimator::supports(4000, 8000));
+}
+
+TEST(PolyphaseDecimatorTests, OutputHasExpectedLength) {
+    auto decimator = PolyphaseDecimator(6);
+    auto output = decimator.decimate(std::vector<float>(1001, 0.0f));
+
+    EXPECT_EQ(output.size(), 167);
+}
+
+TEST(PolyphaseDecimatorTests, PassbandIsPreservedWithoutDelay) {
+    auto input = test::sineWave(440.0f, 48000, 48000);
+    auto decimator = PolyphaseDecimator(6);
+    auto output = decimator.decimate(input);
+
+    // Output sample m is centered on input sample 6m
+    for (int m = 2000; m < 2100; m++) {
+        EXPECT_NEAR(output[m], input[6 * m], 0.01f);
+    }
+}
+
+TEST(PolyphaseDecimatorTests, AliasesAreAttenuated) {
+    // A 10 kHz tone would alias to 2 kHz at an 8 kHz sample rate
+    auto decimator = PolyphaseDecimator(6);
+    auto output = decimator.decimate(test::sineWave(10000.0f, 48000, 48000));
+
+    EXPECT_LT(middleRms(output), 1e-3f);
+}
+
+TEST(PolyphaseDecimatorTests, StreamingMatchesWholeSignal) {
+    auto input = test::sineWave(440.0f, 48000, 48000);
+    auto decimator = PolyphaseDecimator(6);
+    auto expected = decimator.decimate(input);
+
+    // Feed the signal in irregular blocks
+    auto output = std::vector<float>();
+    int offset = 0;
+    int block_size = 1;
+
+    while (offset < static_cast<int>(input.size())) {
+        auto n = std::min(block_size,
+            static_cast<int>(input.size()) - offset);
+        decimator.process(input.data() + offset, n, output);
+
+        offset += n;
+        block_size = (block_size * 7) % 997 + 1;
+    }
+
+    decimator.flush(output);
+
+    ASSERT_EQ(output.size(), expected.size());
+    for (int i = 0; i < static_cast<int>(output.size()); i++) {
+        EXPECT_FLOAT_EQ(output[i], expected[i]);
+    }
+}
+
+};  // namespace tms_express
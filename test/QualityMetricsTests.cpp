@@ -0,0 +1,129 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "analysis/QualityMetrics.hpp"
+
+namespace tms_express {
+
+/// @brief Produces test subject, which is one second of alternating voiced
+///         and unvoiced 100 ms bursts sampled at 8 kHz
+/// @return Test subject
+std::vector<float> qualityMetricsTestSubject() {
+    auto samples = std::vector<float>();
+    uint32_t noise_state = 1;
+
+    for (int i = 0; i < 8000; i++) {
+        if ((i / 800) % 2 == 0) {
+            auto phase = 2.0f * static_cast<float>(M_PI) * 120.0f *
+                static_cast<float>(i) / 8000.0f;
+            samples.push_back(0.5f * sinf(phase) + 0.25f * sinf(2.0f * phase) +
+                0.1f * sinf(4.0f * phase));
+
+        } else {
+            noise_state = noise_state * 1664525u + 1013904223u;
+            samples.push_back(0.3f * (static_cast<float>(noise_state >> 8) /
+                static_cast<float>(1 << 24) - 0.5f));
+        }
+    }
+
+    return samples;
+}
+
+TEST(QualityMetricsTests, IdenticalSignalsArePerfect) {
+    auto source = qualityMetricsTestSubject();
+    auto report = QualityMetrics().evaluate(source, source);
+
+    EXPECT_EQ(report.lag_samples, 0);
+    EXPECT_EQ(report.n_active_frames, 40);
+    EXPECT_NEAR(report.log_spectral_distance_db, 0.0f, 1e-3f);
+    EXPECT_FLOAT_EQ(report.segmental_snr_db, 35.0f);
+    EXPECT_FLOAT_EQ(report.pitch_error_cents, 0.0f);
+    EXPECT_FLOAT_EQ(report.voicing_error_rate, 0.0f);
+}
+
+TEST(QualityMetricsTests, VoicingIsDetectedInSource) {
+    auto source = qualityMetricsTestSubject();
+    auto report = QualityMetrics().evaluate(source, source);
+
+    // Each 100 ms burst spans four 25 ms frames. Short noise segments are
+    // occasionally periodic by chance, so a few errors are tolerated
+    int n_correct = 0;
+    for (int i = 0; i < static_cast<int>(report.frames.size()); i++) {
+        n_correct += report.frames[i].source_is_voiced == ((i / 4) % 2 == 0);
+    }
+
+    EXPECT_GE(n_correct, 38);
+}
+
+TEST(QualityMetricsTests, DelayedAndScaledCopyIsAligned) {
+    auto source = qualityMetricsTestSubject();
+    auto synthesized = std::vector<float>(37, 0.0f);
+
+    for (auto sample : source) {
+        synthesized.push_back(0.25f * sample);
+    }
+
+    auto report = QualityMetrics().evaluate(source, synthesized);
+
+    EXPECT_EQ(report.lag_samples, 37);
+    EXPECT_NEAR(report.log_spectral_distance_db, 0.0f, 1e-3f);
+    EXPECT_GT(report.segmental_snr_db, 30.0f);
+}
+
+TEST(QualityMetricsTests, NoiseScoresWorseThanCopy) {
+    auto source = qualityMetricsTestSubject();
+    auto noisy = source;
+    uint32_t noise_state = 7;
+
+    for (auto &sample : noisy) {
+        noise_state = noise_state * 1664525u + 1013904223u;
+        sample += 0.2f * (static_cast<float>(noise_state >> 8) /
+            static_cast<float>(1 << 24) - 0.5f);
+    }
+
+    auto metrics = QualityMetrics();
+    auto report = metrics.evaluate(source, noisy);
+
+    EXPECT_GT(report.log_spectral_distance_db, 1.0f);
+    EXPECT_LT(report.segmental_snr_db, 35.0f);
+    EXPECT_FLOAT_EQ(metrics.logSpectralDistance(source, noisy),
+        report.log_spectral_distance_db);
+}
+
+TEST(QualityMetricsTests, SilenceHasNoActiveFrames) {
+    auto source = std::vector<float>(8000, 0.0f);
+    auto report = QualityMetrics().evaluate(source, source);
+
+    EXPECT_EQ(report.n_active_frames, 0);
+    EXPECT_EQ(report.frames.size(), 40);
+}
+
+TEST(QualityMetricsTests, ResultIsIndependentOfThreads) {
+    auto source = qualityMetricsTestSubject();
+    auto synthesized = source;
+
+    for (int i = 0; i < static_cast<int>(synthesized.size()); i++) {
+        synthesized[i] *= 1.0f + 0.5f * sinf(0.01f * static_cast<float>(i));
+    }
+
+    auto metrics = QualityMetrics();
+    metrics.setThreads(1);
+    auto serial_report = metrics.evaluate(source, synthesized);
+
+    metrics.setThreads(4);
+    auto parallel_report = metrics.evaluate(source, synthesized);
+
+    EXPECT_EQ(serial_report.log_spectral_distance_db,
+        parallel_report.log_spectral_distance_db);
+    EXPECT_EQ(serial_report.segmental_snr_db,
+        parallel_report.segmental_snr_db);
+    EXPECT_EQ(serial_report.voicing_error_rate,
+        parallel_report.voicing_error_rate);
+}
+
+};  // namespace tms_express
@@ -0,0 +1,86 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "encoding/Frame.hpp"
+#include "encoding/RateController.hpp"
+
+namespace tms_express {
+
+/// @brief Creates a table of loud, slowly drifting Frames, with every third
+///         run of ten Frames unvoiced
+std::vector<Frame> rateControllerTestFrames(int n_frames) {
+    auto frames = std::vector<Frame>();
+
+    for (int i = 0; i < n_frames; i++) {
+        auto coeffs = std::vector<float>();
+
+        for (int j = 0; j < 10; j++) {
+            coeffs.push_back(0.4f * sinf(0.05f * i + static_cast<float>(j)));
+        }
+
+        auto is_voiced = (i / 10) % 3 != 0;
+        frames.push_back(Frame(is_voiced ? 50.0f : 0.0f, is_voiced,
+            1385.0f, coeffs));
+    }
+
+    return frames;
+}
+
+TEST(RateControllerTests, CountBytesMatchesFrameSizes) {
+    auto frames = rateControllerTestFrames(30);
+
+    // Ten unvoiced and twenty voiced Frames, plus the stop frame
+    auto n_bits = 10 * 29 + 20 * 50;
+    EXPECT_EQ(RateController::countBytes(frames, false), (n_bits + 7) / 8);
+    EXPECT_EQ(RateController::countBytes(frames, true), (n_bits + 11) / 8);
+}
+
+TEST(RateControllerTests, UnlimitedBudgetOnlyMeasures) {
+    auto frames = rateControllerTestFrames(30);
+    auto original = frames;
+
+    auto result = RateController().fit(frames);
+
+    EXPECT_EQ(result.n_bytes, RateController::countBytes(original, true));
+    EXPECT_EQ(result.n_repeat_frames, 0);
+    EXPECT_TRUE(result.isWithinBudget());
+
+    for (int i = 0; i < static_cast<int>(frames.size()); i++) {
+        EXPECT_EQ(frames[i].toBinary(), original[i].toBinary());
+    }
+}
+
+TEST(RateControllerTests, FeasibleBudgetIsMet) {
+    auto frames = rateControllerTestFrames(100);
+    auto full_size = RateController::countBytes(frames, true);
+
+    auto result = RateController(full_size / 2).fit(frames);
+
+    EXPECT_TRUE(result.isWithinBudget());
+    EXPECT_EQ(result.n_bytes, RateController::countBytes(frames, true));
+    EXPECT_GT(result.n_repeat_frames, 0);
+}
+
+TEST(RateControllerTests, TightBudgetSilencesFrames) {
+    auto frames = rateControllerTestFrames(100);
+
+    // Even the longest repeat chains of unvoiced Frames cost 29 + 4 * 11
+    // bits per five Frames, so this budget requires silencing
+    auto result = RateController(100 * 14 / 8).fit(frames);
+
+    EXPECT_TRUE(result.isWithinBudget());
+    EXPECT_GT(result.n_silenced_frames, 0);
+}
+
+TEST(RateControllerTests, BitrateIsConvertedToBytes) {
+    // 100 Frames of 25 ms at 1200 bits per second span 2.5 s, or 375 bytes
+    EXPECT_EQ(RateController::bytesForBitrate(1200.0f, 100, 25.0f), 375);
+    EXPECT_EQ(RateController::bytesForBitrate(0.1f, 1, 25.0f), 1);
+}
+
+};  // namespace tms_express
@@ -0,0 +1,64 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "audio/AudioBuffer.hpp"
+#include "audio/PolyphaseDecimator.hpp"
+#include "audio/Resampler.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+/// @brief Resamples a signal in fixed-size blocks
+/// @param resampler Resampler
+/// @param input Input samples
+/// @param block_size Samples per block
+/// @return Resampled signal
+std::vector<float> resampleInBlocks(Resampler &resampler,
+    const std::vector<float> &input, int block_size) {
+    //
+    auto output = std::vector<float>();
+
+    for (int offset = 0; offset < static_cast<int>(input.size());
+        offset += block_size) {
+        //
+        auto n = std::min(block_size,
+            static_cast<int>(input.size()) - offset);
+        resampler.process(input.data() + offset, n, output);
+    }
+
+    resampler.flush(output);
+    return output;
+}
+
+TEST(ResamplerTests, PolyphaseTierMatchesDecimator) {
+    auto input = test::sineWave(440.0f, 48000, 48000);
+    auto expected = PolyphaseDecimator(6).decimate(input);
+
+    auto resampler = Resampler(48000, 8000,
+        AudioBuffer::RESAMPLEQUALITY_POLYPHASE);
+    auto output = resampleInBlocks(resampler, input, 4096);
+
+    EXPECT_EQ(output, expected);
+}
+
+TEST(ResamplerTests, SincTiersProduceExpectedLength) {
+    auto input = test::sineWave(440.0f, 44100, 44100);
+
+    for (auto quality : {AudioBuffer::RESAMPLEQUALITY_SINC_MEDIUM,
+        AudioBuffer::RESAMPLEQUALITY_SINC_FASTEST,
+        AudioBuffer::RESAMPLEQUALITY_POLYPHASE}) {
+        //
+        auto resampler = Resampler(44100, 8000, quality);
+        auto output = resampleInBlocks(resampler, input, 4096);
+
+        EXPECT_LE(std::abs(static_cast<int>(output.size()) - 8000), 2);
+    }
+}
+
+};  // namespace tms_express
@@ -0,0 +1,90 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "audio/RingBuffer.hpp"
+
+namespace tms_express {
+
+TEST(RingBufferTests, WritesAreLimitedToFreeSpace) {
+    auto ring_buffer = RingBuffer(4);
+    auto samples = std::vector<float>({1, 2, 3, 4, 5, 6});
+
+    EXPECT_EQ(ring_buffer.write(samples.data(), 6), 4);
+    EXPECT_EQ(ring_buffer.getNReadable(), 4);
+    EXPECT_EQ(ring_buffer.getNWritable(), 0);
+    EXPECT_EQ(ring_buffer.write(samples.data(), 1), 0);
+}
+
+TEST(RingBufferTests, SamplesWrapAroundStorage) {
+    auto ring_buffer = RingBuffer(5);
+    auto output = std::vector<float>(8);
+
+    auto first = std::vector<float>({1, 2, 3});
+    EXPECT_EQ(ring_buffer.write(first.data(), 3), 3);
+    EXPECT_EQ(ring_buffer.read(output.data(), 2), 2);
+
+    // Four free slots remain, the last three of which wrap to the start
+    auto second = std::vector<float>({4, 5, 6, 7});
+    EXPECT_EQ(ring_buffer.write(second.data(), 4), 4);
+
+    EXPECT_EQ(ring_buffer.read(output.data(), 8), 5);
+    EXPECT_EQ(std::vector<float>(output.begin(), output.begin() + 5),
+        std::vector<float>({3, 4, 5, 6, 7}));
+    EXPECT_EQ(ring_buffer.getNReadable(), 0);
+}
+
+TEST(RingBufferTests, ConcurrentProducerAndConsumerPreserveOrder) {
+    auto ring_buffer = RingBuffer(64);
+    constexpr int kNSamples = 20000;
+
+    // Chunk sizes are coprime with the capacity, such that every alignment of
+    // the wrap-around point is exercised
+    auto producer = std::thread([&ring_buffer]() {
+        auto chunk = std::vector<float>(37);
+        auto n_written = 0;
+
+        while (n_written < kNSamples) {
+            auto n_chunk = std::min(37, kNSamples - n_written);
+
+            for (int i = 0; i < n_chunk; i++) {
+                chunk[i] = static_cast<float>(n_written + i);
+            }
+
+            auto n_done = 0;
+            while (n_done < n_chunk) {
+                n_done += ring_buffer.write(chunk.data() + n_done,
+                    n_chunk - n_done);
+                std::this_thread::yield();
+            }
+
+            n_written += n_chunk;
+        }
+    });
+
+    auto chunk = std::vector<float>(53);
+    auto n_read = 0;
+    auto is_ordered = true;
+
+    while (n_read < kNSamples) {
+        auto n_chunk = ring_buffer.read(chunk.data(), 53);
+
+        for (int i = 0; i < n_chunk; i++) {
+            is_ordered &= chunk[i] == static_cast<float>(n_read + i);
+        }
+
+        n_read += n_chunk;
+        std::this_thread::yield();
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(is_ordered);
+    EXPECT_EQ(ring_buffer.getNReadable(), 0);
+}
+
+};  // namespace tms_express
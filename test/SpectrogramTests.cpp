@@ -0,0 +1,71 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "analysis/Spectrogram.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+TEST(SpectrogramTests, ColumnsAreGroupedIntoTiles) {
+    auto spectrogram = Spectrogram(256, 64, 32);
+    spectrogram.setSamples(test::sineWave(1000.0f, 8000, 8000));
+
+    EXPECT_EQ(spectrogram.getNColumns(), 125);
+    EXPECT_EQ(spectrogram.getNTiles(), 4);
+    EXPECT_EQ(spectrogram.getNBins(), 129);
+
+    // The last tile holds the remaining 29 columns
+    EXPECT_EQ(static_cast<int>(spectrogram.getTile(3).size()), 29 * 129);
+}
+
+TEST(SpectrogramTests, FullScaleSinusoidPeaksNearZeroDecibels) {
+    auto spectrogram = Spectrogram(256, 64, 32);
+    spectrogram.setSamples(test::sineWave(1000.0f, 8000, 8000));
+
+    // 1 kHz falls on bin 32 of a 256-point transform at 8 kHz
+    auto &tile = spectrogram.getTile(1);
+    auto column = tile.begin() + 5 * 129;
+    auto peak = std::max_element(column, column + 129);
+
+    EXPECT_EQ(peak - column, 32);
+    EXPECT_NEAR(*peak, 0.0f, 0.5f);
+}
+
+TEST(SpectrogramTests, UnchangedTilesAreReused) {
+    auto spectrogram = Spectrogram(256, 64, 32);
+    auto samples = test::sineWave(1000.0f, 8000, 8000);
+    spectrogram.setSamples(samples);
+
+    for (int t = 0; t < spectrogram.getNTiles(); t++) {
+        spectrogram.getTile(t);
+    }
+
+    EXPECT_EQ(spectrogram.getNTileComputations(), 4);
+
+    // An edit near the end of the signal invalidates only the last tile
+    samples[7900] = 0.0f;
+    spectrogram.setSamples(samples);
+
+    EXPECT_TRUE(spectrogram.isTileCached(0));
+    EXPECT_TRUE(spectrogram.isTileCached(2));
+    EXPECT_FALSE(spectrogram.isTileCached(3));
+
+    for (int t = 0; t < spectrogram.getNTiles(); t++) {
+        spectrogram.getTile(t);
+    }
+
+    EXPECT_EQ(spectrogram.getNTileComputations(), 5);
+}
+
+TEST(SpectrogramTests, PeaksAreLocalMaxima) {
+    auto spectrum = std::vector<float>({0, 3, 1, 1, 5, 5, 2, 4});
+
+    EXPECT_EQ(Spectrogram::findPeaks(spectrum.data(), 8),
+        std::vector<int>({1, 4}));
+}
+
+};  // namespace tms_express
@@ -0,0 +1,132 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/LinearPredictor.hpp"
+#include "analysis/Spectrum.hpp"
+
+namespace tms_express {
+
+TEST(SpectrumTests, SizeIsRoundedUpToPowerOfTwo) {
+    EXPECT_EQ(Spectrum(200).getSize(), 256);
+    EXPECT_EQ(Spectrum(256).getSize(), 256);
+    EXPECT_EQ(Spectrum(257).getNBins(), 257);
+}
+
+TEST(SpectrumTests, TransformMatchesNaiveDFT) {
+    auto spectrum = Spectrum(64);
+    auto data = std::vector<std::complex<float>>(64);
+
+    for (int i = 0; i < 64; i++) {
+        data[i] = {sinf(0.3f * static_cast<float>(i)) +
+            0.25f * cosf(1.7f * static_cast<float>(i)), 0.0f};
+    }
+
+    auto expected = std::vector<std::complex<float>>(64);
+    for (int k = 0; k < 64; k++) {
+        for (int n = 0; n < 64; n++) {
+            auto theta = -2.0f * static_cast<float>(M_PI) *
+                static_cast<float>(k * n) / 64.0f;
+            expected[k] += data[n] * std::complex<float>(cosf(theta),
+                sinf(theta));
+        }
+    }
+
+    spectrum.transform(data.data());
+
+    for (int k = 0; k < 64; k++) {
+        EXPECT_NEAR(data[k].real(), expected[k].real(), 1e-3f);
+        EXPECT_NEAR(data[k].imag(), expected[k].imag(), 1e-3f);
+    }
+}
+
+TEST(SpectrumTests, SinePeaksAtItsFrequencyBin) {
+    auto spectrum = Spectrum(256);
+    auto samples = std::vector<float>(256);
+
+    // 1 kHz at 8 kHz falls exactly on bin 32 of a 256-point transform
+    for (int i = 0; i < 256; i++) {
+        samples[i] = sinf(2.0f * static_cast<float>(M_PI) * 1000.0f *
+            static_cast<float>(i) / 8000.0f);
+    }
+
+    auto power = std::vector<float>(spectrum.getNBins());
+    spectrum.powerSpectrum(samples.data(), 256, power.data());
+
+    auto peak = std::max_element(power.begin(), power.end()) - power.begin();
+    EXPECT_EQ(peak, 32);
+}
+
+TEST(SpectrumTests, LogSpectralDistanceIgnoresRemovedOffset) {
+    auto spectrum = Spectrum(200);
+    auto samples = std::vector<float>(200);
+
+    for (int i = 0; i < 200; i++) {
+        samples[i] = sinf(0.2f * static_cast<float>(i)) +
+            0.1f * sinf(2.3f * static_cast<float>(i));
+    }
+
+    auto louder = samples;
+    for (auto &sample : louder) {
+        sample *= 10.0f;
+    }
+
+    auto a_db = std::vector<float>(spectrum.getNBins());
+    auto b_db = std::vector<float>(spectrum.getNBins());
+    spectrum.logPowerSpectrum(louder.data(), 200, a_db.data());
+    spectrum.logPowerSpectrum(samples.data(), 200, b_db.data());
+
+    auto n_bins = spectrum.getNBins();
+    EXPECT_NEAR(Spectrum::logSpectralDistance(a_db.data(), b_db.data(),
+        n_bins), 20.0f, 1e-3f);
+    EXPECT_NEAR(Spectrum::logSpectralDistance(a_db.data(), b_db.data(),
+        n_bins, 20.0f), 0.0f, 1e-3f);
+}
+
+TEST(SpectrumTests, FirstOrderEnvelopeMatchesClosedForm) {
+    auto spectrum = Spectrum(256);
+    auto envelope_db = std::vector<float>(spectrum.getNBins());
+
+    // A(z) = 1 - 0.9 z^-1, whose response is 1 / |A|^2
+    spectrum.lpcEnvelope({-0.9f}, envelope_db.data());
+
+    EXPECT_NEAR(envelope_db.front(), -20.0f * log10f(0.1f), 1e-3f);
+    EXPECT_NEAR(envelope_db.back(), -20.0f * log10f(1.9f), 1e-3f);
+}
+
+TEST(SpectrumTests, EnvelopePeaksAtResonance) {
+    // Second-order resonator at 1 kHz, excited by pseudo-random noise
+    auto samples = std::vector<float>(4000);
+    auto theta = 2.0f * static_cast<float>(M_PI) * 1000.0f / 8000.0f;
+    auto radius = 0.95f;
+    auto seed = 12345u;
+
+    for (int i = 2; i < 4000; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        auto noise = static_cast<float>(seed >> 8) / 16777216.0f - 0.5f;
+
+        samples[i] = 2.0f * radius * cosf(theta) * samples[i - 1] -
+            radius * radius * samples[i - 2] + noise;
+    }
+
+    auto predictor = LinearPredictor(10);
+    auto reflectors = predictor.computeCoeffs(Autocorrelation(samples, 11));
+
+    auto spectrum = Spectrum(256);
+    auto envelope_db = std::vector<float>(spectrum.getNBins());
+    spectrum.lpcEnvelope(reflectors, envelope_db.data());
+
+    // 1 kHz falls on bin 32 of a 256-point transform at 8 kHz
+    auto peak = std::max_element(envelope_db.begin(), envelope_db.end()) -
+        envelope_db.begin();
+
+    EXPECT_NEAR(static_cast<float>(peak), 32.0f, 1.0f);
+}
+
+};  // namespace tms_express
@@ -0,0 +1,117 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "encoding/Frame.hpp"
+#include "encoding/Synthesizer.hpp"
+#include "encoding/SynthesisStream.hpp"
+
+namespace tms_express {
+
+/// @brief Produces test subject, which alternates between voiced and
+///         unvoiced runs of Frames with drifting coefficients
+/// @param n_frames Number of Frames
+/// @return Test subject
+std::shared_ptr<const std::vector<Frame>> streamTestSubject(int n_frames) {
+    auto frames = std::vector<Frame>();
+
+    for (int i = 0; i < n_frames; i++) {
+        auto is_voiced = (i / 4) % 2 == 0;
+        auto coeffs = std::vector<float>();
+
+        for (int j = 0; j < 10; j++) {
+            coeffs.push_back(0.4f * sinf(0.3f * static_cast<float>(i + j)));
+        }
+
+        frames.emplace_back(is_voiced ? 50.0f : 0.0f, is_voiced, 1385.0f,
+            coeffs);
+    }
+
+    return std::make_shared<const std::vector<Frame>>(frames);
+}
+
+/// @brief Reads from a stream until it finishes, or until a sample limit
+/// @param stream Synthesis Stream
+/// @param max_samples Max number of samples to read
+/// @return Samples read
+std::vector<float> drain(SynthesisStream &stream, int max_samples = 1 << 30) {
+    auto samples = std::vector<float>();
+    auto block = std::vector<float>(64);
+
+    while (!stream.isFinished() &&
+        static_cast<int>(samples.size()) < max_samples) {
+        //
+        auto n_wanted = std::min(64,
+            max_samples - static_cast<int>(samples.size()));
+        auto n_read = stream.read(block.data(), n_wanted);
+
+        samples.insert(samples.end(), block.begin(), block.begin() + n_read);
+
+        if (n_read == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    return samples;
+}
+
+TEST(SynthesisStreamTests, StreamMatchesOfflineSynthesis) {
+    auto frames = streamTestSubject(40);
+    auto expected = Synthesizer().synthesize(*frames);
+
+    auto stream = SynthesisStream(8000, 50.0f);
+    stream.start(frames);
+
+    EXPECT_EQ(drain(stream), expected);
+    EXPECT_EQ(stream.getNextFrame(), 40);
+}
+
+TEST(SynthesisStreamTests, ReplacedFramesApplyToRemainingFrames) {
+    auto frames = streamTestSubject(40);
+
+    // The stream buffers 80 samples, less than the 200 samples of one Frame,
+    // so the producer is at most two Frames ahead when the table is replaced
+    auto stream = SynthesisStream(8000, 10.0f);
+    stream.start(frames);
+    auto samples = drain(stream, 400);
+
+    auto truncated = std::make_shared<const std::vector<Frame>>(
+        frames->begin(), frames->begin() + 10);
+    stream.setFrames(truncated);
+
+    auto remainder = drain(stream);
+    samples.insert(samples.end(), remainder.begin(), remainder.end());
+
+    EXPECT_EQ(samples, Synthesizer().synthesize(*truncated));
+}
+
+TEST(SynthesisStreamTests, StreamIsResampledToOutputRate) {
+    auto frames = streamTestSubject(40);
+
+    auto stream = SynthesisStream(16000, 50.0f);
+    stream.start(frames);
+    auto samples = drain(stream);
+
+    EXPECT_NEAR(static_cast<float>(samples.size()), 16000.0f, 32.0f);
+}
+
+TEST(SynthesisStreamTests, StopDiscardsBufferedAudio) {
+    auto stream = SynthesisStream(8000, 100.0f);
+    stream.start(streamTestSubject(40));
+    drain(stream, 200);
+
+    stream.stop();
+
+    auto sample = 0.0f;
+    EXPECT_TRUE(stream.isFinished());
+    EXPECT_EQ(stream.read(&sample, 1), 0);
+}
+
+};  // namespace tms_express
@@ -0,0 +1,77 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#ifndef TMS_EXPRESS_TEST_TESTSIGNALS_HPP_
+#define TMS_EXPRESS_TEST_TESTSIGNALS_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace tms_express::test {
+
+/// @brief Produces a harmonic tone, which by default spans a 25 ms segment
+///         sampled at 8 kHz
+/// @param period Fundamental period of the tone, in (fractional) samples
+/// @param n_samples Number of samples
+/// @param amplitudes Amplitude of each harmonic, starting with the
+///                     fundamental
+/// @return Samples
+inline std::vector<float> harmonicTone(float period, int n_samples = 200,
+    const std::vector<float> &amplitudes = {0.6f, 0.3f, 0.1f}) {
+    //
+    auto signal = std::vector<float>();
+
+    for (int i = 0; i < n_samples; i++) {
+        float phase = 2.0f * static_cast<float>(M_PI) *
+            static_cast<float>(i) / period;
+
+        float sample = 0.0f;
+        for (int k = 0; k < static_cast<int>(amplitudes.size()); k++) {
+            sample += amplitudes[k] * sinf(static_cast<float>(k + 1) * phase);
+        }
+
+        signal.push_back(sample);
+    }
+
+    return signal;
+}
+
+/// @brief Produces a unit-amplitude sine wave
+/// @param frequency_hz Frequency of the sine wave, in Hertz
+/// @param sample_rate_hz Sample rate, in Hertz
+/// @param n_samples Number of samples
+/// @return Samples
+inline std::vector<float> sineWave(float frequency_hz, int sample_rate_hz,
+    int n_samples) {
+    //
+    auto signal = std::vector<float>();
+
+    for (int i = 0; i < n_samples; i++) {
+        signal.push_back(sinf(2.0f * static_cast<float>(M_PI) * frequency_hz *
+            static_cast<float>(i) / static_cast<float>(sample_rate_hz)));
+    }
+
+    return signal;
+}
+
+/// @brief Produces deterministic white noise, via a linear congruential
+///         generator, such that tests are repeatable
+/// @param n_samples Number of samples
+/// @param amplitude Peak-to-peak amplitude of the noise
+/// @return Samples, centered about zero
+inline std::vector<float> whiteNoise(int n_samples, float amplitude = 1.0f) {
+    auto signal = std::vector<float>();
+    uint32_t state = 1;
+
+    for (int i = 0; i < n_samples; i++) {
+        state = state * 1664525u + 1013904223u;
+        signal.push_back(amplitude * (static_cast<float>(state >> 8) /
+            static_cast<float>(1 << 24) - 0.5f));
+    }
+
+    return signal;
+}
+
+};  // namespace tms_express::test
+
+#endif  // TMS_EXPRESS_TEST_TESTSIGNALS_HPP_
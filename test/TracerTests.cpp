@@ -0,0 +1,139 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "analysis/ParallelFor.hpp"
+#include "stats/EncoderStats.hpp"
+#include "stats/Tracer.hpp"
+
+namespace tms_express {
+
+/// @brief Collects the complete ("X") events of a trace
+/// @param trace Chrome trace-event JSON
+/// @return Complete events
+std::vector<nlohmann::json> tracerTestEvents(const std::string &trace) {
+    auto json = nlohmann::json::parse(trace);
+    auto events = std::vector<nlohmann::json>();
+
+    for (const auto &event : json["traceEvents"]) {
+        if (event["ph"] == "X") {
+            events.push_back(event);
+        }
+    }
+
+    return events;
+}
+
+TEST(TracerTests, DisabledTracerRecordsNothing) {
+    Tracer::reset();
+    ASSERT_FALSE(Tracer::isEnabled());
+
+    {
+        auto scope = Tracer::Scope("ignored.wav", "file");
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_DECODE);
+    }
+
+    EXPECT_TRUE(tracerTestEvents(Tracer::toJSON()).empty());
+}
+
+TEST(TracerTests, StagesNestWithinFiles) {
+    Tracer::reset();
+    Tracer::enable();
+
+    {
+        auto scope = Tracer::Scope("speech", "file");
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_ANALYSIS);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    Tracer::disable();
+    auto events = tracerTestEvents(Tracer::toJSON());
+    Tracer::reset();
+
+    ASSERT_EQ(events.size(), 2);
+
+    // The inner scope ends, and is therefore recorded, first
+    auto stage = events[0];
+    auto file = events[1];
+
+    EXPECT_EQ(stage["name"], "analysis");
+    EXPECT_EQ(stage["cat"], "stage");
+    EXPECT_EQ(file["name"], "speech");
+    EXPECT_EQ(file["cat"], "file");
+    EXPECT_EQ(stage["tid"], file["tid"]);
+
+    EXPECT_GE(stage["dur"].get<double>(), 1000.0);
+    EXPECT_LE(file["ts"].get<double>(), stage["ts"].get<double>());
+    EXPECT_GE(file["ts"].get<double>() + file["dur"].get<double>(),
+        stage["ts"].get<double>() + stage["dur"].get<double>());
+}
+
+TEST(TracerTests, ThreadsRecordIntoNamedTracks) {
+    Tracer::reset();
+    Tracer::enable();
+
+    ParallelFor(8, 4, [](int i) {
+        auto scope = Tracer::Scope("task " + std::to_string(i), "file");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+
+    Tracer::disable();
+    auto trace = nlohmann::json::parse(Tracer::toJSON());
+    Tracer::reset();
+
+    auto named_threads = std::set<int>();
+    auto names = std::set<std::string>();
+
+    for (const auto &event : trace["traceEvents"]) {
+        if (event["ph"] == "M") {
+            named_threads.insert(event["tid"].get<int>());
+
+        } else {
+            names.insert(event["name"].get<std::string>());
+        }
+    }
+
+    // Every task is recorded once, on a thread which has a name
+    EXPECT_EQ(names.size(), 8);
+
+    for (const auto &event : trace["traceEvents"]) {
+        EXPECT_EQ(named_threads.count(event["tid"].get<int>()), 1);
+    }
+}
+
+TEST(TracerTests, WritesTraceFile) {
+    auto path = (std::filesystem::temp_directory_path() /
+        "tmsexpress-trace.json").string();
+
+    Tracer::reset();
+    Tracer::enable();
+
+    {
+        auto timer = EncoderStats::ScopedTimer(EncoderStats::STAGE_WRITE);
+    }
+
+    Tracer::disable();
+    ASSERT_TRUE(Tracer::write(path));
+    Tracer::reset();
+
+    auto file = std::ifstream(path);
+    auto contents = std::string(std::istreambuf_iterator<char>(file), {});
+    file.close();
+    std::filesystem::remove(path);
+
+    auto events = tracerTestEvents(contents);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0]["name"], "write");
+}
+
+};  // namespace tms_express
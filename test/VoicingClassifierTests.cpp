@@ -0,0 +1,118 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/LinearPredictor.hpp"
+#include "analysis/VoicingClassifier.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+TEST(VoicingClassifierTests, ZeroCrossingRateOfAlternatingSignalIsOne) {
+    auto segment = std::vector<float>(200);
+
+    for (int i = 0; i < 200; i++) {
+        segment[i] = (i % 2 == 0) ? 1.0f : -1.0f;
+    }
+
+    EXPECT_FLOAT_EQ(VoicingClassifier::zeroCrossingRate(segment), 1.0f);
+}
+
+TEST(VoicingClassifierTests, ZeroCrossingRateSeparatesToneFromNoise) {
+    auto tone = test::harmonicTone(80.0f, 200, {0.6f, 0.3f});
+    auto noise = test::whiteNoise(200);
+
+    EXPECT_LT(VoicingClassifier::zeroCrossingRate(tone), 0.1f);
+    EXPECT_NEAR(VoicingClassifier::zeroCrossingRate(noise), 0.5f, 0.1f);
+}
+
+TEST(VoicingClassifierTests, ZeroCrossingRateIsIndependentOfK1) {
+    // A quiet high-frequency ripple beneath loud low-frequency pulses crosses
+    // zero on nearly every sample, while the pulses dominate the
+    // autocorrelation and so tilt k1 toward a voiced spectrum
+    auto segment = std::vector<float>(200);
+
+    for (int i = 0; i < 200; i++) {
+        segment[i] = (i % 50 < 2) ? 1.0f : ((i % 2 == 0) ? 0.01f : -0.01f);
+    }
+
+    auto k1 = LinearPredictor().computeCoeffs(Autocorrelation(segment))[0];
+
+    EXPECT_LT(k1, -0.3f);
+    EXPECT_GT(VoicingClassifier::zeroCrossingRate(segment), 0.9f);
+}
+
+TEST(VoicingClassifierTests, PeriodicityIsHighAtPeriodOfTone) {
+    auto segment = test::harmonicTone(80.0f, 200, {0.6f, 0.3f});
+    auto acf = Autocorrelation(segment);
+
+    EXPECT_GT(VoicingClassifier::periodicity(acf[0], acf[80], 80, 200),
+        0.95f);
+    EXPECT_LT(VoicingClassifier::periodicity(acf[0], acf[40], 40, 200),
+        0.5f);
+}
+
+TEST(VoicingClassifierTests, ClassifiesToneAsVoiced) {
+    auto classifier = VoicingClassifier();
+    auto segment = test::harmonicTone(80.0f, 200, {0.6f, 0.3f});
+    auto acf = Autocorrelation(segment);
+
+    EXPECT_TRUE(classifier.classify(segment, acf, 80.0f, segment, -0.9f));
+}
+
+TEST(VoicingClassifierTests, ClassifiesWithoutPitchAutocorrelation) {
+    auto classifier = VoicingClassifier();
+    auto segment = test::harmonicTone(80.0f, 200, {0.6f, 0.3f});
+    EXPECT_TRUE(classifier.classify(segment, {}, 80.0f, segment, -0.9f));
+}
+
+TEST(VoicingClassifierTests, ClassifiesNoiseAsUnvoiced) {
+    auto classifier = VoicingClassifier();
+    auto segment = test::whiteNoise(200);
+    auto acf = Autocorrelation(segment);
+
+    EXPECT_FALSE(classifier.classify(segment, acf, 80.0f, segment, 0.1f));
+}
+
+TEST(VoicingClassifierTests, PeakEnergyIsLoudestSegment) {
+    auto samples = std::vector<float>(8, 0.0f);
+    samples[4] = 2.0f;
+    samples[5] = -2.0f;
+
+    EXPECT_FLOAT_EQ(VoicingClassifier::peakEnergy(samples.data(), 8, 4),
+        2.0f);
+}
+
+TEST(VoicingClassifierTests, SeededPeakPenalizesQuietFirstSegment) {
+    auto classifier = VoicingClassifier();
+
+    // Unseeded, the first segment is its own peak and earns a full energy
+    // score, even if the rest of the utterance is 40 dB louder
+    EXPECT_GT(classifier.score(1e-4f, 0.25f, 0.5f, 0.0f), 0.5f);
+
+    classifier.reset(1.0f);
+    EXPECT_LT(classifier.score(1e-4f, 0.25f, 0.5f, 0.0f), 0.5f);
+}
+
+TEST(VoicingClassifierTests, HysteresisIsOffByDefault) {
+    auto classifier = VoicingClassifier();
+
+    EXPECT_FLOAT_EQ(classifier.getHysteresis(), 0.0f);
+    EXPECT_TRUE(classifier.classify(0.55f));
+    EXPECT_FALSE(classifier.classify(0.45f));
+}
+
+TEST(VoicingClassifierTests, HysteresisHoldsPreviousDecision) {
+    auto classifier = VoicingClassifier(0.1f);
+
+    // A borderline score neither enters nor leaves the voiced state
+    EXPECT_FALSE(classifier.classify(0.55f));
+    EXPECT_TRUE(classifier.classify(0.65f));
+    EXPECT_TRUE(classifier.classify(0.45f));
+    EXPECT_FALSE(classifier.classify(0.35f));
+}
+
+};  // namespace tms_express
@@ -0,0 +1,54 @@
+// Copyright 2024 Joseph Bellahcen <joeclb@icloud.com>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "analysis/Autocorrelation.hpp"
+#include "analysis/YinPitchEstimator.hpp"
+#include "test/TestSignals.hpp"
+
+namespace tms_express {
+
+TEST(YinPitchEstimatorTests, NormalizedDifferenceIsOneAtLagZero) {
+    auto segment = test::harmonicTone(50.0f);
+    auto acf = tms_express::Autocorrelation(segment);
+
+    auto cmndf = YinPitchEstimator::normalizedDifference(segment, acf);
+    EXPECT_FLOAT_EQ(cmndf[0], 1.0f);
+}
+
+TEST(YinPitchEstimatorTests, NormalizedDifferenceDipsAtPeriod) {
+    auto segment = test::harmonicTone(50.0f);
+    auto acf = tms_express::Autocorrelation(segment);
+
+    auto cmndf = YinPitchEstimator::normalizedDifference(segment, acf);
+    EXPECT_LT(cmndf[50], 0.1f);
+}
+
+TEST(YinPitchEstimatorTests, EstimatesIntegerPeriod) {
+    auto estimator = YinPitchEstimator(8000);
+    auto period = estimator.estimatePeriod(test::harmonicTone(80.0f));
+
+    EXPECT_NEAR(period, 80.0f, 0.25f);
+}
+
+TEST(YinPitchEstimatorTests, EstimatesFractionalPeriod) {
+    // A period of 45.5 samples lies between the TMS5220 pitch table entries
+    // 44 and 46, where integer estimates are ambiguous
+    auto estimator = YinPitchEstimator(8000);
+    auto period = estimator.estimatePeriod(test::harmonicTone(45.5f));
+
+    EXPECT_NEAR(period, 45.5f, 0.25f);
+}
+
+TEST(YinPitchEstimatorTests, PeriodIsClampedToBounds) {
+    // A 1 kHz tone lies above the max pitch frequency
+    auto estimator = YinPitchEstimator(8000, 50, 500);
+    auto period = estimator.estimatePeriod(test::harmonicTone(8.0f));
+
+    EXPECT_GE(period, static_cast<float>(estimator.getMinPeriod()));
+    EXPECT_LE(period, static_cast<float>(estimator.getMaxPeriod()));
+}
+
+};  // namespace tms_express